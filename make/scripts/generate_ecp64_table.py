@@ -0,0 +1,168 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 SAP SE. All rights reserved.
+# DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+#
+# This code is free software; you can redistribute it and/or modify it
+# under the terms of the GNU General Public License version 2 only, as
+# published by the Free Software Foundation.
+#
+# This code is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+# version 2 for more details (a copy is included in the LICENSE file that
+# accompanied this code).
+#
+# You should have received a copy of the GNU General Public License version
+# 2 along with this work; if not, write to the Free Software Foundation,
+# Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+#
+
+# Generates src/jdk.crypto.ec/share/native/libsunec/impl/ecp_64_table.h,
+# the field constants and fixed-base comb tables of the 64-bit limb P-256
+# and P-384 code in ecp_64.c. Only the curve parameters below (the same as
+# in ecl-curve.h) go in; everything else is derived here with plain integer
+# arithmetic, so the output can be audited against any other implementation.
+#
+# Usage: python3 generate_ecp64_table.py > ecp_64_table.h
+
+import sys
+
+CURVES = [
+    # name, bits, p, b, Gx, Gy
+    ("p256", 256,
+     0xFFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFF,
+     0x5AC635D8AA3A93E7B3EBBD55769886BC651D06B0CC53B0F63BCE3C3E27D2604B,
+     0x6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296,
+     0x4FE342E2FE1A7F9B8EE7EB4A7C0F9E162BCE33576B315ECECBB6406837BF51F5),
+    ("p384", 384,
+     0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFF0000000000000000FFFFFFFF,
+     0xB3312FA7E23EE7E4988E056BE3F82D19181D9C6EFE8141120314088F5013875AC656398D8A2ED19D2A85C8EDD3EC2AEF,
+     0xAA87CA22BE8B05378EB1C71EF320AD746E1D3B628BA79B9859F741E082542A385502F25DBF55296C3A545E3872760AB7,
+     0x3617DE4A96262C6F5D9E98BF9292DC29F8F41DBD289A147CE9DA3113B5F0B8C00A60B1CE1D7E819D7A431D7C90EA0E5F),
+]
+
+TEETH = 5
+COMBS = 4
+
+HEADER = """/*
+ * Copyright (c) 2026 SAP SE. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/* This file is generated by make/scripts/generate_ecp64_table.py, do not
+ * edit it by hand. */
+
+#ifndef _ECP_64_TABLE_H
+#define _ECP_64_TABLE_H
+
+/* Constants and fixed-base comb tables for the 64-bit limb NIST P-256 and
+ * P-384 code in ecp_64.c. Limbs are stored least significant first. The
+ * values are derived from the curve parameters in ecl-curve.h; each of the
+ * four tables has %d teeth. */
+""" % TEETH
+
+
+def limbs(v, n):
+    return [(v >> (64 * i)) & 0xFFFFFFFFFFFFFFFF for i in range(n)]
+
+
+def emit_limbs(out, values, indent):
+    lines = []
+    for i in range(0, len(values), 2):
+        lines.append(indent + ", ".join("0x%016xULL" % v for v in values[i:i + 2]))
+    out.append(",\n".join(lines))
+
+
+def point_add(p, a, b):
+    # affine addition on y^2 = x^3 - 3x + b, None is the point at infinity
+    if a is None:
+        return b
+    if b is None:
+        return a
+    (x1, y1), (x2, y2) = a, b
+    if x1 == x2:
+        if (y1 + y2) % p == 0:
+            return None
+        l = (3 * x1 * x1 - 3) * pow(2 * y1, p - 2, p) % p
+    else:
+        l = (y2 - y1) * pow(x2 - x1, p - 2, p) % p
+    x3 = (l * l - x1 - x2) % p
+    return (x3, (l * (x1 - x3) - y1) % p)
+
+
+def point_mul(p, k, pt):
+    r = None
+    while k > 0:
+        if k & 1:
+            r = point_add(p, r, pt)
+        pt = point_add(p, pt, pt)
+        k >>= 1
+    return r
+
+
+def emit_curve(out, name, bits, p, b, gx, gy):
+    n = bits // 64
+    r = 1 << bits
+    spacing = -(-bits // (TEETH * COMBS))
+    n0 = (-pow(p, -1, 1 << 64)) % (1 << 64)
+
+    out.append("")
+    out.append("/* %s: p, -p^-1 mod 2^64, R^2 mod p, R mod p, b*R mod p and p - 2 */"
+               % name.upper())
+    for suffix, v in (("p", p), ("rr", r * r % p), ("one", r % p),
+                      ("b", b * r % p), ("pm2", p - 2)):
+        out.append("static const mp_digit ecp64_%s_%s[%d] = {" % (name, suffix, n))
+        emit_limbs(out, limbs(v, n), " " * 8)
+        out.append("};")
+    out.append("#define ECP64_%s_N0 0x%016xULL" % (name.upper(), n0))
+    out.append("#define ECP64_%s_COMB_SPACING %d" % (name.upper(), spacing))
+    out.append("")
+    out.append("/* %s comb table: entry [s][j - 1] holds the affine point" % name.upper())
+    out.append(" * sum(bit b of j * 2^((%d * s + b) * %d) * G), coordinates in Montgomery form. */"
+               % (TEETH, spacing))
+    out.append("static const mp_digit ecp64_%s_comb[%d][%d][%d] = {"
+               % (name, COMBS, (1 << TEETH) - 1, 2 * n))
+    combs = []
+    for s in range(COMBS):
+        teeth = [point_mul(p, 1 << ((TEETH * s + t) * spacing), (gx, gy))
+                 for t in range(TEETH)]
+        entries = []
+        for j in range(1, 1 << TEETH):
+            pt = None
+            for t in range(TEETH):
+                if j & (1 << t):
+                    pt = point_add(p, pt, teeth[t])
+            e = []
+            emit_limbs(e, limbs(pt[0] * r % p, n) + limbs(pt[1] * r % p, n), " " * 12)
+            entries.append("        {\n" + e[0] + "\n        }")
+        combs.append("    {\n" + ",\n".join(entries) + "\n    }")
+    out.append(",\n".join(combs))
+    out.append("};")
+
+
+def main():
+    out = [HEADER.rstrip("\n")]
+    for curve in CURVES:
+        emit_curve(out, *curve)
+    out.append("")
+    out.append("#endif /* _ECP_64_TABLE_H */")
+    sys.stdout.write("\n".join(out) + "\n")
+
+
+if __name__ == "__main__":
+    main()
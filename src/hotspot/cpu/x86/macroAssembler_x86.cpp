@@ -1696,6 +1696,13 @@ void MacroAssembler::fast_lock(Register objReg, Register boxReg, Register tmpReg
     assert_different_registers(objReg, boxReg, tmpReg, scrReg);
   }
 
+  if (UseLockStack) {
+    // Objects are pushed on the lock stack by the runtime, always take
+    // the slow path. objReg is not NULL, so this sets ZF == 0.
+    testptr(objReg, objReg);
+    return;
+  }
+
   if (counters != NULL) {
     atomic_incl(ExternalAddress((address)counters->total_entry_count_addr()), scrReg);
   }
@@ -1884,6 +1891,12 @@ void MacroAssembler::fast_unlock(Register objReg, Register boxReg, Register tmpR
   assert(boxReg == rax, "");
   assert_different_registers(objReg, boxReg, tmpReg);
 
+  if (UseLockStack) {
+    // See fast_lock(): sets ZF == 0 to take the slow path.
+    testptr(objReg, objReg);
+    return;
+  }
+
   Label DONE_LABEL, Stacked, CheckSucc;
 
   // Critically, the biased locking test must have precedence over
@@ -31,6 +31,7 @@
 #include "services/dtraceAttacher.hpp"
 
 #include <unistd.h>
+#include <poll.h>
 #include <signal.h>
 #include <sys/types.h>
 #include <sys/socket.h>
@@ -56,9 +57,25 @@
 // 2. When a client connect, the SO_PEERCRED socket option is used to
 //    obtain the credentials of client. We check that the effective uid
 //    of the client matches this process.
+//
+// A client that polls the VM repeatedly can avoid the connection setup and
+// credential check per command by opening an attach session. It sends the
+// version string "2" on its own, the listener replies "0\n" and keeps the
+// connection open. Every request on the session is
+//   <id>0<cmd>0<arg>0<arg>0<arg>0
+// where <id> is an identifier chosen by the client which is echoed in the
+// response. The response is a sequence of frames, each starting with a
+// header line:
+//   D <id> <len>\n    followed by <len> bytes of output
+//   R <id> <result>\n the operation completed with the given result code
+// Output of long running operations is sent in several D frames as it is
+// produced. Requests can be pipelined; they are served in order. Up to
+// max_sessions sessions can be open at a time, the listener serves them
+// and new connections from a single poll loop.
 
 // forward reference
 class LinuxAttachOperation;
+class LinuxAttachSession;
 
 class LinuxAttachListener: AllStatic {
  private:
@@ -71,15 +88,32 @@ class LinuxAttachListener: AllStatic {
 
   static bool _atexit_registered;
 
-  // reads a request from the given connected socket
-  static LinuxAttachOperation* read_request(int s);
+  // the open attach sessions
+  static LinuxAttachSession* _sessions[];
+  static int _session_count;
+
+  // reads a request from the given connected socket, sets session to
+  // true if the client opened a session instead
+  static LinuxAttachOperation* read_request(int s, bool* session);
+
+  // checks the credentials of the peer of a newly accepted connection
+  static bool check_peer(int s);
+
+  static bool open_session(int s, char* buf, int len);
+  static LinuxAttachOperation* next_session_request();
 
  public:
   enum {
-    ATTACH_PROTOCOL_VER = 1                     // protocol version
+    ATTACH_PROTOCOL_VER         = 1,            // protocol version
+    ATTACH_PROTOCOL_SESSION_VER = 2             // protocol version of sessions
   };
   enum {
-    ATTACH_ERROR_BADVERSION     = 101           // error codes
+    ATTACH_ERROR_BADVERSION     = 101,          // error codes
+    ATTACH_ERROR_TOOMANYSESSIONS = 102
+  };
+  enum {
+    max_sessions = 8,                           // maximum number of open sessions
+    session_send_timeout = 10                   // seconds a write may stall
   };
 
   static void set_path(char* path) {
@@ -106,6 +140,47 @@ class LinuxAttachListener: AllStatic {
   static int write_fully(int s, char* buf, int len);
 
   static LinuxAttachOperation* dequeue();
+
+  static void close_session(LinuxAttachSession* session);
+  static void close_sessions();
+};
+
+// A connection on which the client sends any number of requests
+class LinuxAttachSession: public CHeapObj<mtInternal> {
+ public:
+  enum {
+    request_id_length_max = 16,                 // maximum length of a request id
+    request_length_max = (request_id_length_max + 1) + (AttachOperation::name_length_max + 1) +
+      AttachOperation::arg_count_max*(AttachOperation::arg_length_max + 1)
+  };
+
+ private:
+  int _socket;
+  bool _failed;                 // output could not be delivered to the client
+  int _len;                     // number of bytes in _buf
+  char _buf[request_length_max];
+
+ public:
+  LinuxAttachSession(int s) : _socket(s), _failed(false), _len(0) {}
+  virtual ~LinuxAttachSession() {}
+
+  int socket() const                                    { return _socket; }
+  bool has_failed() const                               { return _failed; }
+
+  // appends data to the request buffer, returns the number of bytes taken
+  int append(const char* buf, int len);
+
+  // reads what is available on the socket, returns false if the client
+  // closed the session or overran the request buffer
+  bool fill();
+
+  // parses the next request if it has been received completely. Sets
+  // malformed if the buffered data cannot be a valid request.
+  LinuxAttachOperation* next_request(bool* malformed);
+
+  // writes a frame of the response to the given request
+  void write_data(const char* id, const char* buf, size_t len);
+  void write_result(const char* id, jint result);
 };
 
 class LinuxAttachOperation: public AttachOperation {
@@ -113,14 +188,30 @@ class LinuxAttachOperation: public AttachOperation {
   // the connection to the client
   int _socket;
 
+  // the session the request was received on, if any
+  LinuxAttachSession* _session;
+  char _request_id[LinuxAttachSession::request_id_length_max + 1];
+
  public:
   void complete(jint res, bufferedStream* st);
 
+  bool is_streaming() const                             { return _session != NULL; }
+  void write_partial(const char* buf, size_t len);
+
   void set_socket(int s)                                { _socket = s; }
   int socket() const                                    { return _socket; }
 
+  void set_session(LinuxAttachSession* session, const char* id) {
+    _session = session;
+    set_socket(session->socket());
+    strncpy(_request_id, id, sizeof(_request_id));
+    _request_id[sizeof(_request_id) - 1] = '\0';
+  }
+
   LinuxAttachOperation(char* name) : AttachOperation(name) {
     set_socket(-1);
+    _session = NULL;
+    _request_id[0] = '\0';
   }
 };
 
@@ -129,6 +220,8 @@ char LinuxAttachListener::_path[UNIX_PATH_MAX];
 bool LinuxAttachListener::_has_path;
 int LinuxAttachListener::_listener = -1;
 bool LinuxAttachListener::_atexit_registered = false;
+LinuxAttachSession* LinuxAttachListener::_sessions[LinuxAttachListener::max_sessions];
+int LinuxAttachListener::_session_count = 0;
 
 // Supporting class to help split a buffer into individual components
 class ArgumentIterator : public StackObj {
@@ -246,9 +339,10 @@ int LinuxAttachListener::init() {
 // after the peer credentials have been checked and in the worst case it just
 // means that the attach listener thread is blocked.
 //
-LinuxAttachOperation* LinuxAttachListener::read_request(int s) {
+LinuxAttachOperation* LinuxAttachListener::read_request(int s, bool* session) {
   char ver_str[8];
   sprintf(ver_str, "%d", ATTACH_PROTOCOL_VER);
+  *session = false;
 
   // The request is a sequence of strings so we first figure out the
   // expected count and the maximum possible length of the request.
@@ -288,6 +382,14 @@ LinuxAttachOperation* LinuxAttachListener::read_request(int s) {
         // The first string is <ver> so check it now to
         // check for protocol mis-match
         if (str_count == 1) {
+          if ((strlen(buf) == strlen(ver_str)) &&
+              (atoi(buf) == ATTACH_PROTOCOL_SESSION_VER)) {
+            // the client opens a session, anything after the version
+            // string is already part of the first request
+            int used = off + i + 1;
+            *session = open_session(s, buf + used, off + n - used);
+            return NULL;
+          }
           if ((strlen(buf) != strlen(ver_str)) ||
               (atoi(buf) != ATTACH_PROTOCOL_VER)) {
             char msg[32];
@@ -338,48 +440,253 @@ LinuxAttachOperation* LinuxAttachListener::read_request(int s) {
 }
 
 
+// Turn a connection into a session. Returns false if the connection
+// should be closed.
+bool LinuxAttachListener::open_session(int s, char* buf, int len) {
+  char msg[32];
+  if (_session_count == max_sessions) {
+    log_debug(attach)("Too many attach sessions, rejecting session request");
+    sprintf(msg, "%d\n", ATTACH_ERROR_TOOMANYSESSIONS);
+    write_fully(s, msg, strlen(msg));
+    return false;
+  }
+
+  // bound the time a client that does not read its output can block us
+  struct timeval tv;
+  tv.tv_sec = session_send_timeout;
+  tv.tv_usec = 0;
+  if (::setsockopt(s, SOL_SOCKET, SO_SNDTIMEO, (void*)&tv, sizeof(tv)) == -1) {
+    return false;
+  }
+
+  LinuxAttachSession* session = new LinuxAttachSession(s);
+  if (session->append(buf, len) != len) {
+    delete session;     // more than a request with the handshake
+    return false;
+  }
+  sprintf(msg, "%d\n", 0);
+  if (write_fully(s, msg, strlen(msg)) != 0) {
+    delete session;
+    return false;
+  }
+  _sessions[_session_count++] = session;
+  log_debug(attach)("Attach session opened (%d open)", _session_count);
+  return true;
+}
+
+void LinuxAttachListener::close_session(LinuxAttachSession* session) {
+  for (int i = 0; i < _session_count; i++) {
+    if (_sessions[i] == session) {
+      _sessions[i] = _sessions[--_session_count];
+      break;
+    }
+  }
+  ::close(session->socket());
+  delete session;
+  log_debug(attach)("Attach session closed (%d open)", _session_count);
+}
+
+void LinuxAttachListener::close_sessions() {
+  while (_session_count > 0) {
+    close_session(_sessions[0]);
+  }
+}
+
+// Returns a request that has been received completely on one of the
+// sessions. Sessions are served round robin so that a client pipelining
+// many requests cannot starve the others.
+LinuxAttachOperation* LinuxAttachListener::next_session_request() {
+  static int next = 0;
+  for (int k = 0; k < _session_count; k++) {
+    int i = (next + k) % _session_count;
+    LinuxAttachSession* session = _sessions[i];
+    bool malformed = false;
+    LinuxAttachOperation* op = session->next_request(&malformed);
+    if (op != NULL) {
+      next = i + 1;
+      return op;
+    }
+    if (malformed) {
+      log_debug(attach)("Malformed request on attach session, closing it");
+      close_session(session);
+      // the sessions have been reordered, start over
+      return next_session_request();
+    }
+  }
+  return NULL;
+}
+
+// get the credentials of the peer and check the effective uid/guid
+bool LinuxAttachListener::check_peer(int s) {
+  struct ucred cred_info;
+  socklen_t optlen = sizeof(cred_info);
+  if (::getsockopt(s, SOL_SOCKET, SO_PEERCRED, (void*)&cred_info, &optlen) == -1) {
+    log_debug(attach)("Failed to get socket option SO_PEERCRED");
+    return false;
+  }
+
+  if (!os::Posix::matches_effective_uid_and_gid_or_root(cred_info.uid, cred_info.gid)) {
+    log_debug(attach)("euid/egid check failed (%d/%d vs %d/%d)",
+            cred_info.uid, cred_info.gid, geteuid(), getegid());
+    return false;
+  }
+  return true;
+}
+
 // Dequeue an operation
 //
 // In the Linux implementation there is only a single operation and clients
-// cannot queue commands (except at the socket level).
+// cannot queue commands (except at the socket level or by pipelining
+// requests on a session).
 //
 LinuxAttachOperation* LinuxAttachListener::dequeue() {
   for (;;) {
-    int s;
+    // serve requests that have already been read from a session
+    LinuxAttachOperation* op = next_session_request();
+    if (op != NULL) {
+      return op;
+    }
 
-    // wait for client to connect
+    // wait for a client to connect or to send on one of the sessions
+    struct pollfd fds[1 + max_sessions];
+    int nfds = 1 + _session_count;
+    fds[0].fd = listener();
+    fds[0].events = POLLIN;
+    for (int i = 0; i < _session_count; i++) {
+      fds[1 + i].fd = _sessions[i]->socket();
+      fds[1 + i].events = POLLIN;
+    }
+    int n;
+    RESTARTABLE(::poll(fds, nfds, -1), n);
+    if (n == -1) {
+      close_sessions();
+      return NULL;      // log a warning?
+    }
+
+    // read from the sessions, back to front as closing a session moves
+    // the last one into its slot
+    for (int i = nfds - 2; i >= 0; i--) {
+      if (fds[1 + i].revents != 0 && !_sessions[i]->fill()) {
+        close_session(_sessions[i]);
+      }
+    }
+
+    if (fds[0].revents == 0) {
+      continue;
+    }
+
+    // accept the client
+    int s;
     struct sockaddr addr;
     socklen_t len = sizeof(addr);
     RESTARTABLE(::accept(listener(), &addr, &len), s);
     if (s == -1) {
+      close_sessions();
       return NULL;      // log a warning?
     }
 
-    // get the credentials of the peer and check the effective uid/guid
-    struct ucred cred_info;
-    socklen_t optlen = sizeof(cred_info);
-    if (::getsockopt(s, SOL_SOCKET, SO_PEERCRED, (void*)&cred_info, &optlen) == -1) {
-      log_debug(attach)("Failed to get socket option SO_PEERCRED");
+    if (!check_peer(s)) {
       ::close(s);
       continue;
     }
 
-    if (!os::Posix::matches_effective_uid_and_gid_or_root(cred_info.uid, cred_info.gid)) {
-      log_debug(attach)("euid/egid check failed (%d/%d vs %d/%d)",
-              cred_info.uid, cred_info.gid, geteuid(), getegid());
+    // peer credential look okay so we read the request
+    bool session;
+    op = read_request(s, &session);
+    if (op != NULL) {
+      return op;
+    }
+    if (!session) {
       ::close(s);
-      continue;
     }
+  }
+}
+
+int LinuxAttachSession::append(const char* buf, int len) {
+  int n = MIN2(len, (int)request_length_max - _len);
+  memcpy(_buf + _len, buf, n);
+  _len += n;
+  return n;
+}
+
+bool LinuxAttachSession::fill() {
+  int left = request_length_max - _len;
+  if (left == 0) {
+    return false;       // not even one request fits
+  }
+  int n;
+  RESTARTABLE(::read(_socket, _buf + _len, left), n);
+  if (n <= 0) {
+    return false;       // closed by the client or error
+  }
+  _len += n;
+  return true;
+}
+
+LinuxAttachOperation* LinuxAttachSession::next_request(bool* malformed) {
+  // a request is complete once all strings have been received
+  const int expected_str_count = 2 + AttachOperation::arg_count_max;
+  int str_count = 0;
+  int req_len = 0;
+  while (req_len < _len && str_count < expected_str_count) {
+    if (_buf[req_len++] == '\0') {
+      str_count++;
+    }
+  }
+  if (str_count < expected_str_count) {
+    *malformed = (_len == request_length_max);
+    return NULL;
+  }
 
-    // peer credential look okay so we read the request
-    LinuxAttachOperation* op = read_request(s);
-    if (op == NULL) {
-      ::close(s);
-      continue;
-    } else {
-      return op;
+  ArgumentIterator args(_buf, req_len);
+  LinuxAttachOperation* op = NULL;
+
+  char* id = args.next();
+  char* name = args.next();
+  if (id != NULL && strlen(id) <= request_id_length_max &&
+      name != NULL && strlen(name) <= AttachOperation::name_length_max) {
+    op = new LinuxAttachOperation(name);
+    op->set_session(this, id);
+    for (int i=0; i<AttachOperation::arg_count_max; i++) {
+      char* arg = args.next();
+      if (arg != NULL && strlen(arg) > AttachOperation::arg_length_max) {
+        delete op;
+        op = NULL;
+        break;
+      }
+      op->set_arg(i, arg);
     }
   }
+
+  // drop the request from the buffer, it may already hold the next one
+  _len -= req_len;
+  memmove(_buf, _buf + req_len, _len);
+
+  *malformed = (op == NULL);
+  return op;
+}
+
+void LinuxAttachSession::write_data(const char* id, const char* buf, size_t len) {
+  if (_failed || len == 0) {
+    return;
+  }
+  char hdr[64];
+  int n = jio_snprintf(hdr, sizeof(hdr), "D %s " SIZE_FORMAT "\n", id, len);
+  if (LinuxAttachListener::write_fully(_socket, hdr, n) != 0 ||
+      LinuxAttachListener::write_fully(_socket, (char*) buf, (int) len) != 0) {
+    _failed = true;
+  }
+}
+
+void LinuxAttachSession::write_result(const char* id, jint result) {
+  if (_failed) {
+    return;
+  }
+  char msg[64];
+  int n = jio_snprintf(msg, sizeof(msg), "R %s %d\n", id, result);
+  if (LinuxAttachListener::write_fully(_socket, msg, n) != 0) {
+    _failed = true;
+  }
 }
 
 // write the given buffer to the socket
@@ -413,26 +720,59 @@ void LinuxAttachOperation::complete(jint result, bufferedStream* st) {
   // cleared by handle_special_suspend_equivalent_condition() or
   // java_suspend_self() via check_and_wait_while_suspended()
 
-  // write operation result
-  char msg[32];
-  sprintf(msg, "%d\n", result);
-  int rc = LinuxAttachListener::write_fully(this->socket(), msg, strlen(msg));
+  if (_session != NULL) {
+    // send the rest of the output and the result, the session stays
+    // open unless the client went away
+    _session->write_data(_request_id, st->base(), st->size());
+    _session->write_result(_request_id, result);
+    if (_session->has_failed()) {
+      LinuxAttachListener::close_session(_session);
+    }
+  } else {
+    // write operation result
+    char msg[32];
+    sprintf(msg, "%d\n", result);
+    int rc = LinuxAttachListener::write_fully(this->socket(), msg, strlen(msg));
+
+    // write any result data
+    if (rc == 0) {
+      LinuxAttachListener::write_fully(this->socket(), (char*) st->base(), st->size());
+      ::shutdown(this->socket(), 2);
+    }
 
-  // write any result data
-  if (rc == 0) {
-    LinuxAttachListener::write_fully(this->socket(), (char*) st->base(), st->size());
-    ::shutdown(this->socket(), 2);
+    // done
+    ::close(this->socket());
   }
 
-  // done
-  ::close(this->socket());
-
   // were we externally suspended while we were waiting?
   thread->check_and_wait_while_suspended();
 
   delete this;
 }
 
+// Send output of a session request while the operation is still running.
+// Only called on the attach listener thread, never while the operation
+// holds VM locks or raw oops (see AttachListener::send_partial_output). As
+// in complete(), the thread is blocked while it writes, so a client that is
+// slow to read does not hold up safepoints.
+void LinuxAttachOperation::write_partial(const char* buf, size_t len) {
+  JavaThread* thread = JavaThread::current();
+  if (thread->thread_state() != _thread_in_vm) {
+    _session->write_data(_request_id, buf, len);
+    return;
+  }
+
+  ThreadBlockInVM tbivm(thread);
+
+  thread->set_suspend_equivalent();
+  // cleared by handle_special_suspend_equivalent_condition() or
+  // java_suspend_self() via check_and_wait_while_suspended()
+
+  _session->write_data(_request_id, buf, len);
+
+  // were we externally suspended while we were waiting?
+  thread->check_and_wait_while_suspended();
+}
 
 // AttachListener functions
 
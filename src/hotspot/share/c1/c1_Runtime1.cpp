@@ -705,7 +705,7 @@ JRT_ENTRY_NO_ASYNC(void, Runtime1::monitorenter(JavaThread* thread, oopDesc* obj
     Atomic::inc(BiasedLocking::slow_path_entry_count_addr());
   }
   Handle h_obj(thread, obj);
-  if (!UseFastLocking) {
+  if (!UseFastLocking || UseLockStack) {
     lock->set_obj(obj);
   }
   assert(obj == lock->obj(), "must match");
@@ -30,6 +30,7 @@
 #include "classfile/classLoaderData.inline.hpp"
 #include "classfile/defaultMethods.hpp"
 #include "classfile/dictionary.hpp"
+#include "classfile/fieldLayout.hpp"
 #include "classfile/javaClasses.inline.hpp"
 #include "classfile/moduleEntry.hpp"
 #include "classfile/packageEntry.hpp"
@@ -60,6 +61,7 @@
 #include "prims/jvmtiExport.hpp"
 #include "prims/jvmtiThreadState.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/fieldType.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/javaCalls.hpp"
 #include "runtime/os.hpp"
@@ -3981,29 +3983,78 @@ static unsigned int compute_oop_map_count(const InstanceKlass* super,
   return map_count;
 }
 
-#ifndef PRODUCT
+class PrintedField {
+ public:
+  int _offset;
+  int _size;
+  Symbol* _name;
+  Symbol* _signature;
+  bool _inherited;
+  PrintedField() : _offset(0), _size(0), _name(NULL), _signature(NULL), _inherited(false) {}
+  PrintedField(int offset, int size, Symbol* name, Symbol* signature, bool inherited) :
+    _offset(offset), _size(size), _name(name), _signature(signature), _inherited(inherited) {}
+};
+
+static int compare_field_offsets(PrintedField* a, PrintedField* b) {
+  return a->_offset - b->_offset;
+}
+
 static void print_field_layout(const Symbol* name,
                                Array<u2>* fields,
                                ConstantPool* cp,
+                               const InstanceKlass* super,
+                               bool compact,
                                int instance_size,
-                               int instance_fields_start,
                                int instance_fields_end,
                                int static_fields_end) {
 
   assert(name != NULL, "invariant");
+  ResourceMark rm;
 
-  tty->print("%s: field layout\n", name->as_klass_external_name());
-  tty->print("  @%3d %s\n", instance_fields_start, "--- instance fields start ---");
+  // instance fields in offset order, including the inherited ones, so
+  // that the gaps show
+  GrowableArray<PrintedField> instance_fields(16);
+  for (const InstanceKlass* k = super; k != NULL; k = k->superklass()) {
+    for (AllFieldStream fs(k->fields(), k->constants()); !fs.done(); fs.next()) {
+      if (!fs.access_flags().is_static()) {
+        instance_fields.append(PrintedField(fs.offset(), FieldLayout::field_size(fs.signature()),
+                                            fs.name(), fs.signature(), true));
+      }
+    }
+  }
   for (AllFieldStream fs(fields, cp); !fs.done(); fs.next()) {
     if (!fs.access_flags().is_static()) {
-      tty->print("  @%3d \"%s\" %s\n",
-        fs.offset(),
-        fs.name()->as_klass_external_name(),
-        fs.signature()->as_klass_external_name());
+      instance_fields.append(PrintedField(fs.offset(), FieldLayout::field_size(fs.signature()),
+                                          fs.name(), fs.signature(), false));
     }
   }
+  instance_fields.sort(compare_field_offsets);
+
+  tty->print("%s: field layout\n", name->as_klass_external_name());
+  tty->print("  @%3d %s\n", instanceOopDesc::base_offset_in_bytes(), "--- instance fields start ---");
+  int pos = instanceOopDesc::base_offset_in_bytes();
+  int gap_bytes = 0;
+  for (int i = 0; i < instance_fields.length(); i++) {
+    const PrintedField& f = instance_fields.at(i);
+    if (f._offset > pos) {
+      tty->print("  @%3d --- %d byte gap ---\n", pos, f._offset - pos);
+      gap_bytes += f._offset - pos;
+    }
+    tty->print("  @%3d \"%s\" %s%s\n",
+      f._offset,
+      f._name->as_klass_external_name(),
+      f._signature->as_klass_external_name(),
+      f._inherited ? " (inherited)" : "");
+    pos = MAX2(pos, f._offset + f._size);
+  }
+  if (instance_fields_end > pos) {
+    gap_bytes += instance_fields_end - pos;
+  }
   tty->print("  @%3d %s\n", instance_fields_end, "--- instance fields end ---");
   tty->print("  @%3d %s\n", instance_size * wordSize, "--- instance ends ---");
+  tty->print("  %d bytes in gaps and alignment, %s layout\n",
+             gap_bytes + (instance_size * wordSize - instance_fields_end),
+             compact ? "compact" : "classic");
   tty->print("  @%3d %s\n", InstanceMirrorKlass::offset_of_static_fields(), "--- static fields start ---");
   for (AllFieldStream fs(fields, cp); !fs.done(); fs.next()) {
     if (fs.access_flags().is_static()) {
@@ -4016,7 +4067,73 @@ static void print_field_layout(const Symbol* name,
   tty->print("  @%3d %s\n", static_fields_end, "--- static fields end ---");
   tty->print("\n");
 }
-#endif
+
+// Compact layout of the instance fields: the oops are placed as one block
+// behind the last inherited oop, so that they extend or follow the oop maps
+// of the superclass, then the primitive fields from the largest to the
+// smallest, each into the first gap that fits. Gaps are the holes between
+// the inherited fields and those left by alignment. Returns the end of the
+// instance fields.
+static int layout_nonstatic_fields_compact(Array<u2>* fields,
+                                           ConstantPool* cp,
+                                           const InstanceKlass* super,
+                                           int nonstatic_fields_start,
+                                           int* nonstatic_oop_offsets,
+                                           unsigned int* nonstatic_oop_counts,
+                                           unsigned int* nonstatic_oop_map_count,
+                                           int* first_nonstatic_oop_offset) {
+  FieldLayout layout(nonstatic_fields_start);
+  int min_oop_offset = 0;
+  if (super != NULL) {
+    layout.add_inherited_gaps(super);
+    const unsigned int super_map_count = super->nonstatic_oop_map_count();
+    if (super_map_count > 0) {
+      const OopMapBlock* last_map = super->start_of_nonstatic_oop_maps() + super_map_count - 1;
+      min_oop_offset = last_map->offset() + last_map->count() * heapOopSize;
+    }
+  }
+
+  unsigned int oop_count = 0;
+  for (AllFieldStream fs(fields, cp); !fs.done(); fs.next()) {
+    if (!fs.access_flags().is_static() &&
+        (FieldAllocationType) fs.allocation_type() == NONSTATIC_OOP) {
+      oop_count++;
+    }
+  }
+  if (oop_count > 0) {
+    int next_oop_offset = layout.allocate(oop_count * heapOopSize, heapOopSize, min_oop_offset);
+    nonstatic_oop_offsets[0] = next_oop_offset;
+    nonstatic_oop_counts[0] = oop_count;
+    *nonstatic_oop_map_count = 1;
+    *first_nonstatic_oop_offset = next_oop_offset;
+    for (AllFieldStream fs(fields, cp); !fs.done(); fs.next()) {
+      if (!fs.access_flags().is_static() &&
+          (FieldAllocationType) fs.allocation_type() == NONSTATIC_OOP) {
+        fs.set_offset(next_oop_offset);
+        next_oop_offset += heapOopSize;
+      }
+    }
+  }
+
+  static const FieldAllocationType primitive_types[] = {
+    NONSTATIC_DOUBLE, NONSTATIC_WORD, NONSTATIC_SHORT, NONSTATIC_BYTE
+  };
+  static const int primitive_sizes[] = {
+    BytesPerLong, BytesPerInt, BytesPerShort, 1
+  };
+  for (int t = 0; t < 4; t++) {
+    for (AllFieldStream fs(fields, cp); !fs.done(); fs.next()) {
+      // skip the oops and the fields placed by an earlier pass
+      if (fs.is_offset_set()) continue;
+
+      if (!fs.access_flags().is_static() &&
+          (FieldAllocationType) fs.allocation_type() == primitive_types[t]) {
+        fs.set_offset(layout.allocate(primitive_sizes[t], primitive_sizes[t]));
+      }
+    }
+  }
+  return layout.end();
+}
 
 // Values needed for oopmap and InstanceKlass creation
 class ClassFileParser::FieldLayoutInfo : public ResourceObj {
@@ -4149,6 +4266,21 @@ void ClassFileParser::layout_fields(ConstantPool* cp,
     compact_fields   = false; // Don't compact fields
   }
 
+  // Contended classes and fields keep the classic layout with its padding,
+  // all other instance fields are placed by the compact layout up front and
+  // skipped by the code below.
+  const bool use_compact_layout = UseCompactFieldLayout && compact_fields &&
+                                  !is_contended_class && nonstatic_contended_count == 0;
+  int compact_fields_end = nonstatic_fields_start;
+  if (use_compact_layout) {
+    compact_fields_end = layout_nonstatic_fields_compact(_fields, cp, _super_klass,
+                                                         nonstatic_fields_start,
+                                                         nonstatic_oop_offsets,
+                                                         nonstatic_oop_counts,
+                                                         &nonstatic_oop_map_count,
+                                                         &first_nonstatic_oop_offset);
+  }
+
   int next_nonstatic_oop_offset = 0;
   int next_nonstatic_double_offset = 0;
 
@@ -4465,7 +4597,8 @@ void ClassFileParser::layout_fields(ConstantPool* cp,
     next_nonstatic_padded_offset += ContendedPaddingWidth;
   }
 
-  int notaligned_nonstatic_fields_end = next_nonstatic_padded_offset;
+  int notaligned_nonstatic_fields_end = use_compact_layout ? compact_fields_end :
+                                                            next_nonstatic_padded_offset;
 
   int nonstatic_fields_end      = align_up(notaligned_nonstatic_fields_end, heapOopSize);
   int instance_end              = align_up(notaligned_nonstatic_fields_end, wordSize);
@@ -4495,18 +4628,17 @@ void ClassFileParser::layout_fields(ConstantPool* cp,
     compute_oop_map_count(_super_klass, nonstatic_oop_map_count,
                           first_nonstatic_oop_offset);
 
-#ifndef PRODUCT
   if (PrintFieldLayout) {
     print_field_layout(_class_name,
           _fields,
           cp,
+          _super_klass,
+          use_compact_layout,
           instance_size,
-          nonstatic_fields_start,
           nonstatic_fields_end,
           static_fields_end);
   }
 
-#endif
   // Pass back information needed for InstanceKlass creation
   info->nonstatic_oop_offsets = nonstatic_oop_offsets;
   info->nonstatic_oop_counts = nonstatic_oop_counts;
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2026 SAP SE. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "classfile/concurrentTableWorkers.hpp"
+#include "runtime/globals.hpp"
+
+WorkGang* ConcurrentTableWorkers::_workers = NULL;
+
+WorkGang* ConcurrentTableWorkers::workers_for(JavaThread* jt, size_t table_size) {
+  assert(jt->is_service_thread(), "only the ServiceThread uses the workers");
+  if (ConcurrentTableResizeThreads == 0 || table_size < MinParallelTableSize) {
+    return NULL;
+  }
+  if (_workers == NULL) {
+    // Created lazily; most applications never grow a table this large.
+    _workers = new WorkGang("Table Resize", ConcurrentTableResizeThreads,
+                            /* are_GC_task_threads */ false,
+                            /* are_ConcurrentGC_threads */ false);
+    _workers->initialize_workers();
+    _workers->update_active_workers(ConcurrentTableResizeThreads);
+  }
+  return _workers;
+}
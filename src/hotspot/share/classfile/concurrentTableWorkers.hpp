@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026 SAP SE. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_CLASSFILE_CONCURRENTTABLEWORKERS_HPP
+#define SHARE_CLASSFILE_CONCURRENTTABLEWORKERS_HPP
+
+#include "gc/shared/workgroup.hpp"
+#include "memory/allocation.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/thread.hpp"
+
+// Worker threads the ServiceThread uses to grow and clean large String and
+// Symbol tables in parallel, see ConcurrentTableResizeThreads.
+//
+// The workers only run while the ServiceThread waits for them in VM, so
+// a safepoint can not start while they touch the table (the entries are
+// read without safepoint checks). This delays a safepoint by up to one
+// range per worker. Every worker does at most one range per run, after
+// which the ServiceThread pauses the operation and blocks for a possible
+// safepoint, just as the serial loop does after every range. A grown
+// range costs a few write_synchronize() calls, see
+// ConcurrentHashTable::internal_grow_range_mt().
+//
+// Whether the workers win over the serial loop has not been measured, so
+// ConcurrentTableResizeThreads stays experimental and off by default.
+class ConcurrentTableWorkers : AllStatic {
+  static WorkGang* _workers;
+
+ public:
+  // Tables with fewer buckets are always processed by the ServiceThread
+  // alone; waking the workers costs more than they save.
+  static const size_t MinParallelTableSize = (size_t)1 << 16;
+
+  // Returns the workers to use for a table of table_size buckets, or NULL
+  // if the ServiceThread should do the work itself.
+  static WorkGang* workers_for(JavaThread* jt, size_t table_size);
+};
+
+// Runs one batch of a ConcurrentHashTable::GrowTask created with is_mt.
+template <typename GROW_TASK>
+class ConcurrentTableGrowGangTask : public AbstractGangTask {
+  GROW_TASK* _task;
+  volatile bool _done;
+
+ public:
+  ConcurrentTableGrowGangTask(GROW_TASK* task) :
+    AbstractGangTask("Concurrent Table Grow"), _task(task), _done(false) {}
+
+  // True once all ranges have been claimed.
+  bool is_done() const { return Atomic::load(&_done); }
+
+  void work(uint worker_id) {
+    if (!_task->do_task(Thread::current())) {
+      Atomic::store(&_done, true);
+    }
+  }
+};
+
+// Runs one batch of a ConcurrentHashTable::BulkDeleteTask created with
+// is_mt. Every worker uses its own functors, which are merged into the
+// given ones when the worker is done, so EVALUATE_FUNC and DELETE_FUNC
+// must be default constructible and have a merge() method.
+template <typename DELETE_TASK, typename EVALUATE_FUNC, typename DELETE_FUNC>
+class ConcurrentTableBulkDeleteGangTask : public AbstractGangTask {
+  DELETE_TASK*   _task;
+  EVALUATE_FUNC* _eval_f;
+  DELETE_FUNC*   _del_f;
+  volatile bool  _done;
+
+ public:
+  ConcurrentTableBulkDeleteGangTask(DELETE_TASK* task,
+                                    EVALUATE_FUNC* eval_f,
+                                    DELETE_FUNC* del_f) :
+    AbstractGangTask("Concurrent Table Bulk Delete"),
+    _task(task), _eval_f(eval_f), _del_f(del_f), _done(false) {}
+
+  // True once all ranges have been claimed.
+  bool is_done() const { return Atomic::load(&_done); }
+
+  void work(uint worker_id) {
+    EVALUATE_FUNC eval_f;
+    DELETE_FUNC del_f;
+    if (!_task->do_task(Thread::current(), eval_f, del_f)) {
+      Atomic::store(&_done, true);
+    }
+    _eval_f->merge(eval_f);
+    _del_f->merge(del_f);
+  }
+};
+
+#endif // SHARE_CLASSFILE_CONCURRENTTABLEWORKERS_HPP
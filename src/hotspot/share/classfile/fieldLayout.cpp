@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2026 SAP SE. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "classfile/fieldLayout.hpp"
+#include "oops/fieldStreams.inline.hpp"
+#include "oops/instanceKlass.hpp"
+#include "oops/instanceOop.hpp"
+#include "runtime/fieldType.hpp"
+#include "runtime/globals.hpp"
+#include "utilities/align.hpp"
+
+int FieldLayout::field_size(Symbol* signature) {
+  BasicType type = FieldType::basic_type(signature);
+  return is_reference_type(type) ? heapOopSize : type2aelembytes(type);
+}
+
+void FieldLayout::add_gap(int offset, int size) {
+  assert(size > 0, "empty gap");
+  assert(offset + size <= _end, "gap must be below the open space");
+  assert(_gaps.is_empty() || _gaps.top().end() <= offset, "gaps must be added in order");
+  _gaps.append(Gap(offset, size));
+}
+
+int FieldLayout::allocate(int size, int alignment, int min_offset) {
+  for (int i = 0; i < _gaps.length(); i++) {
+    const Gap gap = _gaps.at(i);
+    int start = align_up(MAX2(gap._offset, min_offset), alignment);
+    if (start + size <= gap.end()) {
+      // keep what is left on either side of the block
+      Gap before(gap._offset, start - gap._offset);
+      Gap after(start + size, gap.end() - (start + size));
+      if (before._size > 0 && after._size > 0) {
+        _gaps.at_put(i, before);
+        _gaps.insert_before(i + 1, after);
+      } else if (before._size > 0) {
+        _gaps.at_put(i, before);
+      } else if (after._size > 0) {
+        _gaps.at_put(i, after);
+      } else {
+        _gaps.remove_at(i);
+      }
+      return start;
+    }
+  }
+
+  // no gap fits, extend into the open space
+  int start = align_up(MAX2(_end, min_offset), alignment);
+  if (start > _end) {
+    _gaps.append(Gap(_end, start - _end));
+  }
+  _end = start + size;
+  return start;
+}
+
+int FieldLayout::gap_bytes() const {
+  int sum = 0;
+  for (int i = 0; i < _gaps.length(); i++) {
+    sum += _gaps.at(i)._size;
+  }
+  return sum;
+}
+
+static int compare_offsets(FieldLayout::Gap* a, FieldLayout::Gap* b) {
+  return a->_offset - b->_offset;
+}
+
+void FieldLayout::add_inherited_gaps(const InstanceKlass* ik) {
+  const int base = instanceOopDesc::base_offset_in_bytes();
+  assert(_gaps.is_empty(), "must be first");
+  assert(_end == base + ik->nonstatic_field_size() * heapOopSize, "open space must start at the end of the fields");
+
+  GrowableArray<Gap> fields(16);
+  for (const InstanceKlass* k = ik; k != NULL; k = k->superklass()) {
+    for (AllFieldStream fs(k->fields(), k->constants()); !fs.done(); fs.next()) {
+      if (!fs.access_flags().is_static()) {
+        fields.append(Gap(fs.offset(), field_size(fs.signature())));
+      }
+    }
+  }
+  fields.sort(compare_offsets);
+
+  int pos = base;
+  for (int i = 0; i <= fields.length(); i++) {
+    int next = i < fields.length() ? fields.at(i)._offset : _end;
+    int size = next - pos;
+    if (size > 0 && (ContendedPaddingWidth == 0 || size < ContendedPaddingWidth)) {
+      add_gap(pos, size);
+    }
+    if (i < fields.length()) {
+      pos = MAX2(pos, fields.at(i).end());
+    }
+  }
+}
+
+int FieldLayout::classic_fields_end(const InstanceKlass* ik) {
+  const int base = instanceOopDesc::base_offset_in_bytes();
+  const InstanceKlass* super = ik->superklass();
+  const int start = super == NULL ? base : classic_fields_end(super);
+  const int super_end = super == NULL ? base : base + super->nonstatic_field_size() * heapOopSize;
+  const int end = base + ik->nonstatic_field_size() * heapOopSize;
+
+  int doubles = 0, words = 0, shorts = 0, bytes = 0, oops = 0;
+  int field_bytes = 0;
+  for (AllFieldStream fs(ik->fields(), ik->constants()); !fs.done(); fs.next()) {
+    if (fs.access_flags().is_static()) continue;
+    BasicType type = FieldType::basic_type(fs.signature());
+    if (is_reference_type(type)) {
+      oops++;
+      field_bytes += heapOopSize;
+    } else {
+      switch (type2aelembytes(type)) {
+        case BytesPerLong:  doubles++; break;
+        case BytesPerInt:   words++;   break;
+        case BytesPerShort: shorts++;  break;
+        default:            bytes++;   break;
+      }
+      field_bytes += type2aelembytes(type);
+    }
+  }
+
+  // Contention padding is laid out the same way by both layouts, so
+  // padded classes just add their own size.
+  if (ContendedPaddingWidth > 0 && end - super_end > field_bytes + 2 * BytesPerLong) {
+    return start + (end - super_end);
+  }
+
+  // This follows ClassFileParser::layout_fields: longs/doubles, ints,
+  // shorts/chars, bytes and oops, where the first fields of the smaller
+  // types may go into the alignment gap before the longs.
+  int offset = start;
+  if (doubles > 0) {
+    int aligned = align_up(offset, BytesPerLong);
+    int length = aligned - offset;
+    if (length > 0) {
+      if (words > 0) {
+        words--;
+        length -= BytesPerInt;
+      }
+      while (length >= BytesPerShort && shorts > 0) {
+        shorts--;
+        length -= BytesPerShort;
+      }
+      while (length > 0 && bytes > 0) {
+        bytes--;
+        length -= 1;
+      }
+      if (length >= heapOopSize && oops > 0) {
+        oops--;
+      }
+    }
+    offset = aligned;
+  }
+  offset += doubles * BytesPerLong + words * BytesPerInt + shorts * BytesPerShort + bytes;
+  if (oops > 0) {
+    offset = align_up(offset, heapOopSize) + oops * heapOopSize;
+  }
+  return align_up(offset, heapOopSize);
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026 SAP SE. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_CLASSFILE_FIELDLAYOUT_HPP
+#define SHARE_CLASSFILE_FIELDLAYOUT_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/growableArray.hpp"
+
+class InstanceKlass;
+class Symbol;
+
+// The free space of an instance layout while the fields of a class are
+// placed. It consists of the gaps between the inherited fields, which are
+// registered up front, and the open space behind everything allocated so
+// far. Fields are placed first-fit at their natural alignment, so when the
+// caller allocates the largest fields first the smaller ones end up in the
+// holes left by alignment, both inherited and local.
+class FieldLayout : public StackObj {
+ public:
+  class Gap {
+   public:
+    int _offset;
+    int _size;
+    Gap() : _offset(0), _size(0) {}
+    Gap(int offset, int size) : _offset(offset), _size(size) {}
+    int end() const { return _offset + _size; }
+  };
+
+ private:
+  GrowableArray<Gap> _gaps;     // sorted by offset, all below _end
+  int _end;                     // start of the open space
+
+ public:
+  FieldLayout(int end) : _gaps(8), _end(end) {}
+
+  // Registers free space below the open space. Gaps must be added in
+  // increasing offset order.
+  void add_gap(int offset, int size);
+
+  // Returns the offset of a new block of the given size and alignment,
+  // which starts at min_offset or later.
+  int allocate(int size, int alignment, int min_offset = 0);
+
+  int end() const                       { return _end; }
+  int gap_count() const                 { return _gaps.length(); }
+  const Gap& gap_at(int i) const        { return _gaps.at(i); }
+  int gap_bytes() const;
+
+  // Registers the gaps between the instance fields of the given class and
+  // its superclasses. Gaps of ContendedPaddingWidth bytes or more are
+  // contention padding and stay empty. The open space starts at the end
+  // of the instance fields of the class.
+  void add_inherited_gaps(const InstanceKlass* ik);
+
+  // The size in bytes of an instance field with the given signature.
+  static int field_size(Symbol* signature);
+
+  // An estimate of the end offset of the instance fields of the given class
+  // as the classic layout, which does not fill inherited gaps, would place
+  // them. Used to report the effect of the compact layout in the heap
+  // inspection, so the savings shown are approximate: the estimate always
+  // assumes the default FieldsAllocationStyle and CompactFields, and it only
+  // guesses from the size of a class whether it has @Contended padding.
+  static int classic_fields_end(const InstanceKlass* ik);
+};
+
+#endif // SHARE_CLASSFILE_FIELDLAYOUT_HPP
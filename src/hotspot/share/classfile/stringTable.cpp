@@ -25,6 +25,7 @@
 #include "precompiled.hpp"
 #include "classfile/altHashing.hpp"
 #include "classfile/compactHashtable.hpp"
+#include "classfile/concurrentTableWorkers.hpp"
 #include "classfile/javaClasses.inline.hpp"
 #include "classfile/stringTable.hpp"
 #include "classfile/systemDictionary.hpp"
@@ -385,19 +386,35 @@ oop StringTable::do_intern(Handle string_or_null_h, const jchar* name,
 
 // Concurrent work
 void StringTable::grow(JavaThread* jt) {
-  StringTableHash::GrowTask gt(_local_table);
+  WorkGang* workers = ConcurrentTableWorkers::workers_for(jt, table_size());
+  StringTableHash::GrowTask gt(_local_table, workers != NULL);
   if (!gt.prepare(jt)) {
     return;
   }
   log_trace(stringtable)("Started to grow");
   {
     TraceTime timer("Grow", TRACETIME_LOG(Debug, stringtable, perf));
-    while (gt.do_task(jt)) {
-      gt.pause(jt);
-      {
-        ThreadBlockInVM tbivm(jt);
+    if (workers != NULL) {
+      ConcurrentTableGrowGangTask<StringTableHash::GrowTask> task(&gt);
+      while (true) {
+        workers->run_task(&task);
+        if (task.is_done()) {
+          break;
+        }
+        gt.pause(jt);
+        {
+          ThreadBlockInVM tbivm(jt);
+        }
+        gt.cont(jt);
+      }
+    } else {
+      while (gt.do_task(jt)) {
+        gt.pause(jt);
+        {
+          ThreadBlockInVM tbivm(jt);
+        }
+        gt.cont(jt);
       }
-      gt.cont(jt);
     }
   }
   gt.done(jt);
@@ -409,6 +426,7 @@ struct StringTableDoDelete : StackObj {
   void operator()(WeakHandle<vm_string_table_data>* val) {
     /* do nothing */
   }
+  void merge(const StringTableDoDelete& other) {}
 };
 
 struct StringTableDeleteCheck : StackObj {
@@ -425,10 +443,15 @@ struct StringTableDeleteCheck : StackObj {
       return false;
     }
   }
+  void merge(const StringTableDeleteCheck& other) {
+    Atomic::add(&_count, other._count);
+    Atomic::add(&_item, other._item);
+  }
 };
 
 void StringTable::clean_dead_entries(JavaThread* jt) {
-  StringTableHash::BulkDeleteTask bdt(_local_table);
+  WorkGang* workers = ConcurrentTableWorkers::workers_for(jt, table_size());
+  StringTableHash::BulkDeleteTask bdt(_local_table, workers != NULL);
   if (!bdt.prepare(jt)) {
     return;
   }
@@ -437,12 +460,29 @@ void StringTable::clean_dead_entries(JavaThread* jt) {
   StringTableDoDelete stdd;
   {
     TraceTime timer("Clean", TRACETIME_LOG(Debug, stringtable, perf));
-    while(bdt.do_task(jt, stdc, stdd)) {
-      bdt.pause(jt);
-      {
-        ThreadBlockInVM tbivm(jt);
+    if (workers != NULL) {
+      ConcurrentTableBulkDeleteGangTask<StringTableHash::BulkDeleteTask,
+                                        StringTableDeleteCheck,
+                                        StringTableDoDelete> task(&bdt, &stdc, &stdd);
+      while (true) {
+        workers->run_task(&task);
+        if (task.is_done()) {
+          break;
+        }
+        bdt.pause(jt);
+        {
+          ThreadBlockInVM tbivm(jt);
+        }
+        bdt.cont(jt);
+      }
+    } else {
+      while(bdt.do_task(jt, stdc, stdd)) {
+        bdt.pause(jt);
+        {
+          ThreadBlockInVM tbivm(jt);
+        }
+        bdt.cont(jt);
       }
-      bdt.cont(jt);
     }
     bdt.done(jt);
   }
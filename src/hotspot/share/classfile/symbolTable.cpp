@@ -25,6 +25,7 @@
 #include "precompiled.hpp"
 #include "classfile/altHashing.hpp"
 #include "classfile/compactHashtable.hpp"
+#include "classfile/concurrentTableWorkers.hpp"
 #include "classfile/javaClasses.hpp"
 #include "classfile/symbolTable.hpp"
 #include "memory/allocation.inline.hpp"
@@ -659,19 +660,35 @@ void SymbolTable::serialize_shared_table_header(SerializeClosure* soc,
 
 // Concurrent work
 void SymbolTable::grow(JavaThread* jt) {
-  SymbolTableHash::GrowTask gt(_local_table);
+  WorkGang* workers = ConcurrentTableWorkers::workers_for(jt, table_size());
+  SymbolTableHash::GrowTask gt(_local_table, workers != NULL);
   if (!gt.prepare(jt)) {
     return;
   }
   log_trace(symboltable)("Started to grow");
   {
     TraceTime timer("Grow", TRACETIME_LOG(Debug, symboltable, perf));
-    while (gt.do_task(jt)) {
-      gt.pause(jt);
-      {
-        ThreadBlockInVM tbivm(jt);
+    if (workers != NULL) {
+      ConcurrentTableGrowGangTask<SymbolTableHash::GrowTask> task(&gt);
+      while (true) {
+        workers->run_task(&task);
+        if (task.is_done()) {
+          break;
+        }
+        gt.pause(jt);
+        {
+          ThreadBlockInVM tbivm(jt);
+        }
+        gt.cont(jt);
+      }
+    } else {
+      while (gt.do_task(jt)) {
+        gt.pause(jt);
+        {
+          ThreadBlockInVM tbivm(jt);
+        }
+        gt.cont(jt);
       }
-      gt.cont(jt);
     }
   }
   gt.done(jt);
@@ -689,6 +706,9 @@ struct SymbolTableDoDelete : StackObj {
     assert(sym->refcount() == 0, "refcount");
     _deleted++;
   }
+  void merge(const SymbolTableDoDelete& other) {
+    Atomic::add(&_deleted, other._deleted);
+  }
 };
 
 struct SymbolTableDeleteCheck : StackObj {
@@ -701,10 +721,14 @@ struct SymbolTableDeleteCheck : StackObj {
     Symbol *sym = *value;
     return (sym->refcount() == 0);
   }
+  void merge(const SymbolTableDeleteCheck& other) {
+    Atomic::add(&_processed, other._processed);
+  }
 };
 
 void SymbolTable::clean_dead_entries(JavaThread* jt) {
-  SymbolTableHash::BulkDeleteTask bdt(_local_table);
+  WorkGang* workers = ConcurrentTableWorkers::workers_for(jt, table_size());
+  SymbolTableHash::BulkDeleteTask bdt(_local_table, workers != NULL);
   if (!bdt.prepare(jt)) {
     return;
   }
@@ -713,12 +737,29 @@ void SymbolTable::clean_dead_entries(JavaThread* jt) {
   SymbolTableDoDelete stdd;
   {
     TraceTime timer("Clean", TRACETIME_LOG(Debug, symboltable, perf));
-    while (bdt.do_task(jt, stdc, stdd)) {
-      bdt.pause(jt);
-      {
-        ThreadBlockInVM tbivm(jt);
+    if (workers != NULL) {
+      ConcurrentTableBulkDeleteGangTask<SymbolTableHash::BulkDeleteTask,
+                                        SymbolTableDeleteCheck,
+                                        SymbolTableDoDelete> task(&bdt, &stdc, &stdd);
+      while (true) {
+        workers->run_task(&task);
+        if (task.is_done()) {
+          break;
+        }
+        bdt.pause(jt);
+        {
+          ThreadBlockInVM tbivm(jt);
+        }
+        bdt.cont(jt);
+      }
+    } else {
+      while (bdt.do_task(jt, stdc, stdd)) {
+        bdt.pause(jt);
+        {
+          ThreadBlockInVM tbivm(jt);
+        }
+        bdt.cont(jt);
       }
-      bdt.cont(jt);
     }
     reset_has_items_to_clean();
     bdt.done(jt);
@@ -155,16 +155,17 @@ RuntimeBlob::RuntimeBlob(
 }
 
 void CodeBlob::flush() {
-  FREE_C_HEAP_ARRAY(unsigned char, _oop_maps);
+  ImmutableOopMapSet::release_shared(_oop_maps);
   _oop_maps = NULL;
   _strings.free();
 }
 
 void CodeBlob::set_oop_maps(OopMapSet* p) {
   // Danger Will Robinson! This method allocates a big
-  // chunk of memory, its your job to free it.
+  // chunk of memory, its your job to free it (see flush()).
+  // Identical sets are shared between blobs.
   if (p != NULL) {
-    _oop_maps = ImmutableOopMapSet::build_from(p);
+    _oop_maps = ImmutableOopMapSet::build_shared_from(p);
   } else {
     _oop_maps = NULL;
   }
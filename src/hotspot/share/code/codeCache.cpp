@@ -35,6 +35,7 @@
 #include "code/pcDesc.hpp"
 #include "compiler/compilationPolicy.hpp"
 #include "compiler/compileBroker.hpp"
+#include "compiler/oopMap.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
@@ -1003,9 +1004,20 @@ int CodeCache::mark_for_deoptimization(KlassDepChange& changes) {
   // nmethod::check_all_dependencies works only correctly, if no safepoint
   // can happen
   NoSafepointVerifier nsv;
+  elapsedTimer timer;
+  timer.start();
+  int number_of_contexts = 0;
   for (DepChange::ContextStream str(changes, nsv); str.next(); ) {
     Klass* d = str.klass();
     number_of_marked_CodeBlobs += InstanceKlass::cast(d)->mark_dependent_nmethods(changes);
+    number_of_contexts++;
+  }
+  timer.stop();
+  if (log_is_enabled(Debug, dependencies)) {
+    ResourceMark rm;
+    log_debug(dependencies)("Checked dependencies on %s: %d contexts, %d distinct dependencies, %d nmethods marked, %.3f ms",
+                            changes.new_type()->external_name(), number_of_contexts, changes.checked_count(),
+                            number_of_marked_CodeBlobs, timer.seconds() * 1000.0);
   }
 
 #ifndef PRODUCT
@@ -1527,6 +1539,7 @@ void CodeCache::print_summary(outputStream* st, bool detailed) {
                  CompileBroker::get_total_compiler_stopped_count(),
                  CompileBroker::get_total_compiler_restarted_count());
     st->print_cr(" full_count=%d", full_count);
+    ImmutableOopMapSet::print_sharing_statistics(st);
   }
 }
 
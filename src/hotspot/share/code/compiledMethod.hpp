@@ -42,23 +42,30 @@ class MetadataClosure;
 
 // This class is used internally by nmethods, to cache
 // exception/pc/handler information.
+//
+// The pcs of an entry are kept in a small open addressed hash table, so
+// that a lookup usually probes a single slot. Entries are added under
+// the ExceptionCache_lock and a slot is published by storing its pc last,
+// so readers do not need to lock.
 
 class ExceptionCache : public CHeapObj<mtCode> {
   friend class VMStructs;
  private:
-  enum { cache_size = 16 };
+  enum { cache_size = 16, table_size = 2 * cache_size };
   Klass*   _exception_type;
-  address  _pc[cache_size];
-  address  _handler[cache_size];
+  address  _pc[table_size];       // NULL for free slots
+  address  _handler[table_size];
   volatile int _count;
   ExceptionCache* volatile _next;
   ExceptionCache* _purge_list_next;
 
-  inline address pc_at(int index);
-  void set_pc_at(int index, address a)      { assert(index >= 0 && index < cache_size,""); _pc[index] = a; }
+  static int index_for(address pc) {
+    uintptr_t bits = (uintptr_t)pc;
+    return (int)((bits ^ (bits >> 5)) & (table_size - 1));
+  }
 
+  inline address pc_at(int index);
   inline address handler_at(int index);
-  void set_handler_at(int index, address a) { assert(index >= 0 && index < cache_size,""); _handler[index] = a; }
 
   inline int count();
   // increment_count is only called under lock, but there may be concurrent readers.
@@ -86,19 +93,25 @@ class nmethod;
 class PcDescCache {
   friend class VMStructs;
  private:
-  enum { cache_size = 4 };
+  // Direct mapped by the pc offset of the query, so that a lookup and an
+  // update each touch a single element.
+  enum { cache_size = 8 };
   // The array elements MUST be volatile! Several threads may modify
   // and read from the cache concurrently. find_pc_desc_internal has
   // returned wrong results. C++ compiler (namely xlC12) may duplicate
   // C++ field accesses if the elements are not volatile.
   typedef PcDesc* PcDescPtr;
-  volatile PcDescPtr _pc_descs[cache_size]; // last cache_size pc_descs found
+  volatile PcDescPtr _last_pc_desc;             // most recently found pc desc
+  volatile PcDescPtr _pc_descs[cache_size];     // pc descs found, by query
+  static int index_for(int pc_offset) {
+    return (pc_offset ^ (pc_offset >> 3) ^ (pc_offset >> 6)) & (cache_size - 1);
+  }
  public:
-  PcDescCache() { debug_only(_pc_descs[0] = NULL); }
+  PcDescCache() { debug_only(_last_pc_desc = NULL); }
   void    reset_to(PcDesc* initial_pc_desc);
   PcDesc* find_pc_desc(int pc_offset, bool approximate);
-  void    add_pc_desc(PcDesc* pc_desc);
-  PcDesc* last_pc_desc() { return _pc_descs[0]; }
+  void    add_pc_desc(int pc_offset, PcDesc* pc_desc);
+  PcDesc* last_pc_desc() { return _last_pc_desc; }
 };
 
 class PcDescSearch {
@@ -63,13 +63,14 @@ inline address CompiledMethod::get_deopt_original_pc(const frame* fr) {
 
 inline int ExceptionCache::count() { return Atomic::load_acquire(&_count); }
 
+// A slot is published by storing its pc after its handler.
 address ExceptionCache::pc_at(int index) {
-  assert(index >= 0 && index < count(),"");
-  return _pc[index];
+  assert(index >= 0 && index < table_size,"");
+  return Atomic::load_acquire(&_pc[index]);
 }
 
 address ExceptionCache::handler_at(int index) {
-  assert(index >= 0 && index < count(),"");
+  assert(index >= 0 && index < table_size,"");
   return _handler[index];
 }
 
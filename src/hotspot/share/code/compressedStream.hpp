@@ -87,18 +87,23 @@ class CompressedReadStream : public CompressedStream {
     int     pos = position() - 1;
     u_char* buf = buffer() + pos;
     assert(buf[0] == b0 && b0 >= L, "correctly called");
-    jint    sum = b0;
-    // must collect more bytes:  b[1]...b[4]
-    int lg_H_i = lg_H;
-    for (int i = 0; ; ) {
-      jint b_i = buf[++i]; // b_i = read(); ++i;
-      sum += b_i << lg_H_i;  // sum += b[i]*(64**i)
-      if (b_i < L || i == MAX_i) {
-        set_position(pos+i+1);
-        return sum;
-      }
-      lg_H_i += lg_H;
-    }
+    STATIC_ASSERT(MAX_i == 4);
+    // must collect more bytes:  b[1]...b[4], sum += b[i]*(64**i)
+    // Unrolled, so that each step is a load, a shift-add and one
+    // well-predicted compare; most values end after b[1] or b[2].
+    jint b_i = buf[1];
+    jint sum = b0 + (b_i << lg_H);
+    if (b_i < L) { set_position(pos+2); return sum; }
+    b_i = buf[2];
+    sum += b_i << (2*lg_H);
+    if (b_i < L) { set_position(pos+3); return sum; }
+    b_i = buf[3];
+    sum += b_i << (3*lg_H);
+    if (b_i < L) { set_position(pos+4); return sum; }
+    b_i = buf[4];
+    sum += b_i << (4*lg_H);
+    set_position(pos+5);
+    return sum;
   }
 
  public:
@@ -1011,6 +1011,14 @@ Klass* Dependencies::DepStream::context_type() {
 }
 
 // ----------------- DependencySignature --------------------------------------
+unsigned DependencySignature::hash(DependencySignature const& s1) {
+  unsigned hash = (unsigned)s1.type();
+  for (int i = 0; i < s1.args_count(); i++) {
+    hash = 31 * hash + (unsigned)(s1.arg(i) >> 3);
+  }
+  return hash;
+}
+
 bool DependencySignature::equals(DependencySignature const& s1, DependencySignature const& s2) {
   if ((s1.type() != s2.type()) || (s1.args_count() != s2.args_count())) {
     return false;
@@ -1836,43 +1844,52 @@ void Dependencies::DepStream::trace_and_log_witness(Klass* witness) {
 }
 
 
-Klass* Dependencies::DepStream::check_klass_dependency(KlassDepChange* changes) {
+Klass* Dependencies::check_klass_dependency(DepType dept, Metadata* const* args, KlassDepChange* changes) {
   assert_locked_or_safepoint(Compile_lock);
-  Dependencies::check_valid_dependency_type(type());
+  Dependencies::check_valid_dependency_type(dept);
 
   Klass* witness = NULL;
-  switch (type()) {
+  switch (dept) {
   case evol_method:
-    witness = check_evol_method(method_argument(0));
+    witness = check_evol_method((Method*)args[0]);
     break;
   case leaf_type:
-    witness = check_leaf_type(context_type());
+    witness = check_leaf_type((Klass*)args[0]);
     break;
   case abstract_with_unique_concrete_subtype:
-    witness = check_abstract_with_unique_concrete_subtype(context_type(), type_argument(1), changes);
+    witness = check_abstract_with_unique_concrete_subtype((Klass*)args[0], (Klass*)args[1], changes);
     break;
   case abstract_with_no_concrete_subtype:
-    witness = check_abstract_with_no_concrete_subtype(context_type(), changes);
+    witness = check_abstract_with_no_concrete_subtype((Klass*)args[0], changes);
     break;
   case concrete_with_no_concrete_subtype:
-    witness = check_concrete_with_no_concrete_subtype(context_type(), changes);
+    witness = check_concrete_with_no_concrete_subtype((Klass*)args[0], changes);
     break;
   case unique_concrete_method:
-    witness = check_unique_concrete_method(context_type(), method_argument(1), changes);
+    witness = check_unique_concrete_method((Klass*)args[0], (Method*)args[1], changes);
     break;
   case abstract_with_exclusive_concrete_subtypes_2:
-    witness = check_abstract_with_exclusive_concrete_subtypes(context_type(), type_argument(1), type_argument(2), changes);
+    witness = check_abstract_with_exclusive_concrete_subtypes((Klass*)args[0], (Klass*)args[1], (Klass*)args[2], changes);
     break;
   case exclusive_concrete_methods_2:
-    witness = check_exclusive_concrete_methods(context_type(), method_argument(1), method_argument(2), changes);
+    witness = check_exclusive_concrete_methods((Klass*)args[0], (Method*)args[1], (Method*)args[2], changes);
     break;
   case no_finalizable_subclasses:
-    witness = check_has_no_finalizable_subclasses(context_type(), changes);
+    witness = check_has_no_finalizable_subclasses((Klass*)args[0], changes);
     break;
   default:
     witness = NULL;
     break;
   }
+  return witness;
+}
+
+Klass* Dependencies::DepStream::check_klass_dependency(KlassDepChange* changes) {
+  Metadata* args[max_arg_count];
+  for (int i = 0; i < argument_count(); i++) {
+    args[i] = argument(i);
+  }
+  Klass* witness = Dependencies::check_klass_dependency(type(), args, changes);
   trace_and_log_witness(witness);
   return witness;
 }
@@ -2006,6 +2023,25 @@ KlassDepChange::~KlassDepChange() {
     Klass* d = str.klass();
     InstanceKlass::cast(d)->set_is_marked_dependent(false);
   }
+  delete _witnesses;
+}
+
+Klass* KlassDepChange::check_dependency(Dependencies::DepType dept, Klass* ctxk, Metadata* x, Metadata* y) {
+  assert(involves_context(ctxk), "only dependencies on changed contexts");
+  Metadata* args[Dependencies::max_arg_count] = { ctxk, x, y };
+  DependencySignature sig(dept, args);
+  if (_witnesses == NULL) {
+    _witnesses = new (ResourceObj::C_HEAP, mtCode) WitnessTable();
+  } else {
+    Klass** witness = _witnesses->get(sig);
+    if (witness != NULL) {
+      return *witness;
+    }
+  }
+  Klass* witness = Dependencies::check_klass_dependency(dept, args, this);
+  _witnesses->put(sig, witness);
+  _checked_count++;
+  return witness;
 }
 
 bool KlassDepChange::involves_context(Klass* k) {
@@ -36,6 +36,7 @@
 #include "runtime/safepointVerifiers.hpp"
 #include "utilities/growableArray.hpp"
 #include "utilities/hashtable.hpp"
+#include "utilities/resourceHash.hpp"
 
 //** Dependencies represent assertions (approximate invariants) within
 // the runtime system, e.g. class hierarchy changes.  An example is an
@@ -440,6 +441,10 @@ class Dependencies: public ResourceObj {
                                                    KlassDepChange* changes = NULL);
   static Klass* check_has_no_finalizable_subclasses(Klass* ctxk, KlassDepChange* changes = NULL);
   static Klass* check_call_site_target_value(oop call_site, oop method_handle, CallSiteDepChange* changes = NULL);
+
+  // Checks a klass dependency given its type and decoded arguments,
+  // the context type first.
+  static Klass* check_klass_dependency(DepType dept, Metadata* const* args, KlassDepChange* changes = NULL);
   // A returned Klass* is NULL if the dependency assertion is still
   // valid.  A non-NULL Klass* is a 'witness' to the assertion
   // failure, a point in the class hierarchy where the assertion has
@@ -668,8 +673,16 @@ class DependencySignature : public ResourceObj {
     }
   }
 
+  DependencySignature(Dependencies::DepType dept, Metadata* const* args) {
+    _args_count = Dependencies::dep_args(dept);
+    _type = dept;
+    for (int i = 0; i < _args_count; i++) {
+      _argument_hash[i] = (uintptr_t)args[i];
+    }
+  }
+
   static bool     equals(DependencySignature const& s1, DependencySignature const& s2);
-  static unsigned hash  (DependencySignature const& s1) { return s1.arg(0) >> 2; }
+  static unsigned hash  (DependencySignature const& s1);
 
   int args_count()             const { return _args_count; }
   uintptr_t arg(int idx)       const { return _argument_hash[idx]; }
@@ -760,12 +773,19 @@ class KlassDepChange : public DepChange {
   // each change set is rooted in exactly one new type (at present):
   Klass* _new_type;
 
+  // witnesses of the dependencies checked so far against this change
+  typedef ResourceHashtable<DependencySignature, Klass*, &DependencySignature::hash,
+                            &DependencySignature::equals, 1009,
+                            ResourceObj::C_HEAP, mtCode> WitnessTable;
+  WitnessTable* _witnesses;
+  int           _checked_count;
+
   void initialize();
 
  public:
   // notes the new type, marks it and all its super-types
   KlassDepChange(Klass* new_type)
-    : _new_type(new_type)
+    : _new_type(new_type), _witnesses(NULL), _checked_count(0)
   {
     initialize();
   }
@@ -784,6 +804,14 @@ class KlassDepChange : public DepChange {
 
   // involves_context(k) is true if k is new_type or any of the super types
   bool involves_context(Klass* k);
+
+  // Checks a klass dependency with context type ctxk, as recorded in the
+  // dependency context of ctxk. Each distinct dependency is only checked
+  // once, later calls return the witness found by the first one.
+  Klass* check_dependency(Dependencies::DepType dept, Klass* ctxk, Metadata* x, Metadata* y);
+
+  // number of distinct dependencies checked by check_dependency
+  int checked_count() const { return _checked_count; }
 };
 
 
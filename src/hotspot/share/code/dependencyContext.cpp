@@ -58,18 +58,41 @@ void DependencyContext::init() {
   }
 }
 
+//
+// Use the dependencies recorded in the bucket to find out whether the
+// change can affect the nmethod, without decoding all of its dependencies.
+// Each distinct dependency is only checked once per change.
+// The recorded dependencies are only stable under the CodeCache_lock, which
+// CodeCache::mark_for_deoptimization takes inside the Compile_lock.
+//
+static bool may_depend_on(nmethodBucket* b, DepChange& changes, Klass* context) {
+  assert_locked_or_safepoint(CodeCache_lock);
+  if (context == NULL || !changes.is_klass_change() || !b->has_all_dependencies()) {
+    return true;
+  }
+  KlassDepChange* klass_change = changes.as_klass_change();
+  for (int i = 0; i < b->dependencies_length(); i++) {
+    const DependencyRecord* dep = b->dependency_at(i);
+    if (klass_change->check_dependency((Dependencies::DepType)dep->_type, context, dep->_x, dep->_y) != NULL) {
+      return true;
+    }
+  }
+  return false;
+}
+
 //
 // Walk the list of dependent nmethods searching for nmethods which
 // are dependent on the changes that were passed in and mark them for
 // deoptimization.  Returns the number of nmethods found.
 //
-int DependencyContext::mark_dependent_nmethods(DepChange& changes) {
+int DependencyContext::mark_dependent_nmethods(DepChange& changes, Klass* context) {
   int found = 0;
   for (nmethodBucket* b = dependencies_not_unloading(); b != NULL; b = b->next_not_unloading()) {
     nmethod* nm = b->get_nmethod();
     // since dependencies aren't removed until an nmethod becomes a zombie,
     // the dependency list may contain nmethods which aren't alive.
-    if (b->count() > 0 && nm->is_alive() && !nm->is_marked_for_deoptimization() && nm->check_dependency_on(changes)) {
+    if (b->count() > 0 && nm->is_alive() && !nm->is_marked_for_deoptimization() &&
+        may_depend_on(b, changes, context) && nm->check_dependency_on(changes)) {
       if (TraceDependencies) {
         ResourceMark rm;
         tty->print_cr("Marked for deoptimization");
@@ -90,15 +113,17 @@ int DependencyContext::mark_dependent_nmethods(DepChange& changes) {
 // so a count is kept for each bucket to guarantee that creation and
 // deletion of dependencies is consistent.
 //
-void DependencyContext::add_dependent_nmethod(nmethod* nm) {
+void DependencyContext::add_dependent_nmethod(nmethod* nm, const DependencyRecord* dep) {
   assert_lock_strong(CodeCache_lock);
   for (nmethodBucket* b = dependencies_not_unloading(); b != NULL; b = b->next_not_unloading()) {
     if (nm == b->get_nmethod()) {
       b->increment();
+      b->add_dependency(dep);
       return;
     }
   }
   nmethodBucket* new_head = new nmethodBucket(nm, NULL);
+  new_head->add_dependency(dep);
   for (;;) {
     nmethodBucket* head = Atomic::load(_dependency_context_addr);
     new_head->set_next(head);
@@ -260,6 +285,33 @@ bool DependencyContext::is_dependent_nmethod(nmethod* nm) {
 
 #endif //PRODUCT
 
+nmethodBucket::~nmethodBucket() {
+  FREE_C_HEAP_ARRAY(DependencyRecord, _deps);
+}
+
+// The recorded dependencies are only read by may_depend_on(), which asserts
+// that the CodeCache_lock is held, so they can be reallocated in place. Both
+// the writers (nmethod::new_nmethod) and the reader are also serialized by
+// the Compile_lock, but that lock is not needed here.
+void nmethodBucket::add_dependency(const DependencyRecord* dep) {
+  assert_lock_strong(CodeCache_lock);
+  if (!_deps_complete) {
+    return;
+  }
+  if (dep == NULL) {
+    _deps_complete = false;
+    FREE_C_HEAP_ARRAY(DependencyRecord, _deps);
+    _deps = NULL;
+    _deps_length = _deps_capacity = 0;
+    return;
+  }
+  if (_deps_length == _deps_capacity) {
+    _deps_capacity = MAX2(2, _deps_capacity * 2);
+    _deps = REALLOC_C_HEAP_ARRAY(DependencyRecord, _deps, _deps_capacity, mtClass);
+  }
+  _deps[_deps_length++] = *dep;
+}
+
 int nmethodBucket::decrement() {
   return Atomic::sub(&_count, 1);
 }
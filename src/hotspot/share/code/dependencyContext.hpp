@@ -33,16 +33,31 @@
 
 class nmethod;
 class DepChange;
+class Klass;
+class Metadata;
+
+//
+// A klass dependency as recorded in the dependency context of its
+// context type: the dependency type and the arguments that follow
+// the context type (see Dependencies::DepType).
+//
+class DependencyRecord {
+ public:
+  int       _type;
+  Metadata* _x;
+  Metadata* _y;
+};
 
 //
 // nmethodBucket is used to record dependent nmethods for
 // deoptimization.  nmethod dependencies are actually <klass, method>
-// pairs but we really only care about the klass part for purposes of
-// finding nmethods which might need to be deoptimized.  Instead of
-// recording the method, a count of how many times a particular nmethod
+// pairs.  The klass part is used for finding nmethods which might need
+// to be deoptimized, and a count of how many times a particular nmethod
 // was recorded is kept.  This ensures that any recording errors are
 // noticed since an nmethod should be removed as many times are it's
-// added.
+// added.  For klass contexts the dependencies themselves are recorded
+// as well, so that a class hierarchy change only has to check those
+// instead of decoding all dependencies of every dependent nmethod.
 //
 class nmethodBucket: public CHeapObj<mtClass> {
   friend class VMStructs;
@@ -51,10 +66,16 @@ class nmethodBucket: public CHeapObj<mtClass> {
   volatile int   _count;
   nmethodBucket* volatile _next;
   nmethodBucket* volatile _purge_list_next;
+  DependencyRecord* _deps;
+  int            _deps_length;
+  int            _deps_capacity;
+  bool           _deps_complete;  // false if an addition came without its dependency
 
  public:
   nmethodBucket(nmethod* nmethod, nmethodBucket* next) :
-    _nmethod(nmethod), _count(1), _next(next), _purge_list_next(NULL) {}
+    _nmethod(nmethod), _count(1), _next(next), _purge_list_next(NULL),
+    _deps(NULL), _deps_length(0), _deps_capacity(0), _deps_complete(true) {}
+  ~nmethodBucket();
 
   int count()                                { return _count; }
   int increment()                            { _count += 1; return _count; }
@@ -65,6 +86,14 @@ class nmethodBucket: public CHeapObj<mtClass> {
   nmethodBucket* purge_list_next();
   void set_purge_list_next(nmethodBucket* b);
   nmethod* get_nmethod()                     { return _nmethod; }
+
+  void add_dependency(const DependencyRecord* dep);
+  bool has_all_dependencies()                { return _deps_complete; }
+  int  dependencies_length()                 { return _deps_length; }
+  const DependencyRecord* dependency_at(int i) {
+    assert(i >= 0 && i < _deps_length, "index out of bounds");
+    return &_deps[i];
+  }
 };
 
 //
@@ -117,8 +146,8 @@ class DependencyContext : public StackObj {
 
   static void init();
 
-  int  mark_dependent_nmethods(DepChange& changes);
-  void add_dependent_nmethod(nmethod* nm);
+  int  mark_dependent_nmethods(DepChange& changes, Klass* context = NULL);
+  void add_dependent_nmethod(nmethod* nm, const DependencyRecord* dep = NULL);
   void remove_dependent_nmethod(nmethod* nm);
   int  remove_all_dependents();
   void clean_unloading_dependents();
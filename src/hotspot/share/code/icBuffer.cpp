@@ -34,10 +34,14 @@
 #include "memory/resourceArea.hpp"
 #include "oops/method.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/handles.inline.hpp"
+#include "runtime/handshake.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/safepointVerifiers.hpp"
 #include "runtime/stubRoutines.hpp"
 #include "runtime/thread.inline.hpp"
+#include "utilities/growableArray.hpp"
 
 DEF_STUB_INTERFACE(ICStub);
 
@@ -45,6 +49,8 @@ StubQueue* InlineCacheBuffer::_buffer    = NULL;
 
 CompiledICHolder* InlineCacheBuffer::_pending_released = NULL;
 int InlineCacheBuffer::_pending_count = 0;
+int InlineCacheBuffer::_releasing_count = 0;
+volatile uint64_t InlineCacheBuffer::_refill_epoch = 0;
 
 #ifdef ASSERT
 ICRefillVerifier::ICRefillVerifier()
@@ -139,12 +145,15 @@ void ICStub::print() {
 
 void InlineCacheBuffer::initialize() {
   if (_buffer != NULL) return; // already initialized
-  _buffer = new StubQueue(new ICStubInterface, 10*K, InlineCacheBuffer_lock, "InlineCacheBuffer");
+  // No queue lock: InlineCacheBuffer takes InlineCacheBuffer_lock itself,
+  // so that a stub is allocated and set up in one critical section.
+  _buffer = new StubQueue(new ICStubInterface, 10*K, NULL, "InlineCacheBuffer");
   assert (_buffer != NULL, "cannot allocate InlineCacheBuffer");
 }
 
 
 ICStub* InlineCacheBuffer::new_ic_stub() {
+  assert_lock_strong(InlineCacheBuffer_lock);
   return (ICStub*)buffer()->request_committed(ic_stub_code_size());
 }
 
@@ -154,6 +163,12 @@ void InlineCacheBuffer::refill_ic_stubs() {
   ICRefillVerifier* verifier = current_ic_refill_verifier();
   verifier->request_remembered();
 #endif
+  Thread* thread = Thread::current();
+  if (can_refill_with_handshakes(thread)) {
+    refill_with_handshakes((JavaThread*)thread);
+    return;
+  }
+
   // we ran out of inline cache buffer space; must enter safepoint.
   // We do this by forcing a safepoint
   EXCEPTION_MARK;
@@ -169,12 +184,144 @@ void InlineCacheBuffer::refill_ic_stubs() {
   }
 }
 
+// The handshake refill relies on the refilling thread not reaching a
+// safepoint while it patches inline caches, which only holds for Java
+// threads in the VM. GC workers refilling during concurrent class
+// unloading still go through VM_ICBufferFull.
+bool InlineCacheBuffer::can_refill_with_handshakes(Thread* thread) {
+  return SafepointMechanism::uses_thread_local_poll() &&
+         thread->is_Java_thread() &&
+         ((JavaThread*)thread)->thread_state() == _thread_in_vm;
+}
+
+class ICBufferRendezvousClosure : public HandshakeClosure {
+ public:
+  ICBufferRendezvousClosure() : HandshakeClosure("ICBufferRendezvous") {}
+  void do_thread(Thread* thread) {}
+};
+
+// Copies the values (first pass) or the destinations (second pass) of
+// the given transition stubs into their inline caches. Stubs that have
+// been cleared by a later transition of the same inline cache are skipped.
+void InlineCacheBuffer::install_stubs(GrowableArray<ICStub*>* stubs, bool install_destination) {
+  for (int i = 0; i < stubs->length(); i++) {
+    ICStub* stub = stubs->at(i);
+    address site = stub->ic_site();
+    if (site == NULL) {
+      continue;
+    }
+    CodeBlob* cb = CodeCache::find_blob_unsafe(site);
+    assert(cb != NULL && cb->is_compiled(), "inline cache in non-compiled?");
+    CompiledMethod* cm = cb->as_compiled_method();
+    CompiledICLocker ml(cm);
+    // Zombie nmethods clear their stubs under the same lock
+    if (stub->ic_site() != site) {
+      continue;
+    }
+    CompiledIC* ic = CompiledIC_at(cm, site);
+    assert(ic->is_in_transition_state() &&
+           ICStub_from_destination_address(ic->stub_address()) == stub, "wrong owner of ic buffer");
+    if (!install_destination) {
+      // Nothing reads the value cell while the call goes through the
+      // stub, since the stub loads its own copy of the value.
+      if (!ic->is_optimized()) {
+        void* value = stub->cached_value();
+        ic->set_data((intptr_t)(value != NULL ? value : Universe::non_oop_word()));
+      }
+    } else {
+      if (TraceICBuffer) {
+        tty->print_cr("  install transition stub for " INTPTR_FORMAT " destination " INTPTR_FORMAT,
+                      p2i(site), p2i(stub->destination()));
+      }
+      ic->_call->set_destination_mt_safe(stub->destination());
+      // The inline cache now owns the cached value, do not release it
+      stub->_ic_site = NULL;
+    }
+  }
+}
+
+// Recycles the stubs without a safepoint. Copying a stub back into its
+// inline cache must not let a thread see the new destination together
+// with the old value, so the values are installed first, followed by a
+// handshake which guarantees that no thread is between loading the value
+// and making the call. Then the destinations are installed, and a second
+// handshake guarantees that no thread is still executing in a stub, after
+// which the stubs and the CompiledICHolders released so far can be freed.
+void InlineCacheBuffer::refill_with_handshakes(JavaThread* thread) {
+  uint64_t epoch = Atomic::load_acquire(&_refill_epoch);
+  MutexLocker ml(InlineCacheRefill_lock);
+  if (epoch != _refill_epoch) {
+    // Somebody else refilled the buffer while we were waiting
+    return;
+  }
+
+  ResourceMark rm(thread);
+  GrowableArray<ICStub*> stubs;
+  {
+    MutexLocker ml(InlineCacheBuffer_lock, Mutex::_no_safepoint_check_flag);
+    for (Stub* s = buffer()->first(); s != NULL; s = buffer()->next(s)) {
+      stubs.append((ICStub*)s);
+    }
+  }
+  if (stubs.is_empty()) {
+    return;
+  }
+  if (TraceICBuffer) {
+    tty->print_cr("[refilling inline cache buffer with %d stubs]", stubs.length());
+  }
+
+  ICBufferRendezvousClosure rendezvous;
+  {
+    NoSafepointVerifier nsv;
+    install_stubs(&stubs, false);
+  }
+  Handshake::execute(&rendezvous);
+  {
+    NoSafepointVerifier nsv;
+    if (_refill_epoch != epoch) {
+      // A safepoint transferred the stubs, their memory may be reused
+      return;
+    }
+    install_stubs(&stubs, true);
+  }
+
+  CompiledICHolder* holders;
+  int holder_count;
+  {
+    MutexLocker ml(InlineCacheBuffer_lock, Mutex::_no_safepoint_check_flag);
+    holders = _pending_released;
+    holder_count = _pending_count;
+    _pending_released = NULL;
+    _pending_count = 0;
+    _releasing_count += holder_count;
+  }
+  Handshake::execute(&rendezvous);
+
+  while (holders != NULL) {
+    CompiledICHolder* next = holders->next();
+    delete holders;
+    holders = next;
+  }
+
+  MutexLocker ml2(InlineCacheBuffer_lock, Mutex::_no_safepoint_check_flag);
+  _releasing_count -= holder_count;
+  if (_refill_epoch == epoch) {
+    // Stubs are set up under InlineCacheBuffer_lock, so every stub of the
+    // snapshot had its site, and has since been installed or cleared.
+    // Removing them patches nothing. Stubs created since the snapshot
+    // follow them in the queue.
+    buffer()->remove_first(stubs.length());
+    Atomic::release_store(&_refill_epoch, epoch + 1);
+  }
+}
+
 void InlineCacheBuffer::update_inline_caches() {
   if (buffer()->number_of_stubs() > 0) {
     if (TraceICBuffer) {
       tty->print_cr("[updating inline caches with %d stubs]", buffer()->number_of_stubs());
     }
     buffer()->remove_all();
+    Atomic::release_store(&_refill_epoch, _refill_epoch + 1);
   }
   release_pending_icholders();
 }
@@ -202,8 +349,16 @@ bool InlineCacheBuffer::create_transition_stub(CompiledIC *ic, void* cached_valu
                   p2i(ic->instruction_address()), p2i(entry), p2i(cached_value));
   }
 
-  // allocate and initialize new "out-of-line" inline-cache
-  ICStub* ic_stub = new_ic_stub();
+  // allocate and initialize new "out-of-line" inline-cache. Both happen
+  // under the buffer lock, so a refill never sees a stub without its site.
+  ICStub* ic_stub;
+  {
+    MutexLocker ml(InlineCacheBuffer_lock, Mutex::_no_safepoint_check_flag);
+    ic_stub = new_ic_stub();
+    if (ic_stub != NULL) {
+      ic_stub->set_stub(ic, cached_value, entry);
+    }
+  }
   if (ic_stub == NULL) {
 #ifdef ASSERT
     ICRefillVerifier* verifier = current_ic_refill_verifier();
@@ -218,8 +373,6 @@ bool InlineCacheBuffer::create_transition_stub(CompiledIC *ic, void* cached_valu
     old_stub->clear();
   }
 
-  ic_stub->set_stub(ic, cached_value, entry);
-
   // Update inline cache in nmethod to point to new "out-of-line" allocated inline cache
   ic->set_ic_destination(ic_stub);
   return true;
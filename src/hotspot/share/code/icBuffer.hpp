@@ -34,6 +34,9 @@
 #include "utilities/debug.hpp"
 #include "utilities/macros.hpp"
 
+class JavaThread;
+template <class E> class GrowableArray;
+
 //
 // For CompiledIC's:
 //
@@ -44,6 +47,10 @@
 //    instruction_address --> 01 set xxx_oop, Ginline_cache_klass
 //                            23 jump_to Gtemp, yyyy
 //                            4  nop
+//
+// A Java thread that runs out of stubs can also transfer them without a
+// safepoint: the cached values are copied first, then the call destinations,
+// with a handshake after each step (see InlineCacheBuffer::refill_ic_stubs).
 
 class ICStub: public Stub {
  private:
@@ -52,6 +59,7 @@ class ICStub: public Stub {
   /* stub code follows here */
  protected:
   friend class ICStubInterface;
+  friend class InlineCacheBuffer;
   // This will be called only by ICStubInterface
   void    initialize(int size,
                      CodeStrings strings)        { _size = size; _ic_site = NULL; }
@@ -143,11 +151,22 @@ class InlineCacheBuffer: public AllStatic {
 
   static CompiledICHolder* _pending_released;
   static int _pending_count;
+  static int _releasing_count;
+
+  // Bumped every time stubs are removed from the buffer. A refill that
+  // spans handshakes uses it to detect that a safepoint emptied the
+  // buffer underneath it, after which its stub snapshot is stale.
+  static volatile uint64_t _refill_epoch;
 
   static StubQueue* buffer()                         { return _buffer;         }
 
   static ICStub* new_ic_stub();
 
+  // Safepoint-free refill, see refill_ic_stubs()
+  static bool can_refill_with_handshakes(Thread* thread);
+  static void refill_with_handshakes(JavaThread* thread);
+  static void install_stubs(GrowableArray<ICStub*>* stubs, bool install_destination);
+
   // Machine-dependent implementation of ICBuffer
   static void    assemble_ic_buffer_code(address code_begin, void* cached_value, address entry_point);
   static address ic_buffer_entry_point  (address code_begin);
@@ -170,7 +189,7 @@ class InlineCacheBuffer: public AllStatic {
 
   static void release_pending_icholders();
   static void queue_for_release(CompiledICHolder* icholder);
-  static int pending_icholder_count() { return _pending_count; }
+  static int pending_icholder_count() { return _pending_count + _releasing_count; }
 
   // New interface
   static bool    create_transition_stub(CompiledIC *ic, void* cached_value, address entry);
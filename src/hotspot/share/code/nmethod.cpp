@@ -29,6 +29,7 @@
 #include "code/compiledIC.hpp"
 #include "code/compiledMethod.inline.hpp"
 #include "code/dependencies.hpp"
+#include "code/dependencyContext.hpp"
 #include "code/nativeInst.hpp"
 #include "code/nmethod.hpp"
 #include "code/scopeDesc.hpp"
@@ -196,11 +197,11 @@ struct pc_nmethod_stats_struct {
   int pc_desc_resets;   // number of resets (= number of caches)
   int pc_desc_queries;  // queries to nmethod::find_pc_desc
   int pc_desc_approx;   // number of those which have approximate true
-  int pc_desc_repeats;  // number of _pc_descs[0] hits
-  int pc_desc_hits;     // number of LRU cache hits
+  int pc_desc_repeats;  // number of _last_pc_desc hits
+  int pc_desc_hits;     // number of hashed cache hits
   int pc_desc_tests;    // total number of PcDesc examinations
-  int pc_desc_searches; // total number of quasi-binary search steps
-  int pc_desc_adds;     // number of LUR cache insertions
+  int pc_desc_searches; // total number of binary search steps
+  int pc_desc_adds;     // number of cache insertions
 
   void print_pc_stats() {
     tty->print_cr("PcDesc Statistics:  %d queries, %.2f comparisons per query",
@@ -263,6 +264,10 @@ ExceptionCache::ExceptionCache(Handle exception, address pc, address handler) {
   _exception_type = exception->klass();
   _next = NULL;
   _purge_list_next = NULL;
+  for (int i = 0; i < table_size; i++) {
+    _pc[i] = NULL;
+    _handler[i] = NULL;
+  }
 
   add_address_and_handler(pc,handler);
 }
@@ -289,11 +294,16 @@ bool ExceptionCache::match_exception_with_space(Handle exception) {
 
 
 address ExceptionCache::test_address(address addr) {
-  int limit = count();
-  for (int i = 0; i < limit; i++) {
-    if (pc_at(i) == addr) {
-      return handler_at(i);
+  int index = index_for(addr);
+  for (int i = 0; i < table_size; i++) {
+    address pc = pc_at(index);
+    if (pc == addr) {
+      return handler_at(index);
+    }
+    if (pc == NULL) {
+      break;
     }
+    index = (index + 1) & (table_size - 1);
   }
   return NULL;
 }
@@ -302,10 +312,14 @@ address ExceptionCache::test_address(address addr) {
 bool ExceptionCache::add_address_and_handler(address addr, address handler) {
   if (test_address(addr) == handler) return true;
 
-  int index = count();
-  if (index < cache_size) {
-    set_pc_at(index, addr);
-    set_handler_at(index, handler);
+  if (count() < cache_size) {
+    // At most half of the slots are used, so there is a free one
+    int index = index_for(addr);
+    while (_pc[index] != NULL) {
+      index = (index + 1) & (table_size - 1);
+    }
+    _handler[index] = handler;
+    Atomic::release_store(&_pc[index], addr);
     increment_count();
     return true;
   }
@@ -334,12 +348,13 @@ static inline bool match_desc(PcDesc* pc, int pc_offset, bool approximate) {
 
 void PcDescCache::reset_to(PcDesc* initial_pc_desc) {
   if (initial_pc_desc == NULL) {
-    _pc_descs[0] = NULL; // native method; no PcDescs at all
+    _last_pc_desc = NULL; // native method; no PcDescs at all
     return;
   }
   NOT_PRODUCT(++pc_nmethod_stats.pc_desc_resets);
   // reset the cache by filling it with benign (non-null) values
   assert(initial_pc_desc->pc_offset() < 0, "must be sentinel");
+  _last_pc_desc = initial_pc_desc;
   for (int i = 0; i < cache_size; i++)
     _pc_descs[i] = initial_pc_desc;
 }
@@ -348,46 +363,33 @@ PcDesc* PcDescCache::find_pc_desc(int pc_offset, bool approximate) {
   NOT_PRODUCT(++pc_nmethod_stats.pc_desc_queries);
   NOT_PRODUCT(if (approximate) ++pc_nmethod_stats.pc_desc_approx);
 
-  // Note: one might think that caching the most recently
-  // read value separately would be a win, but one would be
-  // wrong.  When many threads are updating it, the cache
-  // line it's in would bounce between caches, negating
-  // any benefit.
-
   // In order to prevent race conditions do not load cache elements
   // repeatedly, but use a local copy:
   PcDesc* res;
 
   // Step one:  Check the most recently added value.
-  res = _pc_descs[0];
+  res = _last_pc_desc;
   if (res == NULL) return NULL;  // native method; no PcDescs at all
   if (match_desc(res, pc_offset, approximate)) {
     NOT_PRODUCT(++pc_nmethod_stats.pc_desc_repeats);
     return res;
   }
 
-  // Step two:  Check the rest of the LRU cache.
-  for (int i = 1; i < cache_size; ++i) {
-    res = _pc_descs[i];
-    if (res->pc_offset() < 0) break;  // optimization: skip empty cache
-    if (match_desc(res, pc_offset, approximate)) {
-      NOT_PRODUCT(++pc_nmethod_stats.pc_desc_hits);
-      return res;
-    }
+  // Step two:  Check the element this query maps to.
+  res = _pc_descs[index_for(pc_offset)];
+  if (res->pc_offset() >= 0 && match_desc(res, pc_offset, approximate)) {
+    NOT_PRODUCT(++pc_nmethod_stats.pc_desc_hits);
+    return res;
   }
 
   // Report failure.
   return NULL;
 }
 
-void PcDescCache::add_pc_desc(PcDesc* pc_desc) {
+void PcDescCache::add_pc_desc(int pc_offset, PcDesc* pc_desc) {
   NOT_PRODUCT(++pc_nmethod_stats.pc_desc_adds);
-  // Update the LRU cache by shifting pc_desc forward.
-  for (int i = 0; i < cache_size; i++)  {
-    PcDesc* next = _pc_descs[i];
-    _pc_descs[i] = pc_desc;
-    pc_desc = next;
-  }
+  _pc_descs[index_for(pc_offset)] = pc_desc;
+  _last_pc_desc = pc_desc;
 }
 
 // adjust pcs_size so that it is a multiple of both oopSize and
@@ -565,8 +567,13 @@ nmethod* nmethod::new_nmethod(const methodHandle& method,
           if (klass == NULL) {
             continue;  // ignore things like evol_method
           }
-          // record this nmethod as dependent on this klass
-          InstanceKlass::cast(klass)->add_dependent_nmethod(nm);
+          // record this nmethod as dependent on this klass, together with
+          // the dependency so that class loading can check it directly
+          DependencyRecord dep;
+          dep._type = deps.type();
+          dep._x = deps.argument_count() > 1 ? deps.argument(1) : NULL;
+          dep._y = deps.argument_count() > 2 ? deps.argument(2) : NULL;
+          InstanceKlass::cast(klass)->add_dependent_nmethod(nm, &dep);
         }
       }
       NOT_PRODUCT(if (nm != NULL)  note_java_nmethod(nm));
@@ -2116,10 +2123,9 @@ PcDesc* PcDescContainer::find_pc_desc_internal(address pc, bool approximate, con
     return res;
   }
 
-  // Fallback algorithm: quasi-linear search for the PcDesc
+  // Fallback algorithm: binary search for the PcDesc
   // Find the last pc_offset less than the given offset.
   // The successor must be the required match, if there is a match at all.
-  // (Use a fixed radix to avoid expensive affine pointer arithmetic.)
   PcDesc* lower = search.scopes_pcs_begin();
   PcDesc* upper = search.scopes_pcs_end();
   upper -= 1; // exclude final sentinel
@@ -2131,49 +2137,21 @@ PcDesc* PcDescContainer::find_pc_desc_internal(address pc, bool approximate, con
   assert(upper->pc_offset() >= pc_offset, "sanity")
   assert_LU_OK;
 
-  // Use the last successful return as a split point.
-  PcDesc* mid = _pc_desc_cache.last_pc_desc();
-  NOT_PRODUCT(++pc_nmethod_stats.pc_desc_searches);
-  if (mid->pc_offset() < pc_offset) {
-    lower = mid;
-  } else {
-    upper = mid;
-  }
-
-  // Take giant steps at first (4096, then 256, then 16, then 1)
-  const int LOG2_RADIX = 4 /*smaller steps in debug mode:*/ debug_only(-1);
-  const int RADIX = (1 << LOG2_RADIX);
-  for (int step = (1 << (LOG2_RADIX*3)); step > 1; step >>= LOG2_RADIX) {
-    while ((mid = lower + step) < upper) {
-      assert_LU_OK;
-      NOT_PRODUCT(++pc_nmethod_stats.pc_desc_searches);
-      if (mid->pc_offset() < pc_offset) {
-        lower = mid;
-      } else {
-        upper = mid;
-        break;
-      }
-    }
-    assert_LU_OK;
-  }
-
-  // Sneak up on the value with a linear search of length ~16.
-  while (true) {
-    assert_LU_OK;
-    mid = lower + 1;
+  while (upper - lower > 1) {
+    PcDesc* mid = lower + (upper - lower) / 2;
     NOT_PRODUCT(++pc_nmethod_stats.pc_desc_searches);
     if (mid->pc_offset() < pc_offset) {
       lower = mid;
     } else {
       upper = mid;
-      break;
     }
+    assert_LU_OK;
   }
 #undef assert_LU_OK
 
   if (match_desc(upper, pc_offset, approximate)) {
     assert(upper == linear_search(search, pc_offset, approximate), "search ok");
-    _pc_desc_cache.add_pc_desc(upper);
+    _pc_desc_cache.add_pc_desc(pc_offset, upper);
     return upper;
   } else {
     assert(NULL == linear_search(search, pc_offset, approximate), "search ok");
@@ -441,6 +441,8 @@ CompileTask* CompileQueue::get() {
     // We need a timed wait here, since compiler threads can exit if compilation
     // is disabled forever. We use 5 seconds wait time; the exiting of compiler threads
     // is not critical and we do not want idle compiler threads to wake up too often.
+    // An idle compiler thread does not need its cached arena chunks.
+    Thread::current()->chunk_pool_cache()->release();
     locker.wait(5*1000);
 
     if (UseDynamicNumberOfCompilerThreads && _first == NULL) {
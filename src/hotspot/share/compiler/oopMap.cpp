@@ -36,9 +36,11 @@
 #include "oops/compressedOops.hpp"
 #include "runtime/frame.inline.hpp"
 #include "runtime/handles.inline.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/signature.hpp"
 #include "utilities/align.hpp"
 #include "utilities/lockFreeStack.hpp"
+#include "utilities/resourceHash.hpp"
 #ifdef COMPILER1
 #include "c1/c1_Defs.hpp"
 #endif
@@ -705,6 +707,103 @@ ImmutableOopMapSet* ImmutableOopMapSet::build_from(const OopMapSet* oopmap_set)
   return builder.build();
 }
 
+// Sets shared between code blobs. Lookups are by content, so the entry
+// records the canonical copy along with its reference count.
+struct SharedOopMapSetEntry {
+  ImmutableOopMapSet* _set;
+  int                 _refcount;
+  SharedOopMapSetEntry() : _set(NULL), _refcount(0) {}
+  SharedOopMapSetEntry(ImmutableOopMapSet* set) : _set(set), _refcount(1) {}
+};
+
+typedef ResourceHashtable<ImmutableOopMapSet*, SharedOopMapSetEntry,
+                          &ImmutableOopMapSet::hash, &ImmutableOopMapSet::equals,
+                          1009, ResourceObj::C_HEAP, mtCode> SharedOopMapSetTable;
+
+static SharedOopMapSetTable* _shared_oop_map_sets = NULL;
+static size_t _shared_oop_map_set_count   = 0;  // distinct sets in the table
+static size_t _shared_oop_map_set_bytes   = 0;  // bytes allocated for them
+static size_t _shared_oop_map_saved_bytes = 0;  // bytes not allocated thanks to sharing
+
+unsigned ImmutableOopMapSet::hash(ImmutableOopMapSet* const& set) {
+  const u1* p = (const u1*) set;
+  unsigned h = (unsigned) set->nr_of_bytes();
+  for (int i = 0; i < set->nr_of_bytes(); i++) {
+    h = 31 * h + p[i];
+  }
+  return h;
+}
+
+bool ImmutableOopMapSet::equals(ImmutableOopMapSet* const& s1, ImmutableOopMapSet* const& s2) {
+  return s1->nr_of_bytes() == s2->nr_of_bytes() &&
+         memcmp(s1, s2, s1->nr_of_bytes()) == 0;
+}
+
+ImmutableOopMapSet* ImmutableOopMapBuilder::build_shared() {
+  _required = heap_size();
+
+  // Build into a zeroed scratch buffer so that alignment padding does not
+  // make otherwise identical sets compare different.
+  address buffer = NEW_RESOURCE_ARRAY(unsigned char, _required);
+  memset(buffer, 0, _required);
+  ImmutableOopMapSet* candidate = generate_into(buffer);
+
+  if (_shared_oop_map_sets == NULL) {
+    _shared_oop_map_sets = new (ResourceObj::C_HEAP, mtCode) SharedOopMapSetTable();
+  }
+  SharedOopMapSetEntry* entry = _shared_oop_map_sets->get(candidate);
+  if (entry != NULL) {
+    entry->_refcount++;
+    _shared_oop_map_saved_bytes += _required;
+    return entry->_set;
+  }
+
+  address copy = NEW_C_HEAP_ARRAY(unsigned char, _required, mtCode);
+  memcpy(copy, buffer, _required);
+  ImmutableOopMapSet* shared = (ImmutableOopMapSet*) copy;
+  _shared_oop_map_sets->put(shared, SharedOopMapSetEntry(shared));
+  _shared_oop_map_set_count++;
+  _shared_oop_map_set_bytes += _required;
+  return shared;
+}
+
+ImmutableOopMapSet* ImmutableOopMapSet::build_shared_from(const OopMapSet* oopmap_set) {
+  assert_locked_or_safepoint(CodeCache_lock);
+  ResourceMark mark;
+  ImmutableOopMapBuilder builder(oopmap_set);
+  return builder.build_shared();
+}
+
+void ImmutableOopMapSet::release_shared(ImmutableOopMapSet* set) {
+  if (set == NULL) {
+    return;
+  }
+  assert_locked_or_safepoint(CodeCache_lock);
+  SharedOopMapSetEntry* entry = _shared_oop_map_sets != NULL ? _shared_oop_map_sets->get(set) : NULL;
+  if (entry == NULL) {
+    // Not built by build_shared_from(), the blob owns it exclusively
+    FREE_C_HEAP_ARRAY(unsigned char, set);
+    return;
+  }
+  int size = set->nr_of_bytes();
+  assert(entry->_set == set, "shared sets are handed out by build_shared_from()");
+  assert(entry->_refcount > 0, "must be referenced");
+  if (--entry->_refcount > 0) {
+    _shared_oop_map_saved_bytes -= size;
+    return;
+  }
+  _shared_oop_map_sets->remove(set);
+  _shared_oop_map_set_count--;
+  _shared_oop_map_set_bytes -= size;
+  FREE_C_HEAP_ARRAY(unsigned char, set);
+}
+
+void ImmutableOopMapSet::print_sharing_statistics(outputStream* st) {
+  st->print_cr(" oop_map_sets=" SIZE_FORMAT " size=" SIZE_FORMAT "Kb saved_by_sharing=" SIZE_FORMAT "Kb",
+               _shared_oop_map_set_count, _shared_oop_map_set_bytes / K,
+               _shared_oop_map_saved_bytes / K);
+}
+
 
 //------------------------------DerivedPointerTable---------------------------
 
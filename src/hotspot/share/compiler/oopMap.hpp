@@ -325,6 +325,16 @@ public:
 
   static ImmutableOopMapSet* build_from(const OopMapSet* oopmap_set);
 
+  // Code blobs with byte-identical oop maps (stubs, adapters and many
+  // small nmethods) share a single reference counted copy. Both calls
+  // must be made with the CodeCache_lock held or at a safepoint.
+  static ImmutableOopMapSet* build_shared_from(const OopMapSet* oopmap_set);
+  static void release_shared(ImmutableOopMapSet* set);
+  static void print_sharing_statistics(outputStream* st);
+
+  static unsigned hash(ImmutableOopMapSet* const& set);
+  static bool equals(ImmutableOopMapSet* const& s1, ImmutableOopMapSet* const& s2);
+
   const ImmutableOopMap* find_map_at_offset(int pc_offset) const;
 
   const ImmutableOopMapPair* pair_at(int index) const { assert(index >= 0 && index < _count, "check"); return &get_pairs()[index]; }
@@ -398,6 +408,7 @@ public:
 
   int heap_size();
   ImmutableOopMapSet* build();
+  ImmutableOopMapSet* build_shared();
   ImmutableOopMapSet* generate_into(address buffer);
 private:
   bool is_empty(const OopMap* map) const {
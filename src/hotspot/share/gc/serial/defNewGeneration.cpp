@@ -45,12 +45,17 @@
 #include "gc/shared/space.inline.hpp"
 #include "gc/shared/spaceDecorator.inline.hpp"
 #include "gc/shared/strongRootsScope.hpp"
+#include "gc/shared/taskqueue.inline.hpp"
 #include "gc/shared/weakProcessor.hpp"
+#include "gc/shared/workgroup.hpp"
 #include "logging/log.hpp"
 #include "memory/iterator.inline.hpp"
 #include "memory/resourceArea.hpp"
+#include "oops/access.inline.hpp"
+#include "oops/compressedOops.inline.hpp"
 #include "oops/instanceRefKlass.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/java.hpp"
 #include "runtime/prefetch.inline.hpp"
 #include "runtime/thread.inline.hpp"
@@ -156,7 +161,9 @@ DefNewGeneration::DefNewGeneration(ReservedSpace rs,
   : Generation(rs, initial_size),
     _preserved_marks_set(false /* in_c_heap */),
     _promo_failure_drain_in_progress(false),
-    _should_allocate_from_space(false)
+    _should_allocate_from_space(false),
+    _card_scan_workers(NULL),
+    _card_scan_queues(NULL)
 {
   MemRegion cmr((HeapWord*)_virtual_space.low(),
                 (HeapWord*)_virtual_space.high());
@@ -200,6 +207,18 @@ DefNewGeneration::DefNewGeneration(ReservedSpace rs,
   _pretenure_size_threshold_words = PretenureSizeThreshold >> LogHeapWordSize;
 
   _gc_timer = new (ResourceObj::C_HEAP, mtGC) STWGCTimer();
+
+  if (DefNewCardScanThreads > 0) {
+    _card_scan_workers = new WorkGang("DefNew Card Scan", DefNewCardScanThreads,
+                                      /* are_GC_task_threads */ true,
+                                      /* are_ConcurrentGC_threads */ false);
+    _card_scan_workers->initialize_workers();
+    _card_scan_workers->update_active_workers(DefNewCardScanThreads);
+    _card_scan_queues = new CardScanQueue[DefNewCardScanThreads];
+    for (uint i = 0; i < DefNewCardScanThreads; i++) {
+      _card_scan_queues[i].initialize();
+    }
+  }
 }
 
 void DefNewGeneration::compute_space_boundaries(uintx minimum_eden_size,
@@ -540,6 +559,128 @@ void DefNewGeneration::adjust_desired_tenuring_threshold() {
   age_table()->print_age_table(_tenuring_threshold);
 }
 
+// Applied by the card scan workers.  Nothing is evacuated while they
+// run, so the old generation is only read; the locations of fields that
+// refer into the young generation are queued for the VM thread.
+class RecordOldToYoungClosure: public BasicOopsInGenClosure {
+  DefNewGeneration::CardScanQueue* _queue;
+  HeapWord*                        _boundary;
+
+  template <class T> void do_oop_work(T* p) {
+    T heap_oop = RawAccess<>::oop_load(p);
+    if (!CompressedOops::is_null(heap_oop)) {
+      oop obj = CompressedOops::decode_not_null(heap_oop);
+      if ((HeapWord*)obj < _boundary) {
+        _queue->push(StarTask(p));
+      }
+    }
+  }
+
+ public:
+  RecordOldToYoungClosure(Generation* old_gen, DefNewGeneration* young_gen,
+                          DefNewGeneration::CardScanQueue* queue) :
+    BasicOopsInGenClosure(old_gen),
+    _queue(queue),
+    _boundary(young_gen->reserved().end()) {}
+
+  virtual void do_oop(oop* p)       { do_oop_work(p); }
+  virtual void do_oop(narrowOop* p) { do_oop_work(p); }
+};
+
+// The used region of the old generation is split into strides of
+// CardsPerStride cards which the workers claim in turn.  Each stride is
+// scanned and cleared with the serial card iteration, so a stride is
+// touched by one worker only.  An object extending over a stride
+// boundary may have its fields recorded by both workers.
+class OldGenCardScanTask: public AbstractGangTask {
+  DefNewGeneration*                _young_gen;
+  Generation*                      _old_gen;
+  Space*                           _sp;
+  MemRegion                        _mr;
+  DefNewGeneration::CardScanQueue* _queues;
+  size_t                           _num_strides;
+  volatile size_t                  _next_stride;
+
+ public:
+  static const size_t CardsPerStride = 256;
+
+  static size_t stride_words() {
+    return CardsPerStride * CardTable::card_size_in_words;
+  }
+
+  OldGenCardScanTask(DefNewGeneration* young_gen, Generation* old_gen, Space* sp,
+                     DefNewGeneration::CardScanQueue* queues) :
+    AbstractGangTask("Old Gen Card Scan"),
+    _young_gen(young_gen),
+    _old_gen(old_gen),
+    _sp(sp),
+    _mr(sp->used_region_at_save_marks()),
+    _queues(queues),
+    _num_strides(align_up(_mr.word_size(), stride_words()) / stride_words()),
+    _next_stride(0) {}
+
+  void work(uint worker_id) {
+    CardTableRS* ct = GenCollectedHeap::heap()->rem_set();
+    RecordOldToYoungClosure cl(_old_gen, _young_gen, &_queues[worker_id]);
+    size_t stride;
+    while ((stride = Atomic::add(&_next_stride, (size_t)1) - 1) < _num_strides) {
+      ResourceMark rm;
+      HeapWord* start = _mr.start() + stride * stride_words();
+      HeapWord* end = MIN2(start + stride_words(), _mr.end());
+      ct->non_clean_card_iterate_possibly_parallel(_sp, MemRegion(start, end), &cl, ct, 0);
+    }
+  }
+};
+
+bool DefNewGeneration::scan_old_gen_cards_in_parallel() {
+  if (_card_scan_workers == NULL) {
+    return false;
+  }
+  Space* sp = _old_gen->first_compaction_space();
+  CardTableRS* ct = GenCollectedHeap::heap()->rem_set();
+  ct->verify_used_region_at_save_marks(sp);
+  // Waking the workers costs more than scanning a few strides.
+  size_t min_words = 2 * DefNewCardScanThreads * OldGenCardScanTask::stride_words();
+  if (sp->used_region_at_save_marks().word_size() < min_words) {
+    return false;
+  }
+  GCTraceTime(Trace, gc, phases) tm("Scan Old Gen Cards", _gc_timer);
+  // Stands in for CardTableRS::younger_refs_iterate(), keep the card
+  // values used for the old generation up to date for verification.
+  ct->record_old_gen_younger_refs_iterate();
+  OldGenCardScanTask task(this, _old_gen, sp, _card_scan_queues);
+  _card_scan_workers->run_task(&task);
+  return true;
+}
+
+template <class T>
+void DefNewGeneration::process_recorded_old_gen_ref(T* p, FastScanClosure* cl) {
+  // A location recorded twice has already been updated to the copy in
+  // to-space, which must not be copied again.
+  oop obj = RawAccess<IS_NOT_NULL>::oop_load(p);
+  if (!to()->is_in_reserved(obj)) {
+    cl->do_oop(p);
+  }
+}
+
+void DefNewGeneration::process_recorded_old_gen_refs(FastScanClosure* cl) {
+  cl->set_generation(_old_gen);
+  for (uint i = 0; i < DefNewCardScanThreads; i++) {
+    CardScanQueue* queue = &_card_scan_queues[i];
+    StarTask task;
+    while (queue->pop_overflow(task) || queue->pop_local(task)) {
+      if (task.is_narrow()) {
+        process_recorded_old_gen_ref((narrowOop*)task, cl);
+      } else {
+        process_recorded_old_gen_ref((oop*)task, cl);
+      }
+    }
+    assert(queue->is_empty(), "should be drained");
+    queue->overflow_stack()->clear(true /* clear_cache */);
+  }
+  cl->reset_generation();
+}
+
 void DefNewGeneration::collect(bool   full,
                                bool   clear_all_soft_refs,
                                size_t size,
@@ -598,6 +739,10 @@ void DefNewGeneration::collect(bool   full,
   assert(heap->no_allocs_since_save_marks(),
          "save marks have not been newly set.");
 
+  // The card scan workers, if any, must finish before anything is
+  // evacuated into the old generation.
+  bool old_gen_cards_scanned = scan_old_gen_cards_in_parallel();
+
   {
     // DefNew needs to run with n_threads == 0, to make sure the serial
     // version of the card table scanning code is used.
@@ -606,10 +751,14 @@ void DefNewGeneration::collect(bool   full,
 
     heap->young_process_roots(&srs,
                               &fsc_with_no_gc_barrier,
-                              &fsc_with_gc_barrier,
+                              old_gen_cards_scanned ? NULL : &fsc_with_gc_barrier,
                               &cld_scan_closure);
   }
 
+  if (old_gen_cards_scanned) {
+    process_recorded_old_gen_refs(&fsc_with_gc_barrier);
+  }
+
   // "evacuate followers".
   evacuate_followers.do_void();
 
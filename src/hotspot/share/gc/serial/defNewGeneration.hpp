@@ -31,15 +31,18 @@
 #include "gc/shared/generation.hpp"
 #include "gc/shared/generationCounters.hpp"
 #include "gc/shared/preservedMarks.hpp"
+#include "gc/shared/taskqueue.hpp"
 #include "utilities/align.hpp"
 #include "utilities/stack.hpp"
 
 class ContiguousSpace;
+class FastScanClosure;
 class ScanClosure;
 class STWGCTimer;
 class CSpaceCounters;
 class ScanWeakRefClosure;
 class SerialHeap;
+class WorkGang;
 
 // DefNewGeneration is a young generation containing eden, from- and
 // to-space.
@@ -137,6 +140,23 @@ protected:
 
   STWGCTimer* _gc_timer;
 
+  // Parallel scanning of the old generation's dirty cards; see
+  // DefNewCardScanThreads.  The workers only record the locations of
+  // old-to-young references, one queue per worker, and the VM thread
+  // evacuates the referents afterwards.
+ public:
+  typedef OverflowTaskQueue<StarTask, mtGC, 1024> CardScanQueue;
+ protected:
+  WorkGang*      _card_scan_workers;
+  CardScanQueue* _card_scan_queues;
+
+  // Returns false, leaving the cards untouched for the serial scan, if
+  // parallel scanning is disabled or the old generation is too small
+  // for it to pay off.
+  bool scan_old_gen_cards_in_parallel();
+  void process_recorded_old_gen_refs(FastScanClosure* cl);
+  template <class T> void process_recorded_old_gen_ref(T* p, FastScanClosure* cl);
+
   enum SomeProtectedConstants {
     // Generations are GenGrain-aligned and have size that are multiples of
     // GenGrain.
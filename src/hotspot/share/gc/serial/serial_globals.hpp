@@ -37,6 +37,12 @@
                         product_rw,                                         \
                         lp64_product,                                       \
                         range,                                              \
-                        constraint)
+                        constraint)                                         \
+                                                                            \
+  experimental(uint, DefNewCardScanThreads, 0,                              \
+          "Number of worker threads used to scan the dirty cards of the "   \
+          "old generation during a young collection. 0 scans them in the "  \
+          "VM thread")                                                      \
+          range(0, 8)
 
 #endif // SHARE_GC_SERIAL_SERIAL_GLOBALS_HPP
@@ -115,10 +115,14 @@ void CardTableRS::prepare_for_younger_refs_iterate(bool parallel) {
 void CardTableRS::younger_refs_iterate(Generation* g,
                                        OopsInGenClosure* blk,
                                        uint n_threads) {
+  record_old_gen_younger_refs_iterate();
+  g->younger_refs_iterate(blk, n_threads);
+}
+
+void CardTableRS::record_old_gen_younger_refs_iterate() {
   // The indexing in this array is slightly odd. We want to access
   // the old generation record here, which is at index 2.
   _last_cur_val_in_gen[2] = cur_youngergen_card_val();
-  g->younger_refs_iterate(blk, n_threads);
 }
 
 inline bool ClearNoncleanCardWrapper::clear_card(CardValue* entry) {
@@ -116,6 +116,11 @@ public:
   // closure application.
   void younger_refs_iterate(Generation* g, OopsInGenClosure* blk, uint n_threads);
 
+  // Records the current youngergen card value as the one last used for
+  // the old generation. younger_refs_iterate() does this itself; callers
+  // that iterate over the old generation's cards otherwise must call it.
+  void record_old_gen_younger_refs_iterate();
+
   void inline_write_ref_field_gc(void* field, oop new_val) {
     CardValue* byte = byte_for(field);
     *byte = youngergen_card;
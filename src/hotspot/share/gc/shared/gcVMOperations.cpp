@@ -111,7 +111,11 @@ bool VM_GC_Operation::doit_prologue() {
 
 void VM_GC_Operation::doit_epilogue() {
   // Clean up old interpreter OopMap entries that were replaced
-  // during the GC thread root traversal.
+  // during the GC thread root traversal. This waits for concurrent
+  // lookups with GlobalCounter::write_synchronize() while we still hold
+  // the Heap_lock. That is safe: the read side critical sections in
+  // OopMapCache::lookup() only copy an entry, and never take a lock or
+  // block for a safepoint, so they finish without us releasing anything.
   OopMapCache::cleanup_old_entries();
   if (Universe::has_reference_pending_list()) {
     Heap_lock->notify_all();
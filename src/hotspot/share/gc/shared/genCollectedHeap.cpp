@@ -878,10 +878,13 @@ void GenCollectedHeap::young_process_roots(StrongRootsScope* scope,
   }
 
   // When collection is parallel, all threads get to cooperate to do
-  // old generation scanning.
-  old_gen_closure->set_generation(_old_gen);
-  rem_set()->younger_refs_iterate(_old_gen, old_gen_closure, scope->n_threads());
-  old_gen_closure->reset_generation();
+  // old generation scanning.  A NULL old_gen_closure means the caller
+  // has already scanned the old generation's cards.
+  if (old_gen_closure != NULL) {
+    old_gen_closure->set_generation(_old_gen);
+    rem_set()->younger_refs_iterate(_old_gen, old_gen_closure, scope->n_threads());
+    old_gen_closure->reset_generation();
+  }
 
   _process_strong_tasks->all_tasks_completed(scope->n_threads());
 }
@@ -734,7 +734,7 @@ BytecodeInterpreter::run(interpreterState istate) {
         if (!success) {
           markWord displaced = rcvr->mark().set_unlocked();
           mon->lock()->set_displaced_header(displaced);
-          bool call_vm = UseHeavyMonitors;
+          bool call_vm = UseHeavyMonitors || UseLockStack;
           if (call_vm || rcvr->cas_set_mark(markWord::from_pointer(mon), displaced) != displaced) {
             // Is it simple recursive case?
             if (!call_vm && THREAD->is_lock_owned((address) displaced.clear_lock_bits().to_pointer())) {
@@ -920,7 +920,7 @@ BytecodeInterpreter::run(interpreterState istate) {
       if (!success) {
         markWord displaced = lockee->mark().set_unlocked();
         entry->lock()->set_displaced_header(displaced);
-        bool call_vm = UseHeavyMonitors;
+        bool call_vm = UseHeavyMonitors || UseLockStack;
         if (call_vm || lockee->cas_set_mark(markWord::from_pointer(entry), displaced) != displaced) {
           // Is it simple recursive case?
           if (!call_vm && THREAD->is_lock_owned((address) displaced.clear_lock_bits().to_pointer())) {
@@ -1863,7 +1863,7 @@ run:
           if (!success) {
             markWord displaced = lockee->mark().set_unlocked();
             entry->lock()->set_displaced_header(displaced);
-            bool call_vm = UseHeavyMonitors;
+            bool call_vm = UseHeavyMonitors || UseLockStack;
             if (call_vm || lockee->cas_set_mark(markWord::from_pointer(entry), displaced) != displaced) {
               // Is it simple recursive case?
               if (!call_vm && THREAD->is_lock_owned((address) displaced.clear_lock_bits().to_pointer())) {
@@ -1893,7 +1893,7 @@ run:
             markWord header = lock->displaced_header();
             most_recent->set_obj(NULL);
             if (!lockee->mark().has_bias_pattern()) {
-              bool call_vm = UseHeavyMonitors;
+              bool call_vm = UseHeavyMonitors || UseLockStack;
               // If it isn't recursive we either must swap old header or call the runtime
               if (header.to_pointer() != NULL || call_vm) {
                 markWord old_header = markWord::encode(lock);
@@ -3098,7 +3098,7 @@ run:
               illegal_state_oop = Handle(THREAD, THREAD->pending_exception());
               THREAD->clear_pending_exception();
             }
-          } else if (UseHeavyMonitors) {
+          } else if (UseHeavyMonitors || UseLockStack) {
             {
               // Prevent any HandleMarkCleaner from freeing our live handles.
               HandleMark __hm(THREAD);
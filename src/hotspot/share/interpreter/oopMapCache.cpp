@@ -32,6 +32,8 @@
 #include "runtime/atomic.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/signature.hpp"
+#include "utilities/globalCounter.inline.hpp"
+#include "utilities/powerOfTwo.hpp"
 
 class OopMapCacheEntry: private InterpreterOopMap {
   friend class InterpreterOopMap;
@@ -426,15 +428,27 @@ void InterpreterOopMap::resource_copy(OopMapCacheEntry* from) {
 inline unsigned int OopMapCache::hash_value_for(const methodHandle& method, int bci) const {
   // We use method->code_size() rather than method->identity_hash() below since
   // the mark may not be present if a pointer to the method is already reversed.
+  // The Method* is mixed in as well so that the methods of a class with
+  // many similar methods spread over the (larger) table.
   return   ((unsigned int) bci)
          ^ ((unsigned int) method->max_locals()         << 2)
          ^ ((unsigned int) method->code_size()          << 4)
-         ^ ((unsigned int) method->size_of_parameters() << 6);
+         ^ ((unsigned int) method->size_of_parameters() << 6)
+         ^ ((unsigned int) ((uintptr_t) method() >> LogBytesPerWord) * 31);
 }
 
 OopMapCacheEntry* volatile OopMapCache::_old_entries = NULL;
+volatile size_t OopMapCache::_hits      = 0;
+volatile size_t OopMapCache::_misses    = 0;
+volatile size_t OopMapCache::_evictions = 0;
 
-OopMapCache::OopMapCache() {
+int OopMapCache::size_for(int method_count) {
+  int wanted = MIN2(method_count, (int) _max_size) * _slots_per_method;
+  return MIN2(MAX2(round_up_power_of_2(MAX2(wanted, 1)), (int) _min_size), (int) _max_size);
+}
+
+OopMapCache::OopMapCache(int size) : _size(size) {
+  assert(is_power_of_2(size), "table size must be a power of two");
   _array  = NEW_C_HEAP_ARRAY(OopMapCacheEntry*, _size, mtClass);
   for(int i = 0; i < _size; i++) _array[i] = NULL;
 }
@@ -448,12 +462,12 @@ OopMapCache::~OopMapCache() {
   FREE_C_HEAP_ARRAY(OopMapCacheEntry*, _array);
 }
 
-OopMapCacheEntry* OopMapCache::entry_at(int i) const {
-  return Atomic::load_acquire(&(_array[i % _size]));
+OopMapCacheEntry* OopMapCache::entry_at(unsigned int i) const {
+  return Atomic::load_acquire(&(_array[i & (_size - 1)]));
 }
 
-bool OopMapCache::put_at(int i, OopMapCacheEntry* entry, OopMapCacheEntry* old) {
-  return Atomic::cmpxchg(&_array[i % _size], old, entry) == old;
+bool OopMapCache::put_at(unsigned int i, OopMapCacheEntry* entry, OopMapCacheEntry* old) {
+  return Atomic::cmpxchg(&_array[i & (_size - 1)], old, entry) == old;
 }
 
 void OopMapCache::flush() {
@@ -473,7 +487,8 @@ void OopMapCache::flush_obsolete_entries() {
     OopMapCacheEntry* entry = _array[i];
     if (entry != NULL && !entry->is_empty() && entry->method()->is_old()) {
       // Cache entry is occupied by an old redefined method and we don't want
-      // to pin it down so flush the entry.
+      // to pin it down so flush the entry. A concurrent lookup may still be
+      // copying it, so it is reclaimed like a replaced entry.
       if (log_is_enabled(Debug, redefine, class, oopmap)) {
         ResourceMark rm;
         log_debug(redefine, class, interpreter, oopmap)
@@ -481,43 +496,57 @@ void OopMapCache::flush_obsolete_entries() {
            entry->method()->name()->as_C_string(), entry->method()->signature()->as_C_string(), i);
       }
       _array[i] = NULL;
-      entry->flush();
-      FREE_C_HEAP_OBJ(entry);
+      enqueue_for_cleanup(entry);
     }
   }
 }
 
-// Called by GC for thread root scan during a safepoint only.  The other interpreted frame oopmaps
-// are generated locally and not cached.
+// Called by GC for thread root scan, by several worker threads at once.  The other interpreted
+// frame oopmaps are generated locally and not cached.
 void OopMapCache::lookup(const methodHandle& method,
                          int bci,
                          InterpreterOopMap* entry_for) {
-  assert(SafepointSynchronize::is_at_safepoint(), "called by GC in a safepoint");
-  int probe = hash_value_for(method, bci);
-  int i;
+  assert(SafepointSynchronize::is_at_safepoint() || Thread::current()->is_GC_task_thread() ||
+         Thread::current()->is_ConcurrentGC_thread(), "called by GC");
+  // Unsigned, so that probe + i wraps around instead of overflowing.
+  unsigned int probe = hash_value_for(method, bci);
+  unsigned int i;
   OopMapCacheEntry* entry = NULL;
+  // The counters are shared by all GC workers, only update them if
+  // somebody is going to read them.
+  const bool count = log_is_enabled(Debug, gc, phases);
 
   if (log_is_enabled(Debug, interpreter, oopmap)) {
-    static int count = 0;
+    static int calls = 0;
     ResourceMark rm;
     log_debug(interpreter, oopmap)
-          ("%d - Computing oopmap at bci %d for %s at hash %d", ++count, bci,
+          ("%d - Computing oopmap at bci %d for %s at hash %u", ++calls, bci,
            method()->name_and_sig_as_C_string(), probe);
   }
 
-  // Search hashtable for match
-  for(i = 0; i < _probe_depth; i++) {
-    entry = entry_at(probe + i);
-    if (entry != NULL && !entry->is_empty() && entry->match(method, bci)) {
-      entry_for->resource_copy(entry);
-      assert(!entry_for->is_empty(), "A non-empty oop map should be returned");
-      log_debug(interpreter, oopmap)("- found at hash %d", probe + i);
-      return;
+  // Search hashtable for match. An entry that is replaced meanwhile is
+  // not freed before we leave the critical section.
+  {
+    GlobalCounter::CriticalSection cs(Thread::current());
+    for(i = 0; i < _probe_depth; i++) {
+      entry = entry_at(probe + i);
+      if (entry != NULL && !entry->is_empty() && entry->match(method, bci)) {
+        entry_for->resource_copy(entry);
+        assert(!entry_for->is_empty(), "A non-empty oop map should be returned");
+        log_debug(interpreter, oopmap)("- found at hash %u", probe + i);
+        if (count) {
+          Atomic::inc(&_hits);
+        }
+        return;
+      }
     }
   }
 
   // Entry is not in hashtable.
   // Compute entry
+  if (count) {
+    Atomic::inc(&_misses);
+  }
 
   OopMapCacheEntry* tmp = NEW_C_HEAP_OBJ(OopMapCacheEntry, mtClass);
   tmp->initialize();
@@ -550,6 +579,9 @@ void OopMapCache::lookup(const methodHandle& method,
   // where the first entry in the collision array is replaced with the new one.
   OopMapCacheEntry* old = entry_at(probe + 0);
   if (put_at(probe + 0, tmp, old)) {
+    if (count) {
+      Atomic::inc(&_evictions);
+    }
     enqueue_for_cleanup(old);
   } else {
     enqueue_for_cleanup(tmp);
@@ -575,11 +607,23 @@ void OopMapCache::enqueue_for_cleanup(OopMapCacheEntry* entry) {
   }
 }
 
-// This is called after GC threads are done and nothing is accessing the old_entries
-// list, so no synchronization needed.
+// This is called after GC threads are done with their root scan. Lookups that
+// run concurrently with the caller may still be copying one of the old entries,
+// so we wait for them before the entries are freed.
 void OopMapCache::cleanup_old_entries() {
-  OopMapCacheEntry* entry = _old_entries;
-  _old_entries = NULL;
+  size_t hits      = Atomic::xchg(&_hits, (size_t) 0);
+  size_t misses    = Atomic::xchg(&_misses, (size_t) 0);
+  size_t evictions = Atomic::xchg(&_evictions, (size_t) 0);
+  if (hits + misses > 0) {
+    log_debug(gc, phases)("Interpreter Oop Map Cache: hits " SIZE_FORMAT ", misses " SIZE_FORMAT
+                          ", evictions " SIZE_FORMAT, hits, misses, evictions);
+  }
+
+  OopMapCacheEntry* entry = Atomic::xchg(&_old_entries, (OopMapCacheEntry*) NULL);
+  if (entry == NULL) {
+    return;
+  }
+  GlobalCounter::write_synchronize();
   while (entry != NULL) {
     if (log_is_enabled(Debug, interpreter, oopmap)) {
       ResourceMark rm;
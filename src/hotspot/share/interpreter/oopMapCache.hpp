@@ -146,34 +146,51 @@ class InterpreterOopMap: ResourceObj {
 
 class OopMapCache : public CHeapObj<mtClass> {
  static OopMapCacheEntry* volatile _old_entries;
+
+ // Statistics, only collected and reported with gc+phases=debug logging
+ static volatile size_t _hits;
+ static volatile size_t _misses;
+ static volatile size_t _evictions;
  private:
-  enum { _size        = 32,     // Use fixed size for now
-         _probe_depth = 3       // probe depth in case of collisions
+  enum { _min_size         = 32,    // table size for classes with few methods
+         _max_size         = 4096,  // upper bound on the per-class table size
+         _slots_per_method = 4,     // expected number of cached bcis per method
+         _probe_depth      = 4      // probe depth in case of collisions
   };
 
+  const int _size;                // Power of two
   OopMapCacheEntry* volatile * _array;
 
   unsigned int hash_value_for(const methodHandle& method, int bci) const;
-  OopMapCacheEntry* entry_at(int i) const;
-  bool put_at(int i, OopMapCacheEntry* entry, OopMapCacheEntry* old);
+  OopMapCacheEntry* entry_at(unsigned int i) const;
+  bool put_at(unsigned int i, OopMapCacheEntry* entry, OopMapCacheEntry* old);
 
   static void enqueue_for_cleanup(OopMapCacheEntry* entry);
 
   void flush();
 
  public:
-  OopMapCache();
+  OopMapCache(int size = _min_size);
   ~OopMapCache();                                // free up memory
 
+  // Table size for a class with the given number of methods
+  static int size_for(int method_count);
+  int size() const                               { return _size; }
+
   // flush cache entry is occupied by an obsolete method
   void flush_obsolete_entries();
 
   // Returns the oopMap for (method, bci) in parameter "entry".
-  // Returns false if an oop map was not found.
+  // Lookups and fills are lock-free and may run in several GC worker
+  // threads at once, inside or outside of a safepoint. Replaced entries
+  // are reclaimed by cleanup_old_entries().
   void lookup(const methodHandle& method, int bci, InterpreterOopMap* entry);
 
   // Compute an oop map without updating the cache or grabbing any locks (for debugging)
   static void compute_one_oop_map(const methodHandle& method, int bci, InterpreterOopMap* entry);
+
+  // Frees the replaced entries once no lookup can reference them any more,
+  // and logs the cache statistics since the previous call.
   static void cleanup_old_entries();
 };
 
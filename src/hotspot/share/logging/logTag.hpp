@@ -63,6 +63,7 @@
   LOG_TAG(dcmd) \
   LOG_TAG(decoder) \
   LOG_TAG(defaultmethods) \
+  LOG_TAG(dependencies) \
   LOG_TAG(director) \
   LOG_TAG(dump) \
   LOG_TAG(dynamic) \
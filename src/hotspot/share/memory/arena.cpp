@@ -27,10 +27,13 @@
 #include "memory/allocation.inline.hpp"
 #include "memory/metaspaceShared.hpp"
 #include "memory/resourceArea.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/os.hpp"
 #include "runtime/task.hpp"
+#include "runtime/thread.hpp"
 #include "runtime/threadCritical.hpp"
 #include "services/memTracker.hpp"
+#include "utilities/align.hpp"
 #include "utilities/ostream.hpp"
 
 //--------------------------------------------------------------------------------------
@@ -42,13 +45,12 @@ class ChunkPool: public CHeapObj<mtInternal> {
   Chunk*       _first;        // first cached Chunk; its first word points to next chunk
   size_t       _num_chunks;   // number of unused chunks in pool
   size_t       _num_used;     // number of chunks currently checked out
+  bool         _was_used;     // chunks were checked out since the last clean
   const size_t _size;         // size of each chunk (must be uniform)
+  const int    _index;        // index into _pools and the ChunkPoolCache lists
 
-  // Our four static pools
-  static ChunkPool* _large_pool;
-  static ChunkPool* _medium_pool;
-  static ChunkPool* _small_pool;
-  static ChunkPool* _tiny_pool;
+  // Our four static pools, from large to tiny
+  static ChunkPool* _pools[ChunkPoolCache::num_pools];
 
   // return first element or null
   void* get_first() {
@@ -60,18 +62,21 @@ class ChunkPool: public CHeapObj<mtInternal> {
     return c;
   }
 
- public:
-  // All chunks in a ChunkPool has the same size
-   ChunkPool(size_t size) : _size(size) { _first = NULL; _num_chunks = _num_used = 0; }
+  static ChunkPoolCache* current_cache() {
+    Thread* thread = Thread::current_or_null();
+    if (thread == NULL || !thread->chunk_pool_cache()->is_enabled()) {
+      return NULL;
+    }
+    return thread->chunk_pool_cache();
+  }
 
-  // Allocate a new chunk from the pool (might expand the pool)
-  NOINLINE void* allocate(size_t bytes, AllocFailType alloc_failmode) {
-    assert(bytes == _size, "bad size");
+  NOINLINE void* allocate_uncached(size_t bytes, AllocFailType alloc_failmode) {
     void* p = NULL;
     // No VM lock can be taken inside ThreadCritical lock, so os::malloc
     // should be done outside ThreadCritical lock due to NMT
     { ThreadCritical tc;
       _num_used++;
+      _was_used = true;
       p = get_first();
     }
     if (p == NULL) p = os::malloc(bytes, mtChunk, CURRENT_PC);
@@ -81,9 +86,86 @@ class ChunkPool: public CHeapObj<mtInternal> {
     return p;
   }
 
+  // Move up to batch_size chunks into the empty list of the cache, in
+  // one ThreadCritical.
+  void refill(ChunkPoolCache* cache) {
+    assert(cache->_num_chunks[_index] == 0, "only refill empty lists");
+    ThreadCritical tc;
+    _was_used = true;
+    Chunk* first = _first;
+    Chunk* last = NULL;
+    size_t n = 0;
+    while (_first != NULL && n < ChunkPoolCache::batch_size) {
+      last = _first;
+      _first = _first->next();
+      n++;
+    }
+    if (last != NULL) {
+      last->set_next(NULL);
+    }
+    _num_chunks -= n;
+    _num_used += n;
+    cache->_chunks[_index] = n > 0 ? first : NULL;
+    cache->_num_chunks[_index] = n;
+  }
+
+  // Give the first n chunks of the cache list back, in one ThreadCritical.
+  void give_back(ChunkPoolCache* cache, size_t n) {
+    assert(n > 0 && n <= cache->_num_chunks[_index], "bad count");
+    Chunk* first = cache->_chunks[_index];
+    Chunk* last = first;
+    for (size_t i = 1; i < n; i++) {
+      last = last->next();
+    }
+    cache->_chunks[_index] = last->next();
+    cache->_num_chunks[_index] -= n;
+
+    ThreadCritical tc;
+    last->set_next(_first);
+    _first = first;
+    _num_chunks += n;
+    _num_used -= n;
+  }
+
+ public:
+  // All chunks in a ChunkPool has the same size
+   ChunkPool(size_t size, int index) : _was_used(false), _size(size), _index(index) {
+     _first = NULL; _num_chunks = _num_used = 0;
+   }
+
+  // Allocate a new chunk from the pool (might expand the pool)
+  void* allocate(size_t bytes, AllocFailType alloc_failmode) {
+    assert(bytes == _size, "bad size");
+    ChunkPoolCache* cache = current_cache();
+    if (cache == NULL) {
+      return allocate_uncached(bytes, alloc_failmode);
+    }
+    if (cache->_num_chunks[_index] == 0) {
+      refill(cache);
+      if (cache->_num_chunks[_index] == 0) {
+        // The pool is empty too.
+        return allocate_uncached(bytes, alloc_failmode);
+      }
+    }
+    Chunk* c = cache->_chunks[_index];
+    cache->_chunks[_index] = c->next();
+    cache->_num_chunks[_index]--;
+    return c;
+  }
+
   // Return a chunk to the pool
   void free(Chunk* chunk) {
     assert(chunk->length() + Chunk::aligned_overhead_size() == _size, "bad size");
+    ChunkPoolCache* cache = current_cache();
+    if (cache != NULL) {
+      chunk->set_next(cache->_chunks[_index]);
+      cache->_chunks[_index] = chunk;
+      if (++cache->_num_chunks[_index] > ChunkPoolCache::max_chunks) {
+        give_back(cache, ChunkPoolCache::batch_size);
+      }
+      return;
+    }
+
     ThreadCritical tc;
     _num_used--;
 
@@ -93,6 +175,13 @@ class ChunkPool: public CHeapObj<mtInternal> {
     _num_chunks++;
   }
 
+  // Give all chunks of the cache list back
+  void release(ChunkPoolCache* cache) {
+    if (cache->_num_chunks[_index] > 0) {
+      give_back(cache, cache->_num_chunks[_index]);
+    }
+  }
+
   // Prune the pool
   void free_all_but(size_t n) {
     Chunk* cur = NULL;
@@ -123,32 +212,60 @@ class ChunkPool: public CHeapObj<mtInternal> {
     }
   }
 
-  // Accessors to preallocated pool's
-  static ChunkPool* large_pool()  { assert(_large_pool  != NULL, "must be initialized"); return _large_pool;  }
-  static ChunkPool* medium_pool() { assert(_medium_pool != NULL, "must be initialized"); return _medium_pool; }
-  static ChunkPool* small_pool()  { assert(_small_pool  != NULL, "must be initialized"); return _small_pool;  }
-  static ChunkPool* tiny_pool()   { assert(_tiny_pool   != NULL, "must be initialized"); return _tiny_pool;   }
+  // Prune the pool if no chunks were checked out since the last call
+  void free_idle_but(size_t n) {
+    bool was_used;
+    {
+      ThreadCritical tc;
+      was_used = _was_used;
+      _was_used = false;
+    }
+    if (!was_used) {
+      free_all_but(n);
+    }
+  }
+
+  // Returns the pool for chunks of the given length, or NULL
+  static ChunkPool* pool_for(size_t length) {
+    int index;
+    switch (length) {
+     case Chunk::size:        index = 0; break;
+     case Chunk::medium_size: index = 1; break;
+     case Chunk::init_size:   index = 2; break;
+     case Chunk::tiny_size:   index = 3; break;
+     default: return NULL;
+    }
+    assert(_pools[index] != NULL, "must be initialized");
+    return _pools[index];
+  }
 
   static void initialize() {
-    _large_pool  = new ChunkPool(Chunk::size        + Chunk::aligned_overhead_size());
-    _medium_pool = new ChunkPool(Chunk::medium_size + Chunk::aligned_overhead_size());
-    _small_pool  = new ChunkPool(Chunk::init_size   + Chunk::aligned_overhead_size());
-    _tiny_pool   = new ChunkPool(Chunk::tiny_size   + Chunk::aligned_overhead_size());
+    _pools[0] = new ChunkPool(Chunk::size        + Chunk::aligned_overhead_size(), 0);
+    _pools[1] = new ChunkPool(Chunk::medium_size + Chunk::aligned_overhead_size(), 1);
+    _pools[2] = new ChunkPool(Chunk::init_size   + Chunk::aligned_overhead_size(), 2);
+    _pools[3] = new ChunkPool(Chunk::tiny_size   + Chunk::aligned_overhead_size(), 3);
   }
 
-  static void clean() {
+  // Prune all pools, or only those that were idle since the last clean
+  static void clean(bool only_idle = false) {
     enum { BlocksToKeep = 5 };
-     _tiny_pool->free_all_but(BlocksToKeep);
-     _small_pool->free_all_but(BlocksToKeep);
-     _medium_pool->free_all_but(BlocksToKeep);
-     _large_pool->free_all_but(BlocksToKeep);
+    for (int i = ChunkPoolCache::num_pools - 1; i >= 0; i--) {
+      if (only_idle) {
+        _pools[i]->free_idle_but(BlocksToKeep);
+      } else {
+        _pools[i]->free_all_but(BlocksToKeep);
+      }
+    }
+  }
+
+  static void release_cache(ChunkPoolCache* cache) {
+    for (int i = 0; i < ChunkPoolCache::num_pools; i++) {
+      _pools[i]->release(cache);
+    }
   }
 };
 
-ChunkPool* ChunkPool::_large_pool  = NULL;
-ChunkPool* ChunkPool::_medium_pool = NULL;
-ChunkPool* ChunkPool::_small_pool  = NULL;
-ChunkPool* ChunkPool::_tiny_pool   = NULL;
+ChunkPool* ChunkPool::_pools[ChunkPoolCache::num_pools] = { NULL, NULL, NULL, NULL };
 
 void chunkpool_init() {
   ChunkPool::initialize();
@@ -159,6 +276,10 @@ Chunk::clean_chunk_pool() {
   ChunkPool::clean();
 }
 
+void ChunkPoolCache::release() {
+  ChunkPool::release_cache(this);
+}
+
 
 //--------------------------------------------------------------------------------------
 // ChunkPoolCleaner implementation
@@ -170,10 +291,61 @@ class ChunkPoolCleaner : public PeriodicTask {
  public:
    ChunkPoolCleaner() : PeriodicTask(CleaningInterval) {}
    void task() {
-     ChunkPool::clean();
+     // Busy pools keep their chunks, they would only malloc them again.
+     ChunkPool::clean(true /* only_idle */);
    }
 };
 
+//--------------------------------------------------------------------------------------
+// Mapped chunks
+//
+// Chunks of at least Chunk::map_size are mapped directly and unmapped
+// when freed, so the memory goes back to the OS at once instead of
+// fragmenting the malloc heap. They are never pooled.
+
+static volatile size_t _mapped_length = 0;
+static volatile size_t _mapped_size = 0;
+
+static size_t mapping_size(size_t length) {
+  return align_up(Chunk::aligned_overhead_size() + length, os::vm_page_size());
+}
+
+static void* map_chunk(size_t length, AllocFailType alloc_failmode) {
+  size_t bytes = mapping_size(length);
+  char* p = os::reserve_memory(bytes, NULL, 0, mtChunk);
+  if (p != NULL && !os::commit_memory(p, bytes, false)) {
+    os::release_memory(p, bytes);
+    p = NULL;
+  }
+  if (p == NULL) {
+    if (alloc_failmode == AllocFailStrategy::EXIT_OOM) {
+      vm_exit_out_of_memory(bytes, OOM_MMAP_ERROR, "Chunk::new");
+    }
+    return NULL;
+  }
+  // Count after NMT knows the mapping, see Chunk::mapped_size().
+  Atomic::add(&_mapped_size, bytes);
+  Atomic::add(&_mapped_length, length);
+  return p;
+}
+
+static void unmap_chunk(Chunk* c) {
+  size_t bytes = mapping_size(c->length());
+  Atomic::sub(&_mapped_length, c->length());
+  Atomic::sub(&_mapped_size, bytes);
+  if (!os::release_memory((char*)c, bytes)) {
+    fatal("Could not unmap arena chunk");
+  }
+}
+
+size_t Chunk::mapped_length() {
+  return Atomic::load(&_mapped_length);
+}
+
+size_t Chunk::mapped_size() {
+  return Atomic::load(&_mapped_size);
+}
+
 //--------------------------------------------------------------------------------------
 // Chunk implementation
 
@@ -184,31 +356,30 @@ void* Chunk::operator new (size_t requested_size, AllocFailType alloc_failmode,
   // expect requested_size but if sizeof(Chunk) doesn't match isn't proper size we must align it.
   assert(ARENA_ALIGN(requested_size) == aligned_overhead_size(), "Bad alignment");
   size_t bytes = ARENA_ALIGN(requested_size) + length;
-  switch (length) {
-   case Chunk::size:        return ChunkPool::large_pool()->allocate(bytes, alloc_failmode);
-   case Chunk::medium_size: return ChunkPool::medium_pool()->allocate(bytes, alloc_failmode);
-   case Chunk::init_size:   return ChunkPool::small_pool()->allocate(bytes, alloc_failmode);
-   case Chunk::tiny_size:   return ChunkPool::tiny_pool()->allocate(bytes, alloc_failmode);
-   default: {
-     void* p = os::malloc(bytes, mtChunk, CALLER_PC);
-     if (p == NULL && alloc_failmode == AllocFailStrategy::EXIT_OOM) {
-       vm_exit_out_of_memory(bytes, OOM_MALLOC_ERROR, "Chunk::new");
-     }
-     return p;
-   }
+  ChunkPool* pool = ChunkPool::pool_for(length);
+  if (pool != NULL) {
+    return pool->allocate(bytes, alloc_failmode);
+  }
+  if (length >= Chunk::map_size) {
+    return map_chunk(length, alloc_failmode);
   }
+  void* p = os::malloc(bytes, mtChunk, CALLER_PC);
+  if (p == NULL && alloc_failmode == AllocFailStrategy::EXIT_OOM) {
+    vm_exit_out_of_memory(bytes, OOM_MALLOC_ERROR, "Chunk::new");
+  }
+  return p;
 }
 
 void Chunk::operator delete(void* p) {
   Chunk* c = (Chunk*)p;
-  switch (c->length()) {
-   case Chunk::size:        ChunkPool::large_pool()->free(c); break;
-   case Chunk::medium_size: ChunkPool::medium_pool()->free(c); break;
-   case Chunk::init_size:   ChunkPool::small_pool()->free(c); break;
-   case Chunk::tiny_size:   ChunkPool::tiny_pool()->free(c); break;
-   default:
-     ThreadCritical tc;  // Free chunks under TC lock so that NMT adjustment is stable.
-     os::free(c);
+  ChunkPool* pool = ChunkPool::pool_for(c->length());
+  if (pool != NULL) {
+    pool->free(c);
+  } else if (c->length() >= Chunk::map_size) {
+    unmap_chunk(c);
+  } else {
+    ThreadCritical tc;  // Free chunks under TC lock so that NMT adjustment is stable.
+    os::free(c);
   }
 }
 
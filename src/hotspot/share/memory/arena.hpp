@@ -66,7 +66,8 @@ class Chunk: CHeapObj<mtChunk> {
     init_size  =  1*K  - slack, // Size of first chunk (normal aka small)
     medium_size= 10*K  - slack, // Size of medium-sized chunk
     size       = 32*K  - slack, // Default size of an Arena chunk (following the first)
-    non_pool_size = init_size + 32 // An initial size which is not one of above
+    non_pool_size = init_size + 32, // An initial size which is not one of above
+    map_size   =  1*M           // Chunks at least this large are mapped, not malloc'd
   };
 
   void chop();                  // Chop this chunk
@@ -86,6 +87,53 @@ class Chunk: CHeapObj<mtChunk> {
   static void start_chunk_pool_cleaner_task();
 
   static void clean_chunk_pool();
+
+  // Mapped chunks currently in use, for native memory tracking: the sum
+  // of their lengths and the sum of their mapping sizes.
+  static size_t mapped_length();
+  static size_t mapped_size();
+};
+
+//------------------------------ChunkPoolCache----------------------------------
+// Thread-local cache in front of the chunk pools. Threads that allocate and
+// free many chunks, like the compiler threads, enable it so they do not take
+// ThreadCritical for every chunk: chunks move between the cache and the
+// pools in batches. Only the owning thread may use its cache.
+class ChunkPoolCache {
+  friend class ChunkPool;
+
+ public:
+  enum {
+    num_pools  = 4,             // One list per pooled chunk size
+    max_chunks = 16,            // Most chunks cached per list
+    batch_size = 8              // Chunks moved per ThreadCritical
+  };
+
+ private:
+  Chunk* _chunks[num_pools];
+  size_t _num_chunks[num_pools];
+  bool   _enabled;
+
+ public:
+  ChunkPoolCache() : _enabled(false) {
+    for (int i = 0; i < num_pools; i++) {
+      _chunks[i] = NULL;
+      _num_chunks[i] = 0;
+    }
+  }
+
+  bool is_enabled() const { return _enabled; }
+  void enable()           { _enabled = true; }
+
+  // Give all cached chunks back to the pools, e.g. when the owning thread
+  // goes idle.
+  void release();
+
+  // Release and stop caching, the owning thread is going away.
+  void disable() {
+    _enabled = false;
+    release();
+  }
 };
 
 //------------------------------Arena------------------------------------------
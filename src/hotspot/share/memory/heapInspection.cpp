@@ -25,6 +25,7 @@
 #include "precompiled.hpp"
 #include "classfile/classLoaderData.inline.hpp"
 #include "classfile/classLoaderDataGraph.hpp"
+#include "classfile/fieldLayout.hpp"
 #include "classfile/moduleEntry.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "gc/shared/collectedHeap.hpp"
@@ -275,6 +276,36 @@ void KlassInfoHisto::print_elements(outputStream* st) const {
   }
   st->print_cr("Total " INT64_FORMAT_W(13) "  " UINT64_FORMAT_W(13),
                total, totalw * HeapWordSize);
+  if (UseCompactFieldLayout) {
+    print_field_layout_savings(st);
+  }
+}
+
+// Compares the instance sizes with an estimate of those the classic field
+// layout would have produced (see FieldLayout::classic_fields_end), so the
+// result is approximate. Mirrors are skipped as their size depends on the
+// statics.
+void KlassInfoHisto::print_field_layout_savings(outputStream* st) const {
+  uint64_t instances = 0;
+  uint64_t saved_bytes = 0;
+  for (int i = 0; i < elements()->length(); i++) {
+    const KlassInfoEntry* e = elements()->at(i);
+    if (!e->klass()->is_instance_klass() || e->count() == 0) continue;
+    const InstanceKlass* ik = InstanceKlass::cast(e->klass());
+    if (ik->is_mirror_instance_klass()) continue;
+
+    int classic_end = FieldLayout::classic_fields_end(ik);
+    int classic_size = align_object_size(align_up(classic_end, wordSize) / wordSize);
+    int size = ik->size_helper();
+    instances += e->count();
+    if (classic_size > size) {
+      saved_bytes += (uint64_t)(classic_size - size) * HeapWordSize * e->count();
+    }
+  }
+  if (instances > 0) {
+    st->print_cr("Compact field layout saved about " UINT64_FORMAT " bytes, %.2f bytes per instance",
+                 saved_bytes, (double)saved_bytes / instances);
+  }
 }
 
 #define MAKE_COL_NAME(field, name, help)     #name,
@@ -281,6 +281,7 @@ class KlassInfoHisto : public StackObj {
   GrowableArray<KlassInfoEntry*>* elements() const { return _elements; }
   static int sort_helper(KlassInfoEntry** e1, KlassInfoEntry** e2);
   void print_elements(outputStream* st) const;
+  void print_field_layout_savings(outputStream* st) const;
   void print_class_stats(outputStream* st, bool csv_format, const char *columns);
   julong annotations_bytes(Array<AnnotationArray*>* p) const;
   const char *_selected_columns;
@@ -1391,7 +1391,7 @@ void InstanceKlass::mask_for(const methodHandle& method, int bci,
     MutexLocker x(OopMapCacheAlloc_lock);
     // Check if _oop_map_cache was allocated while we were waiting for this lock
     if ((oop_map_cache = _oop_map_cache) == NULL) {
-      oop_map_cache = new OopMapCache();
+      oop_map_cache = new OopMapCache(OopMapCache::size_for(methods()->length()));
       // Ensure _oop_map_cache is stable, since it is examined without a lock
       Atomic::release_store(&_oop_map_cache, oop_map_cache);
     }
@@ -2183,11 +2183,11 @@ inline DependencyContext InstanceKlass::dependencies() {
 }
 
 int InstanceKlass::mark_dependent_nmethods(KlassDepChange& changes) {
-  return dependencies().mark_dependent_nmethods(changes);
+  return dependencies().mark_dependent_nmethods(changes, this);
 }
 
-void InstanceKlass::add_dependent_nmethod(nmethod* nm) {
-  dependencies().add_dependent_nmethod(nm);
+void InstanceKlass::add_dependent_nmethod(nmethod* nm, const DependencyRecord* dep) {
+  dependencies().add_dependent_nmethod(nm, dep);
 }
 
 void InstanceKlass::remove_dependent_nmethod(nmethod* nm) {
@@ -64,6 +64,7 @@ class ClassFileParser;
 class ClassFileStream;
 class KlassDepChange;
 class DependencyContext;
+class DependencyRecord;
 class fieldDescriptor;
 class jniIdMapBase;
 class JNIid;
@@ -971,7 +972,7 @@ public:
   // maintenance of deoptimization dependencies
   inline DependencyContext dependencies();
   int  mark_dependent_nmethods(KlassDepChange& changes);
-  void add_dependent_nmethod(nmethod* nm);
+  void add_dependent_nmethod(nmethod* nm, const DependencyRecord* dep = NULL);
   void remove_dependent_nmethod(nmethod* nm);
   void clean_dependency_context();
 
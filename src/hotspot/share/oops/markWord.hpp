@@ -81,12 +81,19 @@
 //  - the two lock bits are used to describe three states: locked/unlocked and monitor.
 //
 //    [ptr             | 00]  locked             ptr points to real header on stack
+//    [header      | 1 | 00]  locked             with UseLockStack: header in place,
+//                                               object is on the owner's lock stack
 //    [header      | 0 | 01]  unlocked           regular object header
 //    [ptr             | 10]  monitor            inflated lock (header is wapped out)
 //    [ptr             | 11]  marked             used by markSweep to mark an object
 //                                               not valid at any other time
 //
 //    We assume that stack/thread pointers have the lowest two bits cleared.
+//
+//    UseLockStack turns off biased locking and sets the then unused
+//    biased_lock bit in a fast-locked mark, so that it can never be 0:
+//    that value stays reserved for INFLATING, and for the marks that
+//    the JFR leak profiler installs at a safepoint.
 
 class BasicLock;
 class ObjectMonitor;
@@ -160,6 +167,7 @@ class markWord {
   static const uintptr_t monitor_value            = 2;
   static const uintptr_t marked_value             = 3;
   static const uintptr_t biased_lock_pattern      = 5;
+  static const uintptr_t fast_locked_pattern      = 4;
 
   static const uintptr_t no_hash                  = 0 ;  // no hash value assigned
   static const uintptr_t no_hash_in_place         = (address_word)no_hash << hash_shift;
@@ -268,9 +276,21 @@ class markWord {
     return ((value() & lock_mask_in_place) == locked_value);
   }
   BasicLock* locker() const {
-    assert(has_locker(), "check");
+    assert(has_locker() && !UseLockStack, "check");
     return (BasicLock*) value();
   }
+  // With UseLockStack a locked object keeps its header in place
+  bool is_fast_locked() const {
+    return (mask_bits(value(), biased_lock_mask_in_place) == fast_locked_pattern);
+  }
+  markWord set_fast_locked() const {
+    assert(is_neutral(), "only a neutral mark can be fast-locked");
+    return markWord((value() & ~biased_lock_mask_in_place) | fast_locked_pattern);
+  }
+  markWord clear_fast_locked() const {
+    assert(is_fast_locked(), "check");
+    return markWord((value() & ~biased_lock_mask_in_place) | unlocked_value);
+  }
   bool has_monitor() const {
     return ((value() & monitor_value) != 0);
   }
@@ -280,7 +300,9 @@ class markWord {
     return (ObjectMonitor*) (value() ^ monitor_value);
   }
   bool has_displaced_mark_helper() const {
-    return ((value() & unlocked_value) == 0);
+    uintptr_t lock_bits = value() & lock_mask_in_place;
+    return UseLockStack ? lock_bits == monitor_value
+                        : (lock_bits & unlocked_value) == 0;
   }
   markWord displaced_mark_helper() const {
     assert(has_displaced_mark_helper(), "check");
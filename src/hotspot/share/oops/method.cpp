@@ -259,10 +259,13 @@ int Method::fast_exception_handler_bci_for(const methodHandle& mh, Klass* ex_kla
 }
 
 void Method::mask_for(int bci, InterpreterOopMap* mask) {
-  methodHandle h_this(Thread::current(), this);
-  // Only GC uses the OopMapCache during thread stack root scanning
-  // any other uses generate an oopmap but do not save it in the cache.
-  if (Universe::heap()->is_gc_active()) {
+  Thread* thread = Thread::current();
+  methodHandle h_this(thread, this);
+  // Only GC uses the OopMapCache during thread stack root scanning, be it
+  // in a pause or concurrently from its worker threads. Any other uses
+  // generate an oopmap but do not save it in the cache.
+  if (Universe::heap()->is_gc_active() ||
+      thread->is_GC_task_thread() || thread->is_ConcurrentGC_thread()) {
     method_holder()->mask_for(h_this, bci, mask);
   } else {
     OopMapCache::compute_one_oop_map(h_this, bci, mask);
@@ -819,7 +819,7 @@ JNI_ENTRY(jobject, jni_NewLocalRef(JNIEnv *env, jobject ref))
 
   HOTSPOT_JNI_NEWLOCALREF_ENTRY(env, ref);
 
-  jobject ret = JNIHandles::make_local(env, JNIHandles::resolve(ref));
+  jobject ret = JNIHandles::make_local(thread, JNIHandles::resolve(ref));
 
   HOTSPOT_JNI_NEWLOCALREF_RETURN(ret);
   return ret;
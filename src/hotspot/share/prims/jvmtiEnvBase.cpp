@@ -964,6 +964,7 @@ JvmtiEnvBase::get_object_monitor_usage(JavaThread* calling_thread, jobject objec
     }
 
     address owner = NULL;
+    bool owner_on_lock_stack = false;
     {
       markWord mark = hobj()->mark();
 
@@ -971,7 +972,11 @@ JvmtiEnvBase::get_object_monitor_usage(JavaThread* calling_thread, jobject objec
         // this object has a lightweight monitor
 
         if (mark.has_locker()) {
-          owner = (address)mark.locker(); // save the address of the Lock word
+          if (UseLockStack) {
+            owner_on_lock_stack = true;  // the owner has hobj on its lock stack
+          } else {
+            owner = (address)mark.locker(); // save the address of the Lock word
+          }
         }
         // implied else: no owner
       } else {
@@ -985,15 +990,21 @@ JvmtiEnvBase::get_object_monitor_usage(JavaThread* calling_thread, jobject objec
         // can change the owner field from the Lock word to the
         // JavaThread * and it may not have done that yet.
         owner = (address)mon->owner();
+        // With UseLockStack the owner may not be known yet either.
+        owner_on_lock_stack = UseLockStack && mon->is_owner_anonymous();
       }
     }
 
-    if (owner != NULL) {
+    if (owner != NULL || owner_on_lock_stack) {
       // Use current thread since function can be called from a
       // JavaThread or the VMThread.
       ThreadsListHandle tlh;
       // This monitor is owned so we have to find the owning JavaThread.
-      owning_thread = Threads::owning_thread_from_monitor_owner(tlh.list(), owner);
+      if (owner_on_lock_stack) {
+        owning_thread = Threads::owning_thread_from_object(tlh.list(), hobj());
+      } else {
+        owning_thread = Threads::owning_thread_from_monitor_owner(tlh.list(), owner);
+      }
       // Cannot assume (owning_thread != NULL) here because this function
       // may not have been called at a safepoint and the owning_thread
       // might not be suspended.
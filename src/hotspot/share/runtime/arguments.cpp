@@ -4047,10 +4047,30 @@ jint Arguments::apply_ergo() {
     return code;
   }
 
+  if (UseLockStack) {
+#if !defined(X86) && !defined(ZERO)
+    warning("UseLockStack is not supported on this platform; ignoring UseLockStack flag.");
+    FLAG_SET_DEFAULT(UseLockStack, false);
+#else
+    if (UseHeavyMonitors) {
+      warning("UseLockStack is not supported with UseHeavyMonitors; ignoring UseLockStack flag.");
+      FLAG_SET_DEFAULT(UseLockStack, false);
+    }
+#if INCLUDE_JVMCI
+    if (EnableJVMCI) {
+      // JVMCI compilers emit their own stack-locking fast paths
+      warning("UseLockStack is not supported with JVMCI; ignoring UseLockStack flag.");
+      FLAG_SET_DEFAULT(UseLockStack, false);
+    }
+#endif
+#endif
+  }
+
   // Turn off biased locking for locking debug mode flags,
   // which are subtly different from each other but neither works with
-  // biased locking
-  if (UseHeavyMonitors
+  // biased locking. The lock stack uses the mark word bits that
+  // biased locking stores the bias owner in.
+  if (UseHeavyMonitors || UseLockStack
 #ifdef COMPILER1
       || !UseFastLocking
 #endif // COMPILER1
@@ -789,9 +789,13 @@ const size_t minimumSymbolTableSize = 1024;
   product(bool, UseXMMForArrayCopy, false,                                  \
           "Use SSE2 MOVQ instruction for Arraycopy")                        \
                                                                             \
-  notproduct(bool, PrintFieldLayout, false,                                 \
+  diagnostic(bool, PrintFieldLayout, false,                                 \
           "Print field layout for each class")                              \
                                                                             \
+  experimental(bool, UseCompactFieldLayout, false,                          \
+          "Place instance fields into the gaps left by superclass fields "  \
+          "and alignment")                                                  \
+                                                                            \
   /* Need to limit the extent of the padding to reasonable size.          */\
   /* 8K is well beyond the reasonable HW cache line size, even with       */\
   /* aggressive prefetching, while still leaving the room for segregating */\
@@ -1163,6 +1167,11 @@ const size_t minimumSymbolTableSize = 1024;
   product(bool, UseHeavyMonitors, false,                                    \
           "use heavyweight instead of lightweight Java monitors")           \
                                                                             \
+  experimental(bool, UseLockStack, false,                                   \
+          "Record the objects a thread has locked on a per-thread lock "    \
+          "stack instead of displacing their headers to the thread's "      \
+          "stack. Disables biased locking")                                 \
+                                                                            \
   product(bool, PrintStringTableStatistics, false,                          \
           "print statistics about the StringTable and SymbolTable")         \
                                                                             \
@@ -2390,6 +2399,11 @@ const size_t minimumSymbolTableSize = 1024;
           "Number of buckets in the JVM internal Symbol table")             \
           range(minimumSymbolTableSize, 16777216ul /* 2^24 */)              \
                                                                             \
+  experimental(uint, ConcurrentTableResizeThreads, 0,                       \
+          "Number of worker threads the service thread uses to grow and "   \
+          "clean large String and Symbol tables (0 means serial)")          \
+          range(0, 64)                                                      \
+                                                                            \
   product(bool, UseStringDeduplication, false,                              \
           "Use string deduplication")                                       \
                                                                             \
@@ -290,10 +290,9 @@ size_t JNIHandles::weak_global_handle_memory_usage() {
 }
 
 
-// We assume this is called at a safepoint: no lock is needed.
+// No lock is needed. The counts are only exact at a safepoint; concurrent
+// thread dumps print them without one.
 void JNIHandles::print_on(outputStream* st) {
-  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
-
   st->print_cr("JNI global refs: " SIZE_FORMAT ", weak refs: " SIZE_FORMAT,
                global_handles()->allocation_count(),
                weak_global_handles()->allocation_count());
@@ -364,14 +363,53 @@ void JNIHandleBlock::zap() {
 }
 #endif // ASSERT
 
+// Allocates n contiguous, zapped blocks linked with _next. Blocks
+// are never freed, so they are allocated in batches to reduce the
+// number of malloc calls and keep a thread's blocks close together.
+JNIHandleBlock* JNIHandleBlock::new_blocks(int n) {
+  assert_lock_strong(JNIHandleBlockFreeList_lock);
+  JNIHandleBlock* blocks = new JNIHandleBlock[n]();
+  _blocks_allocated += n;
+  for (int i = 0; i < n; i++) {
+    JNIHandleBlock* block = &blocks[i];
+    block->zap();
+    block->_next = (i + 1 < n) ? &blocks[i + 1] : NULL;
+    block->_pop_frame_link = NULL;
+    #ifndef PRODUCT
+    // Link new block to list of all allocated blocks
+    block->_block_list_link = _block_list;
+    _block_list = block;
+    #endif
+  }
+  return blocks;
+}
+
+JNIHandleBlock* JNIHandleBlock::take_thread_free_block(Thread* thread) {
+  JNIHandleBlock* block = thread->free_handle_block();
+  assert(block != NULL, "must have a free block");
+  JNIHandleBlock* next = block->_next;
+  if (next != NULL) {
+    // The rest of this chain becomes the first chain
+    next->_pop_frame_link = block->_pop_frame_link;
+    thread->set_free_handle_block(next);
+  } else {
+    thread->set_free_handle_block(block->_pop_frame_link);
+  }
+  return block;
+}
+
+void JNIHandleBlock::add_thread_free_blocks(Thread* thread, JNIHandleBlock* chain) {
+  chain->_pop_frame_link = thread->free_handle_block();
+  thread->set_free_handle_block(chain);
+}
+
 JNIHandleBlock* JNIHandleBlock::allocate_block(Thread* thread)  {
   assert(thread == NULL || thread == Thread::current(), "sanity check");
   JNIHandleBlock* block;
   // Check the thread-local free list for a block so we don't
   // have to acquire a mutex.
   if (thread != NULL && thread->free_handle_block() != NULL) {
-    block = thread->free_handle_block();
-    thread->set_free_handle_block(block->_next);
+    block = take_thread_free_block(thread);
   }
   else {
     // locking with safepoint checking introduces a potential deadlock:
@@ -380,20 +418,32 @@ JNIHandleBlock* JNIHandleBlock::allocate_block(Thread* thread)  {
     //   JNIHandleBlockFreeList_lock (JNIHandleBlock::allocate_block)
     MutexLocker ml(JNIHandleBlockFreeList_lock,
                    Mutex::_no_safepoint_check_flag);
-    if (_block_free_list == NULL) {
-      // Allocate new block
-      block = new JNIHandleBlock();
-      _blocks_allocated++;
-      block->zap();
-      #ifndef PRODUCT
-      // Link new block to list of all allocated blocks
-      block->_block_list_link = _block_list;
-      _block_list = block;
-      #endif
+    if (thread == NULL) {
+      if (_block_free_list == NULL) {
+        // Allocate new block
+        block = new_blocks(1);
+      } else {
+        // Get block from free list
+        block = _block_free_list;
+        _block_free_list = _block_free_list->_next;
+      }
     } else {
-      // Get block from free list
-      block = _block_free_list;
-      _block_free_list = _block_free_list->_next;
+      // Refill the thread-local free list with up to block_batch_size
+      // blocks so the next allocations by this thread don't need the lock.
+      JNIHandleBlock* chain = _block_free_list;
+      if (chain == NULL) {
+        chain = new_blocks(block_batch_size);
+      } else {
+        JNIHandleBlock* last = chain;
+        for (int i = 1; i < block_batch_size && last->_next != NULL; i++) {
+          last = last->_next;
+        }
+        _block_free_list = last->_next;
+        last->_next = NULL;
+      }
+      chain->_pop_frame_link = NULL;
+      add_thread_free_blocks(thread, chain);
+      block = take_thread_free_block(thread);
     }
   }
   block->_top = 0;
@@ -410,45 +460,37 @@ JNIHandleBlock* JNIHandleBlock::allocate_block(Thread* thread)  {
 
 void JNIHandleBlock::release_block(JNIHandleBlock* block, Thread* thread) {
   assert(thread == NULL || thread == Thread::current(), "sanity check");
-  JNIHandleBlock* pop_frame_link = block->pop_frame_link();
-  // Put returned block at the beginning of the thread-local free list.
-  // Note that if thread == NULL, we use it as an implicit argument that
-  // we _don't_ want the block to be kept on the free_handle_block.
-  // See for instance JavaThread::exit().
-  if (thread != NULL ) {
-    block->zap();
-    JNIHandleBlock* freelist = thread->free_handle_block();
-    block->_pop_frame_link = NULL;
-    thread->set_free_handle_block(block);
-
-    // Add original freelist to end of chain
-    if ( freelist != NULL ) {
-      while ( block->_next != NULL ) block = block->_next;
-      block->_next = freelist;
-    }
-    block = NULL;
-  }
-  if (block != NULL) {
-    // Return blocks to free list
-    // locking with safepoint checking introduces a potential deadlock:
-    // - we would hold JNIHandleBlockFreeList_lock and then Threads_lock
-    // - another would hold Threads_lock (jni_AttachCurrentThread) and then
-    //   JNIHandleBlockFreeList_lock (JNIHandleBlock::allocate_block)
-    MutexLocker ml(JNIHandleBlockFreeList_lock,
-                   Mutex::_no_safepoint_check_flag);
-    while (block != NULL) {
+  // Release the chain and, as a sanity check, the chains linked by
+  // _pop_frame_link. Blocks should never be linked that way (only if
+  // PopLocalFrame is not called the correct number of times), except
+  // on the thread-local free list released by JavaThread::exit().
+  while (block != NULL) {
+    JNIHandleBlock* pop_frame_link = block->pop_frame_link();
+    // Put returned chain at the beginning of the thread-local free list.
+    // Note that if thread == NULL, we use it as an implicit argument that
+    // we _don't_ want the block to be kept on the free_handle_block.
+    // See for instance JavaThread::exit().
+    if (thread != NULL) {
       block->zap();
-      JNIHandleBlock* next = block->_next;
-      block->_next = _block_free_list;
-      _block_free_list = block;
-      block = next;
+      add_thread_free_blocks(thread, block);
+    } else {
+      // Return blocks to free list
+      // locking with safepoint checking introduces a potential deadlock:
+      // - we would hold JNIHandleBlockFreeList_lock and then Threads_lock
+      // - another would hold Threads_lock (jni_AttachCurrentThread) and then
+      //   JNIHandleBlockFreeList_lock (JNIHandleBlock::allocate_block)
+      MutexLocker ml(JNIHandleBlockFreeList_lock,
+                     Mutex::_no_safepoint_check_flag);
+      while (block != NULL) {
+        block->zap();
+        JNIHandleBlock* next = block->_next;
+        block->_pop_frame_link = NULL;
+        block->_next = _block_free_list;
+        _block_free_list = block;
+        block = next;
+      }
     }
-  }
-  if (pop_frame_link != NULL) {
-    // As a sanity check we release blocks pointed to by the pop_frame_link.
-    // This should never happen (only if PopLocalFrame is not called the
-    // correct number of times).
-    release_block(pop_frame_link, thread);
+    block = pop_frame_link;
   }
 }
 
@@ -482,7 +524,7 @@ void JNIHandleBlock::oops_do(OopClosure* f) {
 }
 
 
-jobject JNIHandleBlock::allocate_handle(oop obj) {
+jobject JNIHandleBlock::allocate_handle_slow(oop obj) {
   assert(Universe::heap()->is_in(obj), "sanity check");
   if (_top == 0) {
     // This is the first allocation or the initial block got zapped when
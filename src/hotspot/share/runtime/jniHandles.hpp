@@ -136,7 +136,8 @@ class JNIHandleBlock : public CHeapObj<mtInternal> {
 
  private:
   enum SomeConstants {
-    block_size_in_oops  = 32                    // Number of handles per handle block
+    block_size_in_oops  = 32,                   // Number of handles per handle block
+    block_batch_size    = 8                     // Number of blocks moved to a thread's free list at once
   };
 
   uintptr_t       _handles[block_size_in_oops]; // The handles
@@ -167,12 +168,24 @@ class JNIHandleBlock : public CHeapObj<mtInternal> {
   // Free list computation
   void rebuild_free_list();
 
+  // Slow path of allocate_handle(): (re)initialize the chain, use the
+  // free list or append a new block
+  jobject allocate_handle_slow(oop obj);
+
+  // Thread-local pool of free blocks. It is a list of chains: blocks of
+  // a chain are linked with _next, and the first block of each chain
+  // links to the next chain with _pop_frame_link, so releasing a chain
+  // or popping a local frame never walks the blocks.
+  static JNIHandleBlock* take_thread_free_block(Thread* thread);
+  static void add_thread_free_blocks(Thread* thread, JNIHandleBlock* chain);
+  static JNIHandleBlock* new_blocks(int n);
+
   // No more handles in the both the current and following blocks
   void clear() { _top = 0; }
 
  public:
   // Handle allocation
-  jobject allocate_handle(oop obj);
+  inline jobject allocate_handle(oop obj);
 
   // Block allocation and block free list management
   static JNIHandleBlock* allocate_block(Thread* thread = NULL);
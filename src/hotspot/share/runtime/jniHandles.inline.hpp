@@ -94,6 +94,17 @@ inline oop JNIHandles::resolve_non_null(jobject handle) {
   return result;
 }
 
+inline jobject JNIHandleBlock::allocate_handle(oop obj) {
+  // Fast path: the chain is initialized and its last block has room.
+  // _top of the first block is reset to 0 on every native method entry.
+  if (_top != 0 && _last->_top < block_size_in_oops) {
+    oop* handle = (oop*)&(_last->_handles)[_last->_top++];
+    NativeAccess<IS_DEST_UNINITIALIZED>::oop_store(handle, obj);
+    return (jobject) handle;
+  }
+  return allocate_handle_slow(obj);
+}
+
 inline void JNIHandles::destroy_local(jobject handle) {
   if (handle != NULL) {
     assert(!is_jweak(handle), "Invalid JNI local handle");
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026 SAP SE. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "memory/iterator.hpp"
+#include "oops/oop.inline.hpp"
+#include "runtime/lockStack.hpp"
+#include "utilities/ostream.hpp"
+
+void LockStack::remove_last(oop o) {
+  for (int i = _top - 1; i >= 0; i--) {
+    if (_base[i] == o) {
+      for (int j = i + 1; j < _top; j++) {
+        _base[j - 1] = _base[j];
+      }
+      _top--;
+      return;
+    }
+  }
+  assert(false, "object not on the lock stack");
+}
+
+int LockStack::remove_all(oop o) {
+  int kept = 0;
+  for (int i = 0; i < _top; i++) {
+    if (_base[i] != o) {
+      _base[kept++] = _base[i];
+    }
+  }
+  int removed = _top - kept;
+  _top = kept;
+  return removed;
+}
+
+void LockStack::oops_do(OopClosure* f) {
+  for (int i = 0; i < _top; i++) {
+    f->do_oop(&_base[i]);
+  }
+}
+
+void LockStack::print_on(outputStream* st) const {
+  for (int i = _top - 1; i >= 0; i--) {
+    st->print("LockStack[%d]: ", i);
+    oop o = _base[i];
+    if (oopDesc::is_oop(o)) {
+      o->print_value_on(st);
+      st->cr();
+    } else {
+      st->print_cr("not an oop: " PTR_FORMAT, p2i(o));
+    }
+  }
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026 SAP SE. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_RUNTIME_LOCKSTACK_HPP
+#define SHARE_RUNTIME_LOCKSTACK_HPP
+
+#include "oops/oopsHierarchy.hpp"
+#include "utilities/debug.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class OopClosure;
+class outputStream;
+
+// With UseLockStack, the objects a JavaThread has fast-locked are
+// recorded here instead of in displaced headers on its stack. An object
+// that is locked recursively has one entry per monitorenter. The stack
+// is small; once it is full, further locks are inflated.
+//
+// Only the owning thread pushes and removes entries. Other threads may
+// read them to find the owner of a fast-locked object; the answer is
+// only stable at a safepoint or while the owner is suspended.
+class LockStack {
+  friend class VMStructs;
+ public:
+  static const int CAPACITY = 8;
+
+ private:
+  int _top;
+  oop _base[CAPACITY];
+
+ public:
+  LockStack() : _top(0) {}
+
+  int  size() const     { return _top; }
+  bool is_empty() const { return _top == 0; }
+  bool is_full() const  { return _top == CAPACITY; }
+
+  void push(oop o) {
+    assert(!is_full(), "lock stack overflow");
+    _base[_top++] = o;
+  }
+
+  bool contains(oop o) const {
+    for (int i = _top - 1; i >= 0; i--) {
+      if (_base[i] == o) return true;
+    }
+    return false;
+  }
+
+  // Number of entries for o, i.e. how many times the owner entered it
+  int count(oop o) const {
+    int n = 0;
+    for (int i = 0; i < _top; i++) {
+      if (_base[i] == o) n++;
+    }
+    return n;
+  }
+
+  // Removes the most recent entry for o. Monitors are usually, but not
+  // always, exited in the reverse order of entering them.
+  void remove_last(oop o);
+  // Removes all entries for o and returns how many there were
+  int remove_all(oop o);
+
+  void oops_do(OopClosure* f);
+  void print_on(outputStream* st) const;
+};
+
+#endif // SHARE_RUNTIME_LOCKSTACK_HPP
@@ -46,6 +46,7 @@ Mutex*   SharedDictionary_lock        = NULL;
 Mutex*   Module_lock                  = NULL;
 Mutex*   CompiledIC_lock              = NULL;
 Mutex*   InlineCacheBuffer_lock       = NULL;
+Mutex*   InlineCacheRefill_lock       = NULL;
 Mutex*   VMStatistic_lock             = NULL;
 Mutex*   JNIHandleBlockFreeList_lock  = NULL;
 Mutex*   JmethodIdCreation_lock       = NULL;
@@ -298,6 +299,7 @@ void mutex_init() {
   def(Management_lock              , PaddedMutex  , nonleaf+2,   false, _safepoint_check_always); // used for JVM management
 
   def(Compile_lock                 , PaddedMutex  , nonleaf+3,   false, _safepoint_check_always);
+  def(InlineCacheRefill_lock       , PaddedMutex  , nonleaf+3,   false, _safepoint_check_always);     // locks CompiledIC_lock, InlineCacheBuffer_lock
   def(MethodData_lock              , PaddedMutex  , nonleaf+3,   false, _safepoint_check_always);
   def(TouchedMethodLog_lock        , PaddedMutex  , nonleaf+3,   false, _safepoint_check_always);
 
@@ -39,6 +39,7 @@ extern Mutex*   SharedDictionary_lock;           // a lock on the CDS shared dic
 extern Mutex*   Module_lock;                     // a lock on module and package related data structures
 extern Mutex*   CompiledIC_lock;                 // a lock used to guard compiled IC patching and access
 extern Mutex*   InlineCacheBuffer_lock;          // a lock used to guard the InlineCacheBuffer
+extern Mutex*   InlineCacheRefill_lock;          // a lock used to serialize InlineCacheBuffer refills without safepoints
 extern Mutex*   VMStatistic_lock;                // a lock used to guard statistics count increment
 extern Mutex*   JNIHandleBlockFreeList_lock;     // a lock on the JNI handle block free list
 extern Mutex*   JmethodIdCreation_lock;          // a lock on creating JNI method identifiers
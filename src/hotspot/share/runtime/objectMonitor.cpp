@@ -114,6 +114,8 @@ static int Knob_PreSpin             = 10;      // 20-100 likely better
 
 DEBUG_ONLY(static volatile bool InitDone = false;)
 
+void* const ObjectMonitor::ANONYMOUS_OWNER = reinterpret_cast<void*>(1);
+
 // -----------------------------------------------------------------------------
 // Theory of operations -- Monitors lists, thread residency, etc:
 //
@@ -257,7 +259,15 @@ void ObjectMonitor::enter(TRAPS) {
     return;
   }
 
-  if (Self->is_lock_owned((address)cur)) {
+  if (cur == ANONYMOUS_OWNER) {
+    // UseLockStack: the monitor was inflated over a fast-lock of another
+    // thread, which has not claimed it yet. ObjectSynchronizer::inflate()
+    // claims it for the owner, so it cannot be us. The value is not a
+    // thread or a BasicLock address; treat it as plain contention.
+    assert(!Self->is_Java_thread() ||
+           !((JavaThread*)Self)->lock_stack().contains((oop)object()),
+           "owner must have claimed the monitor");
+  } else if (Self->is_lock_owned((address)cur)) {
     assert(_recursions == 0, "internal state error");
     _recursions = 1;
     // Commute owner from a thread-specific on-stack BasicLockObject address to
@@ -1632,7 +1642,11 @@ int ObjectMonitor::TrySpin(Thread * Self) {
   ctr = _SpinDuration;
   if (ctr <= 0) return 0;
 
-  if (NotRunnable(Self, (Thread *) _owner)) {
+  // An anonymous owner (UseLockStack) is not a thread, so we cannot tell
+  // whether it is running. It also has to come through the slow path to
+  // claim the monitor before it can release it, so don't spin on it.
+  void* owner = _owner;
+  if (owner == ANONYMOUS_OWNER || NotRunnable(Self, (Thread *) owner)) {
     return 0;
   }
 
@@ -1678,7 +1692,11 @@ int ObjectMonitor::TrySpin(Thread * Self) {
     // the spin without prejudice or apply a "penalty" to the
     // spin count-down variable "ctr", reducing it by 100, say.
 
-    Thread * ox = (Thread *) _owner;
+    void * const cur = _owner;
+    if (cur == ANONYMOUS_OWNER) {
+      goto Abort;
+    }
+    Thread * ox = (Thread *) cur;
     if (ox == NULL) {
       ox = (Thread*)Atomic::cmpxchg(&_owner, (void*)NULL, Self);
       if (ox == NULL) {
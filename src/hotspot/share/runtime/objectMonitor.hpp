@@ -234,6 +234,13 @@ class ObjectMonitor {
   void*     owner() const;
   void      set_owner(void* owner);
 
+  // With UseLockStack, a monitor that is inflated over a fast-locked
+  // object by a thread other than the owner gets an anonymous owner.
+  // The owner, which has the object on its lock stack, claims the
+  // monitor the next time it inflates the object.
+  static void* const ANONYMOUS_OWNER;
+  bool      is_owner_anonymous() const { return _owner == ANONYMOUS_OWNER; }
+
   jint      waiters() const;
 
   jint      contentions() const;
@@ -155,6 +155,18 @@ static volatile int g_om_population = 0;  // # Extant -- in circulation
 // the monitorexit operation.  In that case the JIT could fuse the operations
 // into a single notifyAndExit() runtime primitive.
 
+// Returns true if mark, read from obj, shows that obj is fast-locked
+// (UseLockStack) or stack-locked by self.
+static bool is_locked_by(Thread* self, oop obj, markWord mark) {
+  if (!mark.has_locker()) {
+    return false;
+  }
+  if (UseLockStack) {
+    return self->is_Java_thread() && ((JavaThread*)self)->lock_stack().contains(obj);
+  }
+  return self->is_lock_owned((address)mark.locker());
+}
+
 bool ObjectSynchronizer::quick_notify(oopDesc* obj, Thread* self, bool all) {
   assert(!SafepointSynchronize::is_at_safepoint(), "invariant");
   assert(self->is_Java_thread(), "invariant");
@@ -163,7 +175,7 @@ bool ObjectSynchronizer::quick_notify(oopDesc* obj, Thread* self, bool all) {
   if (obj == NULL) return false;  // slow-path for invalid obj
   const markWord mark = obj->mark();
 
-  if (mark.has_locker() && self->is_lock_owned((address)mark.locker())) {
+  if (is_locked_by(self, obj, mark)) {
     // Degenerate notify
     // stack-locked by caller so by definition the implied waitset is empty.
     return true;
@@ -274,6 +286,26 @@ void ObjectSynchronizer::enter(Handle obj, BasicLock* lock, TRAPS) {
   markWord mark = obj->mark();
   assert(!mark.has_bias_pattern(), "should not see bias pattern here");
 
+  if (UseLockStack && THREAD->is_Java_thread()) {
+    // The BasicLock is not used; see the comment at the end.
+    lock->set_displaced_header(markWord::unused_mark());
+    LockStack& lock_stack = ((JavaThread*)THREAD)->lock_stack();
+    if (!lock_stack.is_full()) {
+      if (mark.is_neutral()) {
+        if (mark == obj()->cas_set_mark(mark.set_fast_locked(), mark)) {
+          lock_stack.push(obj());
+          return;
+        }
+      } else if (mark.is_fast_locked() && lock_stack.contains(obj())) {
+        // Recursive enter, only the owner can see its own entries.
+        lock_stack.push(obj());
+        return;
+      }
+    }
+    inflate(THREAD, obj(), inflate_cause_monitor_enter)->enter(THREAD);
+    return;
+  }
+
   if (mark.is_neutral()) {
     // Anticipate successful CAS -- the ST of the displaced mark must
     // be visible <= the ST performed by the CAS.
@@ -300,6 +332,29 @@ void ObjectSynchronizer::enter(Handle obj, BasicLock* lock, TRAPS) {
 
 void ObjectSynchronizer::exit(oop object, BasicLock* lock, TRAPS) {
   markWord mark = object->mark();
+
+  if (UseLockStack && THREAD->is_Java_thread()) {
+    LockStack& lock_stack = ((JavaThread*)THREAD)->lock_stack();
+    int count = lock_stack.count(object);
+    if (count > 1) {
+      // Recursive exit. This also holds if another thread inflated the
+      // object in the meantime: the monitor stays anonymously owned
+      // until we inflate it ourselves.
+      lock_stack.remove_last(object);
+      return;
+    }
+    if (count == 1 && mark.is_fast_locked()) {
+      if (object->cas_set_mark(mark.clear_fast_locked(), mark) == mark) {
+        lock_stack.remove_all(object);
+        return;
+      }
+    }
+    // Contended or inflated: inflate() hands an anonymously owned
+    // monitor over to us before we exit it.
+    inflate(THREAD, object, inflate_cause_vm_internal)->exit(true, THREAD);
+    return;
+  }
+
   // We cannot check for Biased Locking if we are racing an inflation.
   assert(mark == markWord::INFLATING() ||
          !mark.has_bias_pattern(), "should not see bias pattern here");
@@ -475,7 +530,7 @@ void ObjectSynchronizer::notify(Handle obj, TRAPS) {
   }
 
   markWord mark = obj->mark();
-  if (mark.has_locker() && THREAD->is_lock_owned((address)mark.locker())) {
+  if (is_locked_by(THREAD, obj(), mark)) {
     return;
   }
   inflate(THREAD, obj(), inflate_cause_notify)->notify(THREAD);
@@ -489,7 +544,7 @@ void ObjectSynchronizer::notifyall(Handle obj, TRAPS) {
   }
 
   markWord mark = obj->mark();
-  if (mark.has_locker() && THREAD->is_lock_owned((address)mark.locker())) {
+  if (is_locked_by(THREAD, obj(), mark)) {
     return;
   }
   inflate(THREAD, obj(), inflate_cause_notify)->notifyAll(THREAD);
@@ -719,6 +774,14 @@ intptr_t ObjectSynchronizer::FastHashCode(Thread* self, oop obj) {
     }
     // Fall thru so we only have one place that installs the hash in
     // the ObjectMonitor.
+  } else if (UseLockStack) {
+    // Fast-locked, the header is still in place. Only the owner may
+    // modify it, so we inflate to install a new hash.
+    assert(mark.is_fast_locked(), "invariant");
+    hash = mark.hash();
+    if (hash != 0) {
+      return hash;
+    }
   } else if (self->is_lock_owned((address)mark.locker())) {
     // This is a stack lock owned by the calling thread so fetch the
     // displaced markWord from the BasicLock on the stack.
@@ -786,11 +849,14 @@ bool ObjectSynchronizer::current_thread_holds_lock(JavaThread* thread,
 
   // Uncontended case, header points to stack
   if (mark.has_locker()) {
-    return thread->is_lock_owned((address)mark.locker());
+    return is_locked_by(thread, obj, mark);
   }
   // Contended case, header points to ObjectMonitor (tagged pointer)
   if (mark.has_monitor()) {
     ObjectMonitor* monitor = mark.monitor();
+    if (UseLockStack && monitor->is_owner_anonymous()) {
+      return thread->lock_stack().contains(obj);
+    }
     return monitor->is_entered(thread) != 0;
   }
   // Unlocked case, header in place
@@ -825,8 +891,7 @@ ObjectSynchronizer::LockOwnership ObjectSynchronizer::query_lock_ownership
 
   // CASE: stack-locked.  Mark points to a BasicLock on the owner's stack.
   if (mark.has_locker()) {
-    return self->is_lock_owned((address)mark.locker()) ?
-      owner_self : owner_other;
+    return is_locked_by(self, obj, mark) ? owner_self : owner_other;
   }
 
   // CASE: inflated. Mark (tagged pointer) points to an ObjectMonitor.
@@ -835,6 +900,9 @@ ObjectSynchronizer::LockOwnership ObjectSynchronizer::query_lock_ownership
   if (mark.has_monitor()) {
     void* owner = mark.monitor()->_owner;
     if (owner == NULL) return owner_none;
+    if (UseLockStack && owner == ObjectMonitor::ANONYMOUS_OWNER) {
+      return self->lock_stack().contains(obj) ? owner_self : owner_other;
+    }
     return (owner == self ||
             self->is_lock_owned((address)owner)) ? owner_self : owner_other;
   }
@@ -862,6 +930,9 @@ JavaThread* ObjectSynchronizer::get_lock_owner(ThreadsList * t_list, Handle h_ob
 
   // Uncontended case, header points to stack
   if (mark.has_locker()) {
+    if (UseLockStack) {
+      return Threads::owning_thread_from_object(t_list, obj);
+    }
     owner = (address) mark.locker();
   }
 
@@ -869,7 +940,7 @@ JavaThread* ObjectSynchronizer::get_lock_owner(ThreadsList * t_list, Handle h_ob
   else if (mark.has_monitor()) {
     ObjectMonitor* monitor = mark.monitor();
     assert(monitor != NULL, "monitor should be non-null");
-    owner = (address) monitor->owner();
+    return Threads::owning_thread_from_monitor(t_list, monitor);
   }
 
   if (owner != NULL) {
@@ -1311,6 +1382,15 @@ ObjectMonitor* ObjectSynchronizer::inflate(Thread* self,
       assert(dmw.is_neutral(), "invariant: header=" INTPTR_FORMAT, dmw.value());
       assert(inf->object() == object, "invariant");
       assert(ObjectSynchronizer::verify_objmon_isinpool(inf), "monitor is invalid");
+      if (UseLockStack && inf->is_owner_anonymous() && self->is_Java_thread()) {
+        // Another thread inflated over our fast-lock. Claim the monitor
+        // and move the recursive entries off the lock stack.
+        LockStack& lock_stack = ((JavaThread*)self)->lock_stack();
+        if (lock_stack.contains(object)) {
+          inf->set_owner(self);
+          inf->_recursions = lock_stack.remove_all(object) - 1;
+        }
+      }
       return inf;
     }
 
@@ -1346,6 +1426,56 @@ ObjectMonitor* ObjectSynchronizer::inflate(Thread* self,
 
     LogStreamHandle(Trace, monitorinflation) lsh;
 
+    // CASE: fast-locked (UseLockStack)
+    // The header is still in place, so the mark can be swung directly
+    // to the monitor; there is no displaced header that must be kept
+    // stable with INFLATING. A fast-locked mark is never INFLATING. If the object is on our own lock stack we
+    // become the owner, otherwise the owner stays anonymous until the
+    // owning thread inflates the object itself.
+    if (UseLockStack && mark.is_fast_locked()) {
+      ObjectMonitor* m = om_alloc(self);
+      m->Recycle();
+      m->_Responsible  = NULL;
+      m->_SpinDuration = ObjectMonitor::Knob_SpinLimit;
+      m->set_header(mark.clear_fast_locked());
+      m->set_object(object);
+
+      LockStack* lock_stack = NULL;
+      if (self->is_Java_thread() &&
+          ((JavaThread*)self)->lock_stack().contains(object)) {
+        lock_stack = &((JavaThread*)self)->lock_stack();
+        m->set_owner(self);
+        m->_recursions = lock_stack->count(object) - 1;
+      } else {
+        m->set_owner(ObjectMonitor::ANONYMOUS_OWNER);
+      }
+
+      if (object->cas_set_mark(markWord::encode(m), mark) != mark) {
+        m->set_header(markWord::zero());
+        m->set_owner(NULL);
+        m->_recursions = 0;
+        m->set_object(NULL);
+        m->Recycle();
+        om_release(self, m, true);
+        continue;       // Interference -- just retry
+      }
+      if (lock_stack != NULL) {
+        lock_stack->remove_all(object);
+      }
+
+      OM_PERFDATA_OP(Inflations, inc());
+      if (log_is_enabled(Trace, monitorinflation)) {
+        ResourceMark rm(self);
+        lsh.print_cr("inflate(fast_locked): object=" INTPTR_FORMAT ", mark="
+                     INTPTR_FORMAT ", type='%s'", p2i(object),
+                     object->mark().value(), object->klass()->external_name());
+      }
+      if (event.should_commit()) {
+        post_monitor_inflate_event(&event, object, cause);
+      }
+      return m;
+    }
+
     if (mark.has_locker()) {
       ObjectMonitor* m = om_alloc(self);
       // Optimistically prepare the objectmonitor - anticipate successful CAS
@@ -464,6 +464,9 @@ Thread::~Thread() {
   delete handle_area();
   delete metadata_handles();
 
+  // Chunks freed from now on go straight back to the pools.
+  _chunk_pool_cache.disable();
+
   // SR_handler uses this as a termination indicator -
   // needs to happen before os::free_thread()
   delete _SR_lock;
@@ -2972,6 +2975,9 @@ void JavaThread::oops_do(OopClosure* f, CodeBlobClosure* cf) {
   assert((!has_last_Java_frame() && java_call_counter() == 0) ||
          (has_last_Java_frame() && java_call_counter() > 0), "wrong java_sp info!");
 
+  // Traverse the objects locked with UseLockStack
+  _lock_stack.oops_do(f);
+
   if (has_last_Java_frame()) {
     // Record JavaThread to GC thread
     RememberProcessedThread rpt(this);
@@ -3496,6 +3502,9 @@ CompilerThread::CompilerThread(CompileQueue* queue,
   // Compiler uses resource area for compilation, let's bias it to mtCompiler
   resource_area()->bias_to(mtCompiler);
 
+  // Compilations allocate and free lots of arena chunks.
+  chunk_pool_cache()->enable();
+
 #ifndef PRODUCT
   _ideal_graph_printer = NULL;
 #endif
@@ -4725,7 +4734,7 @@ JavaThread *Threads::owning_thread_from_monitor_owner(ThreadsList * t_list,
   // Cannot assert on lack of success here since this function may be
   // used by code that is trying to report useful problem information
   // like deadlock detection.
-  if (UseHeavyMonitors) return NULL;
+  if (UseHeavyMonitors || UseLockStack) return NULL;
 
   // If we didn't find a matching Java thread and we didn't force use of
   // heavyweight monitors, then the owner is the stack address of the
@@ -4743,6 +4752,25 @@ JavaThread *Threads::owning_thread_from_monitor_owner(ThreadsList * t_list,
   return the_owner;
 }
 
+JavaThread *Threads::owning_thread_from_monitor(ThreadsList * t_list,
+                                                ObjectMonitor* monitor) {
+  if (UseLockStack && monitor->is_owner_anonymous()) {
+    return owning_thread_from_object(t_list, (oop)monitor->object());
+  }
+  return owning_thread_from_monitor_owner(t_list, (address)monitor->owner());
+}
+
+JavaThread *Threads::owning_thread_from_object(ThreadsList * t_list, oop obj) {
+  assert(UseLockStack, "only with lock stacks");
+  DO_JAVA_THREADS(t_list, q) {
+    if (q->lock_stack().contains(obj)) {
+      return q;
+    }
+  }
+  // cannot assert on lack of success here; see above comment
+  return NULL;
+}
+
 // Threads::print_on() is called at safepoint by VM_PrintThreads operation.
 void Threads::print_on(outputStream* st, bool print_stacks,
                        bool internal_format, bool print_concurrent_locks,
@@ -4785,6 +4813,11 @@ void Threads::print_on(outputStream* st, bool print_stacks,
 #endif // INCLUDE_SERVICES
   }
 
+  print_non_java_threads_on(st);
+  st->flush();
+}
+
+void Threads::print_non_java_threads_on(outputStream* st) {
   VMThread::vm_thread()->print_on(st);
   st->cr();
   Universe::heap()->print_gc_threads_on(st);
@@ -4800,7 +4833,55 @@ void Threads::print_on(outputStream* st, bool print_stacks,
     stathist_sampler_thread->print_on(st);
     st->cr();
   }
+}
+
+class PrintThreadClosure : public HandshakeClosure {
+  outputStream* _st;
+  bool _print_extended_info;
+public:
+  PrintThreadClosure(outputStream* st, bool print_extended_info) :
+    HandshakeClosure("PrintThread"), _st(st), _print_extended_info(print_extended_info) {}
+
+  void do_thread(Thread* thr) {
+    JavaThread* jt = (JavaThread*)thr;
+    ResourceMark rm;
+    jt->print_on(_st, _print_extended_info);
+    jt->print_stack_on(_st);
+    _st->cr();
+  }
+};
+
+// Same output as print_on() with stacks, but without stopping all threads
+// at a safepoint. The Java threads are taken from a ThreadsListHandle
+// snapshot and each one is printed in a handshake with that thread only.
+// The stacks are therefore not taken at the same instant, and
+// java.util.concurrent locks, which need a heap walk, are not printed.
+void Threads::print_on_with_handshakes(outputStream* st, bool print_extended_info) {
+  assert(SafepointMechanism::uses_thread_local_poll(),
+         "each handshake would be a safepoint, use VM_PrintThreads instead");
+  char buf[32];
+  st->print_raw_cr(os::local_time_string(buf, sizeof(buf)));
+
+  st->print_cr("Full thread dump %s (%s %s):",
+               VM_Version::vm_name(),
+               VM_Version::vm_release(),
+               VM_Version::vm_info_string());
+  st->cr();
+
+  ThreadsSMRSupport::print_info_on(st);
+  st->cr();
+
+  PrintThreadClosure ptc(st, print_extended_info);
+  ThreadsListHandle tlh;
+  for (uint i = 0; i < tlh.length(); i++) {
+    // threads that exited in the meantime are skipped
+    Handshake::execute(&ptc, tlh.thread_at(i));
+    // no locks are held between the handshakes, so the stacks printed so
+    // far can go to an attach client
+    AttachListener::send_partial_output(st);
+  }
 
+  print_non_java_threads_on(st);
   st->flush();
 }
 
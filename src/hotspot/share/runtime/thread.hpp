@@ -30,6 +30,7 @@
 #include "gc/shared/gcThreadLocalData.hpp"
 #include "gc/shared/threadLocalAllocBuffer.hpp"
 #include "memory/allocation.hpp"
+#include "memory/arena.hpp"
 #include "oops/oop.hpp"
 #include "prims/jvmtiExport.hpp"
 #include "runtime/frame.hpp"
@@ -37,6 +38,7 @@
 #include "runtime/handshake.hpp"
 #include "runtime/javaFrameAnchor.hpp"
 #include "runtime/jniHandles.hpp"
+#include "runtime/lockStack.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
 #include "runtime/osThread.hpp"
@@ -176,7 +178,7 @@ class Thread: public ThreadShadow {
 
   // JavaThread lifecycle support:
   friend class SafeThreadsListPtr;  // for _threads_list_ptr, cmpxchg_threads_hazard_ptr(), {dec_,inc_,}nested_threads_hazard_ptr_cnt(), {g,s}et_threads_hazard_ptr(), inc_nested_handle_cnt(), tag_hazard_ptr() access
-  friend class ScanHazardPtrGatherProtectedThreadsClosure;  // for cmpxchg_threads_hazard_ptr(), get_threads_hazard_ptr(), is_hazard_ptr_tagged() access
+  friend class ScanHazardPtrFindProtectedThreadClosure;  // for cmpxchg_threads_hazard_ptr(), get_threads_hazard_ptr(), is_hazard_ptr_tagged() access
   friend class ScanHazardPtrGatherThreadsListClosure;  // for get_threads_hazard_ptr(), untag_hazard_ptr() access
   friend class ScanHazardPtrPrintMatchingThreadsClosure;  // for get_threads_hazard_ptr(), is_hazard_ptr_tagged() access
   friend class ThreadsSMRSupport;  // for _nested_threads_hazard_ptr_cnt, _threads_hazard_ptr, _threads_list_ptr access
@@ -582,6 +584,9 @@ class Thread: public ThreadShadow {
   ResourceArea* resource_area() const            { return _resource_area; }
   void set_resource_area(ResourceArea* area)     { _resource_area = area; }
 
+  // Arena chunk cache, only enabled for some threads
+  ChunkPoolCache* chunk_pool_cache()             { return &_chunk_pool_cache; }
+
   OSThread* osthread() const                     { return _osthread;   }
   void set_osthread(OSThread* thread)            { _osthread = thread; }
 
@@ -706,6 +711,9 @@ protected:
   // Thread local resource area for temporary allocation within the VM
   ResourceArea* _resource_area;
 
+  // Thread local cache of arena chunks, see ChunkPoolCache
+  ChunkPoolCache _chunk_pool_cache;
+
   DEBUG_ONLY(ResourceMark* _current_resource_mark;)
 
   // Thread local handle area for allocation of handles within the VM
@@ -1054,6 +1062,8 @@ class JavaThread: public Thread {
                                                  // allocated during deoptimization
                                                  // and by JNI_MonitorEnter/Exit
 
+  LockStack _lock_stack;                         // Objects locked with UseLockStack
+
   // Async. requests support
   enum AsyncRequests {
     _no_async_condition = 0,
@@ -1826,6 +1836,8 @@ class JavaThread: public Thread {
 
  public:
   MonitorChunk* monitor_chunks() const           { return _monitor_chunks; }
+  LockStack& lock_stack()                        { return _lock_stack; }
+  const LockStack& lock_stack() const            { return _lock_stack; }
   void add_monitor_chunk(MonitorChunk* chunk);
   void remove_monitor_chunk(MonitorChunk* chunk);
   bool in_deopt_handler() const                  { return _in_deopt_handler > 0; }
@@ -2263,6 +2275,8 @@ class Threads: AllStatic {
   // Verification
   static void verify();
   static void print_on(outputStream* st, bool print_stacks, bool internal_format, bool print_concurrent_locks, bool print_extended_info);
+  static void print_on_with_handshakes(outputStream* st, bool print_extended_info);
+  static void print_non_java_threads_on(outputStream* st);
   static void print(bool print_stacks, bool internal_format) {
     // this function is only used by debug.cpp
     print_on(tty, print_stacks, internal_format, false /* no concurrent lock printed */, false /* simple format */);
@@ -2279,6 +2293,12 @@ class Threads: AllStatic {
   // Get owning Java thread from the monitor's owner field.
   static JavaThread *owning_thread_from_monitor_owner(ThreadsList * t_list,
                                                       address owner);
+  // Get owning Java thread of a monitor, including an anonymously
+  // owned one (UseLockStack).
+  static JavaThread *owning_thread_from_monitor(ThreadsList * t_list,
+                                                ObjectMonitor* monitor);
+  // Get the Java thread that has obj on its lock stack (UseLockStack).
+  static JavaThread *owning_thread_from_object(ThreadsList * t_list, oop obj);
 
   // Number of threads on the active threads list
   static int number_of_threads()                 { return _number_of_threads; }
@@ -219,43 +219,45 @@ class ThreadScanHashtable : public CHeapObj<mtThread> {
   }
 };
 
-// Closure to gather JavaThreads indirectly referenced by hazard ptrs
-// (ThreadsList references) into a hash table. This closure handles part 2
-// of the dance - adding all the JavaThreads referenced by the hazard
-// pointer (ThreadsList reference) to the hash table.
+// Closure to determine if a JavaThread is indirectly referenced by a
+// hazard ptr (ThreadsList reference). Each distinct ThreadsList is
+// searched only once. Most hazard ptrs refer to one of a few recent
+// ThreadsLists, so this is linear in the number of threads instead of
+// adding every JavaThread on every hazard ptr's ThreadsList to a table.
 //
-class AddThreadHazardPointerThreadClosure : public ThreadClosure {
+class ScanHazardPtrFindProtectedThreadClosure : public ThreadClosure {
  private:
-  ThreadScanHashtable *_table;
+  JavaThread *_target;
+  ThreadsList *_current_list;
+  ThreadScanHashtable *_searched;
+  bool _found;
 
  public:
-  AddThreadHazardPointerThreadClosure(ThreadScanHashtable *table) : _table(table) {}
+  ScanHazardPtrFindProtectedThreadClosure(JavaThread *target, ThreadScanHashtable *searched) :
+    _target(target), _current_list(ThreadsSMRSupport::get_java_thread_list()),
+    _searched(searched), _found(false) {}
 
-  virtual void do_thread(Thread *thread) {
-    if (!_table->has_entry((void*)thread)) {
-      // The same JavaThread might be on more than one ThreadsList or
-      // more than one thread might be using the same ThreadsList. In
-      // either case, we only need a single entry for a JavaThread.
-      _table->add_entry((void*)thread);
+  bool found() const { return _found; }
+
+  // Returns true if the_list contains _target. Each list is only
+  // searched on its first call.
+  bool search(ThreadsList *the_list) {
+    if (the_list == _current_list) {
+      // The target is being deleted so it has already been removed
+      // from the current ThreadsList.
+      return false;
     }
+    if (_searched->has_entry((void*)the_list)) {
+      return false;
+    }
+    _searched->add_entry((void*)the_list);
+    return the_list->includes(_target);
   }
-};
-
-// Closure to gather JavaThreads indirectly referenced by hazard ptrs
-// (ThreadsList references) into a hash table. This closure handles part 1
-// of the dance - hazard ptr chain walking and dispatch to another
-// closure.
-//
-class ScanHazardPtrGatherProtectedThreadsClosure : public ThreadClosure {
- private:
-  ThreadScanHashtable *_table;
- public:
-  ScanHazardPtrGatherProtectedThreadsClosure(ThreadScanHashtable *table) : _table(table) {}
 
   virtual void do_thread(Thread *thread) {
     assert_locked_or_safepoint(Threads_lock);
 
-    if (thread == NULL) return;
+    if (thread == NULL || _found) return;
 
     // This code races with ThreadsSMRSupport::acquire_stable_list() which
     // is lock-free so we have to handle some special situations.
@@ -287,8 +289,9 @@ class ScanHazardPtrGatherProtectedThreadsClosure : public ThreadClosure {
     // ThreadsList that has been removed but not freed. In either case,
     // the hazard ptr is protecting all the JavaThreads on that
     // ThreadsList.
-    AddThreadHazardPointerThreadClosure add_cl(_table);
-    current_list->threads_do(&add_cl);
+    if (search(current_list)) {
+      _found = true;
+    }
   }
 };
 
@@ -863,39 +866,37 @@ void ThreadsSMRSupport::free_list(ThreadsList* threads) {
 //
 bool ThreadsSMRSupport::is_a_protected_JavaThread(JavaThread *thread) {
   assert_locked_or_safepoint(Threads_lock);
+  assert(!get_java_thread_list()->includes(thread), "must be removed from the ThreadsList");
 
   // Hash table size should be first power of two higher than twice
   // the length of the Threads list.
   int hash_table_size = MIN2((int)get_java_thread_list()->length(), 32) << 1;
   hash_table_size = round_up_power_of_2(hash_table_size);
 
-  // Gather a hash table of the JavaThreads indirectly referenced by
-  // hazard ptrs.
-  ThreadScanHashtable *scan_table = new ThreadScanHashtable(hash_table_size);
-  ScanHazardPtrGatherProtectedThreadsClosure scan_cl(scan_table);
+  // Search the distinct ThreadsLists referenced by hazard ptrs for
+  // the JavaThread.
+  ThreadScanHashtable *searched = new ThreadScanHashtable(hash_table_size);
+  ScanHazardPtrFindProtectedThreadClosure scan_cl(thread, searched);
   threads_do(&scan_cl);
   OrderAccess::acquire(); // Must order reads of hazard ptr before reads of
                           // nested reference counters
 
+  bool thread_is_protected = scan_cl.found();
+
   // Walk through the linked list of pending freeable ThreadsLists
-  // and include the ones that are currently in use by a nested
-  // ThreadsListHandle in the search set.
+  // and search the ones that are currently in use by a nested
+  // ThreadsListHandle.
   ThreadsList* current = _to_delete_list;
-  while (current != NULL) {
+  while (current != NULL && !thread_is_protected) {
     if (current->_nested_handle_cnt != 0) {
       // 'current' is in use by a nested ThreadsListHandle so the hazard
       // ptr is protecting all the JavaThreads on that ThreadsList.
-      AddThreadHazardPointerThreadClosure add_cl(scan_table);
-      current->threads_do(&add_cl);
+      thread_is_protected = scan_cl.search(current);
     }
     current = current->next_list();
   }
 
-  bool thread_is_protected = false;
-  if (scan_table->has_entry((void*)thread)) {
-    thread_is_protected = true;
-  }
-  delete scan_table;
+  delete searched;
   return thread_is_protected;
 }
 
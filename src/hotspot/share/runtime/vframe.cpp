@@ -231,13 +231,19 @@ void javaVFrame::print_lock_info_on(outputStream* st, int frame_count) {
           // an inflated monitor that is first on the monitor list in
           // the first frame can block us on a monitor enter.
           markWord mark = monitor->owner()->mark();
-          if (mark.has_monitor() &&
-              ( // we have marked ourself as pending on this monitor
-                mark.monitor() == thread()->current_pending_monitor() ||
+          if (mark.has_monitor()) {
+            ObjectMonitor* mon = mark.monitor();
+            // An anonymously owned monitor belongs to the thread that still
+            // has the object on its lock stack
+            bool entered = (UseLockStack && mon->is_owner_anonymous()) ?
+                           thread()->lock_stack().contains(monitor->owner()) :
+                           mon->is_entered(thread()) != 0;
+            if (// we have marked ourself as pending on this monitor
+                mon == thread()->current_pending_monitor() ||
                 // we are not the owner of this monitor
-                !mark.monitor()->is_entered(thread())
-              )) {
-            lock_state = "waiting to lock";
+                !entered) {
+              lock_state = "waiting to lock";
+            }
           }
         }
         print_locked_object_class_name(st, Handle(THREAD, monitor->owner()), lock_state);
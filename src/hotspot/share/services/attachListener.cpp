@@ -348,6 +348,55 @@ static AttachOperationFunctionInfo funcs[] = {
 
 
 
+// Result stream handed to the operation functions. All output is buffered
+// and sent by complete(). For streaming operations, a command can send what
+// it has printed so far with AttachListener::send_partial_output() at points
+// where it holds no locks; output is never sent from an arbitrary print
+// site, as that may run under a lock or on the VM thread.
+class AttachResultStream : public bufferedStream {
+ private:
+  AttachOperation* _op;
+  Thread* _thread;
+
+  // The result stream of the streaming operation that is running, if any.
+  // Only written by the attach listener thread.
+  static AttachResultStream* _streaming;
+
+  friend class AttachListener;
+
+ public:
+  AttachResultStream(AttachOperation* op) :
+    bufferedStream(256, 1024*1024*10), _op(op), _thread(Thread::current()) {
+    if (op->is_streaming()) {
+      _streaming = this;
+    }
+  }
+
+  ~AttachResultStream() {
+    if (_streaming == this) {
+      _streaming = NULL;
+    }
+  }
+
+  void send_partial() {
+    _op->write_partial(base(), size());
+    // drop the data but keep the column position for indentation
+    buffer_pos = 0;
+  }
+};
+
+AttachResultStream* AttachResultStream::_streaming = NULL;
+
+void AttachListener::send_partial_output(outputStream* out) {
+  AttachResultStream* st = AttachResultStream::_streaming;
+  if (st == NULL || out != st || Thread::current() != st->_thread ||
+      st->size() < AttachOperation::streaming_chunk_size) {
+    return;
+  }
+  assert(!st->_thread->owns_locks(), "must not hold locks while sending attach output");
+  st->send_partial();
+}
+
 // The Attach Listener threads services a queue. It dequeues an operation
 // from the queue, examines the operation name (command), and dispatches
 // to the corresponding function to perform the operation.
@@ -373,7 +422,7 @@ static void attach_listener_thread_entry(JavaThread* thread, TRAPS) {
     }
 
     ResourceMark rm;
-    bufferedStream st;
+    AttachResultStream st(op);
     jint res = JNI_OK;
 
     // handle special detachall operation
@@ -77,6 +77,12 @@ class AttachListener: AllStatic {
   // indicates if we have a trigger to start the Attach Listener
   static bool is_init_trigger() NOT_SERVICES_RETURN_(false);
 
+  // Sends the output buffered in out to the client if out is the result
+  // stream of a streaming operation on this thread and holds at least a
+  // chunk. The thread may block for safepoints until the client has read
+  // the data, so callers must not hold VM locks or raw oops.
+  static void send_partial_output(outputStream* out) NOT_SERVICES_RETURN;
+
 #if !INCLUDE_SERVICES
   static bool is_attach_supported()             { return false; }
 #else
@@ -138,7 +144,8 @@ class AttachOperation: public CHeapObj<mtInternal> {
   enum {
     name_length_max = 16,       // maximum length of  name
     arg_length_max = 1024,      // maximum length of argument
-    arg_count_max = 3           // maximum number of arguments
+    arg_count_max = 3,          // maximum number of arguments
+    streaming_chunk_size = 64*1024  // minimum output forwarded per write_partial()
   };
 
   // name of special operation that can be enqueued when all
@@ -189,6 +196,14 @@ class AttachOperation: public CHeapObj<mtInternal> {
 
   // complete operation by sending result code and any result data to the client
   virtual void complete(jint result, bufferedStream* result_stream) = 0;
+
+  // Operations that can send result data to the client before they complete
+  // return true here. Output passed to AttachListener::send_partial_output()
+  // is then handed to write_partial() in chunks of at least
+  // streaming_chunk_size bytes, and complete() only sends the remainder.
+  // write_partial() lets the thread block for safepoints.
+  virtual bool is_streaming() const             { return false; }
+  virtual void write_partial(const char* buf, size_t len) { ShouldNotReachHere(); }
 };
 #endif // INCLUDE_SERVICES
 
@@ -40,7 +40,9 @@
 #include "runtime/handles.inline.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/javaCalls.hpp"
+#include "runtime/jniHandles.hpp"
 #include "runtime/os.hpp"
+#include "runtime/safepointMechanism.hpp"
 #include "services/diagnosticArgument.hpp"
 #include "services/diagnosticCommand.hpp"
 #include "services/diagnosticFramework.hpp"
@@ -614,19 +616,33 @@ int ClassStatsDCmd::num_arguments() {
 ThreadDumpDCmd::ThreadDumpDCmd(outputStream* output, bool heap) :
                                DCmdWithParser(output, heap),
   _locks("-l", "print java.util.concurrent locks", "BOOLEAN", false, "false"),
-  _extended("-e", "print extended thread information", "BOOLEAN", false, "false") {
+  _extended("-e", "print extended thread information", "BOOLEAN", false, "false"),
+  _concurrent("-concurrent", "print the stacks in per-thread handshakes instead of "
+              "at a safepoint (not with -l)", "BOOLEAN", false, "false") {
   _dcmdparser.add_dcmd_option(&_locks);
   _dcmdparser.add_dcmd_option(&_extended);
+  _dcmdparser.add_dcmd_option(&_concurrent);
 }
 
 void ThreadDumpDCmd::execute(DCmdSource source, TRAPS) {
-  // thread stacks
-  VM_PrintThreads op1(output(), _locks.value(), _extended.value());
-  VMThread::execute(&op1);
+  // Without thread-local polls every handshake is a full safepoint, and one
+  // safepoint per thread is worse than the single one of VM_PrintThreads.
+  if (_concurrent.value() && !_locks.value() &&
+      SafepointMechanism::uses_thread_local_poll()) {
+    // thread stacks, each thread is only stopped while its own stack is printed
+    Threads::print_on_with_handshakes(output(), _extended.value());
+
+    // JNI global handles
+    JNIHandles::print_on(output());
+  } else {
+    // thread stacks
+    VM_PrintThreads op1(output(), _locks.value(), _extended.value());
+    VMThread::execute(&op1);
 
-  // JNI global handles
-  VM_PrintJNI op2(output());
-  VMThread::execute(&op2);
+    // JNI global handles
+    VM_PrintJNI op2(output());
+    VMThread::execute(&op2);
+  }
 
   // Deadlock detection
   VM_FindDeadlocks op3(output());
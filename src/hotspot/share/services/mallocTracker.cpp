@@ -22,6 +22,7 @@
  *
  */
 #include "precompiled.hpp"
+#include "memory/arena.hpp"
 
 #include "services/mallocSiteTable.hpp"
 #include "services/mallocTracker.hpp"
@@ -53,6 +54,10 @@ size_t MallocMemorySnapshot::total_arena() const {
 // from total chunks to get total free chunk size
 void MallocMemorySnapshot::make_adjustment() {
   size_t arena_size = total_arena();
+  // Large chunks are mapped rather than malloc'd, they are not part of
+  // the mtChunk malloc total.
+  size_t mapped_length = Chunk::mapped_length();
+  arena_size = arena_size > mapped_length ? arena_size - mapped_length : 0;
   int chunk_idx = NMTUtil::flag_to_index(mtChunk);
   _malloc[chunk_idx].record_free(arena_size);
 }
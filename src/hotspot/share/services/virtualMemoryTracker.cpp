@@ -24,6 +24,7 @@
 #include "precompiled.hpp"
 
 #include "logging/log.hpp"
+#include "memory/arena.hpp"
 #include "memory/metaspace.hpp"
 #include "runtime/os.hpp"
 #include "runtime/threadCritical.hpp"
@@ -46,6 +47,12 @@ void VirtualMemorySummary::snapshot(VirtualMemorySnapshot* s) {
     VirtualMemoryTracker::snapshot_thread_stacks();
   }
   as_snapshot()->copy_to(s);
+  // Mapped arena chunks are reported as arena memory of their owners,
+  // don't count them a second time as mtChunk virtual memory.
+  VirtualMemory* chunks = s->by_type(mtChunk);
+  size_t mapped_size = MIN2(Chunk::mapped_size(), chunks->committed());
+  chunks->uncommit_memory(mapped_size);
+  chunks->release_memory(mapped_size);
 }
 
 SortedLinkedList<ReservedMemoryRegion, compare_reserved_region_base>* VirtualMemoryTracker::_reserved_regions;
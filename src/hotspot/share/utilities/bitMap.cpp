@@ -647,13 +647,56 @@ bool BitMap::iterate(BitMapClosure* blk, idx_t leftOffset, idx_t rightOffset) {
   return true;
 }
 
+BitMap::idx_t BitMap::count_one_bits_in_words(idx_t beg, idx_t end) const {
+  // Independent sums over four words per iteration keep several
+  // population counts in flight and let the compiler vectorize them.
+  const bm_word_t* words = map();
+  idx_t sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+  idx_t i = beg;
+  for ( ; i + 4 <= end; i += 4) {
+    sum0 += population_count(words[i]);
+    sum1 += population_count(words[i + 1]);
+    sum2 += population_count(words[i + 2]);
+    sum3 += population_count(words[i + 3]);
+  }
+  for ( ; i < end; i++) {
+    sum0 += population_count(words[i]);
+  }
+  return sum0 + sum1 + sum2 + sum3;
+}
+
 BitMap::idx_t BitMap::count_one_bits() const {
-  idx_t sum = 0;
-  for (idx_t i = 0; i < size_in_words(); i++) {
-    bm_word_t w = map()[i];
-    sum += population_count(w);
+  return count_one_bits_in_words(0, size_in_words());
+}
+
+BitMap::idx_t BitMap::count_one_bits(idx_t beg, idx_t end) const {
+  verify_range(beg, end);
+
+  idx_t beg_full_word = to_words_align_up(beg);
+  idx_t end_full_word = to_words_align_down(end);
+
+  if (beg_full_word < end_full_word) {
+    // The range includes at least one full word.
+    idx_t sum = count_one_bits_in_words(beg_full_word, end_full_word);
+    if (beg != bit_index(beg_full_word)) {
+      sum += population_count(*word_addr(beg) & ~inverted_bit_mask_for_range(beg, bit_index(beg_full_word)));
+    }
+    if (bit_index(end_full_word) != end) {
+      sum += population_count(*word_addr(end) & ~inverted_bit_mask_for_range(bit_index(end_full_word), end));
+    }
+    return sum;
+  } else {
+    // The range spans at most 2 partial words.
+    idx_t boundary = MIN2(bit_index(beg_full_word), end);
+    idx_t sum = 0;
+    if (beg != boundary) {
+      sum += population_count(*word_addr(beg) & ~inverted_bit_mask_for_range(beg, boundary));
+    }
+    if (boundary != end) {
+      sum += population_count(*word_addr(boundary) & ~inverted_bit_mask_for_range(boundary, end));
+    }
+    return sum;
   }
-  return sum;
 }
 
 void BitMap::print_on_error(outputStream* st, const char* prefix) const {
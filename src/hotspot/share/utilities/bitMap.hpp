@@ -104,6 +104,16 @@ class BitMap {
   static const bm_word_t find_ones_flip = 0;
   static const bm_word_t find_zeros_flip = ~(bm_word_t)0;
 
+  // Helper for get_next_bit_impl: returns the index of the first word in
+  // [beg, end) that is non-zero after xor with flip, or end if none is.
+  // The flipped word is stored in *word, so that the caller works on the
+  // value that was tested even if the map is updated concurrently.
+  template<bm_word_t flip>
+  inline idx_t find_first_word(idx_t beg, idx_t end, bm_word_t* word) const;
+
+  // Returns the number of bits set in the words [beg, end).
+  idx_t count_one_bits_in_words(idx_t beg, idx_t end) const;
+
   // Threshold for performing small range operation, even when large range
   // operation was requested. Measured in words.
   static const size_t small_range_words = 32;
@@ -310,6 +320,9 @@ class BitMap {
   // Returns the number of bits set in the bitmap.
   idx_t count_one_bits() const;
 
+  // Returns the number of bits set within [beg, end).
+  idx_t count_one_bits(idx_t beg, idx_t end) const;
+
   // Set operations.
   void set_union(const BitMap& bits);
   void set_difference(const BitMap& bits);
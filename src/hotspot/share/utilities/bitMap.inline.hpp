@@ -136,12 +136,21 @@ inline void BitMap::par_set_range(idx_t beg, idx_t end, RangeSizeHint hint) {
 }
 
 inline void BitMap::set_range_of_words(idx_t beg, idx_t end) {
-  bm_word_t* map = _map;
-  for (idx_t i = beg; i < end; ++i) map[i] = ~(bm_word_t)0;
+  if (beg + small_range_words >= end) {
+    bm_word_t* map = _map;
+    for (idx_t i = beg; i < end; ++i) map[i] = ~(bm_word_t)0;
+  } else {
+    // The platform memset uses the widest stores the CPU has.
+    set_large_range_of_words(beg, end);
+  }
 }
 
 inline void BitMap::clear_range_of_words(bm_word_t* map, idx_t beg, idx_t end) {
-  for (idx_t i = beg; i < end; ++i) map[i] = 0;
+  if (beg + small_range_words >= end) {
+    for (idx_t i = beg; i < end; ++i) map[i] = 0;
+  } else {
+    memset(map + beg, 0, (end - beg) * sizeof(bm_word_t));
+  }
 }
 
 inline void BitMap::clear_range_of_words(idx_t beg, idx_t end) {
@@ -164,6 +173,28 @@ inline void BitMap::par_clear_range(idx_t beg, idx_t end, RangeSizeHint hint) {
   }
 }
 
+template<BitMap::bm_word_t flip>
+inline BitMap::idx_t BitMap::find_first_word(idx_t beg, idx_t end, bm_word_t* word) const {
+  // Sparse bitmaps have long runs of uninteresting words.  Testing four
+  // words per branch halves the work per word there and lets the compiler
+  // use wide loads; the tail is searched a word at a time.
+  const bm_word_t* words = map();
+  idx_t index = beg;
+  for ( ; index + 4 <= end; index += 4) {
+    bm_word_t any = (words[index]     ^ flip) | (words[index + 1] ^ flip) |
+                    (words[index + 2] ^ flip) | (words[index + 3] ^ flip);
+    if (any != 0) break;
+  }
+  for ( ; index < end; index++) {
+    bm_word_t w = words[index] ^ flip;
+    if (w != 0) {
+      *word = w;
+      break;
+    }
+  }
+  return index;
+}
+
 template<BitMap::bm_word_t flip, bool aligned_right>
 inline BitMap::idx_t BitMap::get_next_bit_impl(idx_t l_index, idx_t r_index) const {
   STATIC_ASSERT(flip == find_ones_flip || flip == find_zeros_flip);
@@ -211,15 +242,12 @@ inline BitMap::idx_t BitMap::get_next_bit_impl(idx_t l_index, idx_t r_index) con
       idx_t limit = aligned_right
         ? to_words_align_down(r_index) // Miniscule savings when aligned.
         : to_words_align_up(r_index);
-      while (++index < limit) {
-        cword = map(index) ^ flip;
-        if (cword != 0) {
-          idx_t result = bit_index(index) + count_trailing_zeros(cword);
-          if (aligned_right || (result < r_index)) return result;
-          // Result is beyond range bound; return r_index.
-          assert((index + 1) == limit, "invariant");
-          break;
-        }
+      index = find_first_word<flip>(index + 1, limit, &cword);
+      if (index < limit) {
+        idx_t result = bit_index(index) + count_trailing_zeros(cword);
+        if (aligned_right || (result < r_index)) return result;
+        // Result is beyond range bound; return r_index.
+        assert((index + 1) == limit, "invariant");
       }
       // No bits in range; return r_index.
     }
@@ -242,6 +242,9 @@ class ConcurrentHashTable : public CHeapObj<F> {
   // write_synchronize can be avoided. If not, it sets the _invisible_epoch
   // again and do a write_synchronize.
   void write_synchonize_on_visible_epoch(Thread* thread);
+  // Parallel bucket operations cannot use _invisible_epoch, since only
+  // the owner of _resize_lock may, so they always write_synchronize.
+  void write_synchronize_for(Thread* thread, bool is_mt);
   // To be-able to avoid write_synchronize in resize and other bulk operation,
   // this field keep tracks if a version of the hash-table was ever been seen.
   // We the working thread pointer as tag for debugging. The _invisible_epoch
@@ -301,12 +304,27 @@ class ConcurrentHashTable : public CHeapObj<F> {
   bool internal_shrink(Thread* thread, size_t size_limit_log2);
 
   // Methods for growing.
+  // Where unzipping of an old bucket chain into an even and an odd new
+  // bucket has got to.
+  struct UnzipCursor {
+    Node* _aux;
+    Node* const volatile * _even;
+    Node* const volatile * _odd;
+    Node* _delete_me;
+  };
+  void unzip_init(UnzipCursor* c, InternalTable* old_table,
+                  InternalTable* new_table, size_t even_index,
+                  size_t odd_index);
+  // Moves one node, readers must be synchronized before the next step.
+  void unzip_step(UnzipCursor* c, InternalTable* new_table,
+                  size_t even_index, size_t odd_index);
   bool unzip_bucket(Thread* thread, InternalTable* old_table,
                     InternalTable* new_table, size_t even_index,
                     size_t odd_index);
   bool internal_grow_prolog(Thread* thread, size_t log2_size);
   void internal_grow_epilog(Thread* thread);
   void internal_grow_range(Thread* thread, size_t start, size_t stop);
+  void internal_grow_range_mt(Thread* thread, size_t start, size_t stop);
   bool internal_grow(Thread* thread, size_t log2_size);
 
   // Get a value.
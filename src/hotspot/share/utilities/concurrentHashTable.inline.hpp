@@ -299,6 +299,17 @@ inline void ConcurrentHashTable<CONFIG, F>::
   GlobalCounter::write_synchronize();
 }
 
+template <typename CONFIG, MEMFLAGS F>
+inline void ConcurrentHashTable<CONFIG, F>::
+  write_synchronize_for(Thread* thread, bool is_mt)
+{
+  if (is_mt) {
+    GlobalCounter::write_synchronize();
+  } else {
+    write_synchonize_on_visible_epoch(thread);
+  }
+}
+
 template <typename CONFIG, MEMFLAGS F>
 inline bool ConcurrentHashTable<CONFIG, F>::
   try_resize_lock(Thread* locker)
@@ -407,6 +418,7 @@ inline void ConcurrentHashTable<CONFIG, F>::
 {
   assert(stop <= _table->_size, "Outside backing array");
   assert(_new_table != NULL, "Grow not proper setup before start");
+  assert(_resize_lock_owner == thread, "Re-size lock not held");
   // The state is also copied here. Hence all buckets in new table will be
   // locked. I call the siblings odd/even, where even have high bit 0 and odd
   // have high bit 1.
@@ -441,6 +453,71 @@ inline void ConcurrentHashTable<CONFIG, F>::
   }
 }
 
+// Used by several threads at once, so write_synchonize_on_visible_epoch()
+// can not be used. Instead of a write_synchronize() per moved node, all
+// chains of the range are unzipped in lock step: one node of every chain
+// is moved, then readers are synchronized once for all of them. Chains
+// are short, so a range needs only a few write_synchronize() calls.
+template <typename CONFIG, MEMFLAGS F>
+inline void ConcurrentHashTable<CONFIG, F>::
+  internal_grow_range_mt(Thread* thread, size_t start, size_t stop)
+{
+  assert(stop <= _table->_size, "Outside backing array");
+  assert(_new_table != NULL, "Grow not proper setup before start");
+  assert(_resize_lock_owner != NULL, "Re-size lock not held");
+  const size_t n = stop - start;
+  UnzipCursor* cursors = NEW_C_HEAP_ARRAY(UnzipCursor, n, F);
+  for (size_t i = 0; i < n; i++) {
+    size_t even_index = start + i;
+    size_t odd_index = even_index + _table->_size;
+    Bucket* bucket = _table->get_bucket(even_index);
+
+    bucket->lock();
+
+    _new_table->get_buckets()[even_index] = *bucket;
+    _new_table->get_buckets()[odd_index] = *bucket;
+
+    // Moves lockers go to new table, where they will wait until unlock() below.
+    bucket->redirect(); /* Must release stores above */
+
+    unzip_init(&cursors[i], _table, _new_table, even_index, odd_index);
+  }
+
+  // The first write_synchronize() also makes sure that readers have left
+  // empty buckets before they are poisoned.
+  bool more;
+  do {
+    more = false;
+    for (size_t i = 0; i < n; i++) {
+      if (cursors[i]._aux != NULL) {
+        size_t even_index = start + i;
+        unzip_step(&cursors[i], _new_table, even_index, even_index + _table->_size);
+        more = more || cursors[i]._aux != NULL;
+      }
+    }
+    GlobalCounter::write_synchronize();
+    for (size_t i = 0; i < n; i++) {
+      if (cursors[i]._delete_me != NULL) {
+        Node::destroy_node(cursors[i]._delete_me);
+        cursors[i]._delete_me = NULL;
+      }
+    }
+  } while (more);
+
+  for (size_t even_index = start; even_index < stop; even_index++) {
+    size_t odd_index = even_index + _table->_size;
+    // Unlock for writes into the new table buckets.
+    _new_table->get_bucket(even_index)->unlock();
+    _new_table->get_bucket(odd_index)->unlock();
+
+    DEBUG_ONLY(
+       _table->get_bucket(even_index)->release_assign_node_ptr(
+          _table->get_bucket(even_index)->first_ptr(), (Node*)POISON_PTR);
+    )
+  }
+  FREE_C_HEAP_ARRAY(UnzipCursor, cursors);
+}
+
 template <typename CONFIG, MEMFLAGS F>
 template <typename LOOKUP_FUNC, typename DELETE_FUNC>
 inline bool ConcurrentHashTable<CONFIG, F>::
@@ -511,11 +588,7 @@ inline void ConcurrentHashTable<CONFIG, F>::
     bucket->lock();
     size_t nd = delete_check_nodes(bucket, eval_f, BULK_DELETE_LIMIT, ndel);
     bucket->unlock();
-    if (is_mt) {
-      GlobalCounter::write_synchronize();
-    } else {
-      write_synchonize_on_visible_epoch(thread);
-    }
+    write_synchronize_for(thread, is_mt);
     for (size_t node_it = 0; node_it < nd; node_it++) {
       del_f(ndel[node_it]->value());
       Node::destroy_node(ndel[node_it]);
@@ -635,59 +708,78 @@ ConcurrentHashTable<CONFIG, F>::
   return node;
 }
 
+template <typename CONFIG, MEMFLAGS F>
+inline void ConcurrentHashTable<CONFIG, F>::
+  unzip_init(UnzipCursor* c, InternalTable* old_table,
+             InternalTable* new_table, size_t even_index, size_t odd_index)
+{
+  c->_aux = old_table->get_bucket(even_index)->first();
+  c->_even = new_table->get_bucket(even_index)->first_ptr();
+  c->_odd = new_table->get_bucket(odd_index)->first_ptr();
+  c->_delete_me = NULL;
+}
+
+template <typename CONFIG, MEMFLAGS F>
+inline void ConcurrentHashTable<CONFIG, F>::
+  unzip_step(UnzipCursor* c, InternalTable* new_table,
+             size_t even_index, size_t odd_index)
+{
+  Node* aux = c->_aux;
+  assert(aux != NULL, "Nothing left to unzip");
+  assert(c->_delete_me == NULL, "Previous step not synchronized");
+  bool dead_hash = false;
+  size_t aux_hash = CONFIG::get_hash(*aux->value(), &dead_hash);
+  Node* aux_next = aux->next();
+  if (dead_hash) {
+    c->_delete_me = aux;
+    // This item is dead, move both list to next
+    new_table->get_bucket(odd_index)->release_assign_node_ptr(c->_odd,
+                                                              aux_next);
+    new_table->get_bucket(even_index)->release_assign_node_ptr(c->_even,
+                                                               aux_next);
+  } else {
+    size_t aux_index = bucket_idx_hash(new_table, aux_hash);
+    if (aux_index == even_index) {
+      // This is a even, so move odd to aux/even next
+      new_table->get_bucket(odd_index)->release_assign_node_ptr(c->_odd,
+                                                                aux_next);
+      // Keep in even list
+      c->_even = aux->next_ptr();
+    } else if (aux_index == odd_index) {
+      // This is a odd, so move odd to aux/odd next
+      new_table->get_bucket(even_index)->release_assign_node_ptr(c->_even,
+                                                                 aux_next);
+      // Keep in odd list
+      c->_odd = aux->next_ptr();
+    } else {
+      fatal("aux_index does not match even or odd indices");
+    }
+  }
+  c->_aux = aux_next;
+}
+
 template <typename CONFIG, MEMFLAGS F>
 inline bool ConcurrentHashTable<CONFIG, F>::
   unzip_bucket(Thread* thread, InternalTable* old_table,
                InternalTable* new_table, size_t even_index, size_t odd_index)
 {
-  Node* aux = old_table->get_bucket(even_index)->first();
-  if (aux == NULL) {
+  UnzipCursor c;
+  unzip_init(&c, old_table, new_table, even_index, odd_index);
+  if (c._aux == NULL) {
     // This is an empty bucket and in debug we poison first ptr in bucket.
     // Therefore we must make sure no readers are looking at this bucket.
     // If we don't do a write_synch here, caller must do it.
     return false;
   }
-  Node* delete_me = NULL;
-  Node* const volatile * even = new_table->get_bucket(even_index)->first_ptr();
-  Node* const volatile * odd = new_table->get_bucket(odd_index)->first_ptr();
-  while (aux != NULL) {
-    bool dead_hash = false;
-    size_t aux_hash = CONFIG::get_hash(*aux->value(), &dead_hash);
-    Node* aux_next = aux->next();
-    if (dead_hash) {
-      delete_me = aux;
-      // This item is dead, move both list to next
-      new_table->get_bucket(odd_index)->release_assign_node_ptr(odd,
-                                                                aux_next);
-      new_table->get_bucket(even_index)->release_assign_node_ptr(even,
-                                                                 aux_next);
-    } else {
-      size_t aux_index = bucket_idx_hash(new_table, aux_hash);
-      if (aux_index == even_index) {
-        // This is a even, so move odd to aux/even next
-        new_table->get_bucket(odd_index)->release_assign_node_ptr(odd,
-                                                                  aux_next);
-        // Keep in even list
-        even = aux->next_ptr();
-      } else if (aux_index == odd_index) {
-        // This is a odd, so move odd to aux/odd next
-        new_table->get_bucket(even_index)->release_assign_node_ptr(even,
-                                                                   aux_next);
-        // Keep in odd list
-        odd = aux->next_ptr();
-      } else {
-        fatal("aux_index does not match even or odd indices");
-      }
-    }
-    aux = aux_next;
-
+  while (c._aux != NULL) {
+    unzip_step(&c, new_table, even_index, odd_index);
     // We can only move 1 pointer otherwise a reader might be moved to the wrong
     // chain. E.g. looking for even hash value but got moved to the odd bucket
     // chain.
     write_synchonize_on_visible_epoch(thread);
-    if (delete_me != NULL) {
-      Node::destroy_node(delete_me);
-      delete_me = NULL;
+    if (c._delete_me != NULL) {
+      Node::destroy_node(c._delete_me);
+      c._delete_me = NULL;
     }
   }
   return true;
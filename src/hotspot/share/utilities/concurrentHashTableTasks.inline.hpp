@@ -75,7 +75,7 @@ class ConcurrentHashTable<CONFIG, F>::BucketsOperation {
 
   // Returns false if all ranges are claimed.
   bool have_more_work() {
-    return Atomic::load_acquire(&_next_to_claim) >= _stop_task;
+    return Atomic::load_acquire(&_next_to_claim) < _stop_task;
   }
 
   void thread_owns_resize_lock(Thread* thread) {
@@ -98,6 +98,9 @@ class ConcurrentHashTable<CONFIG, F>::BucketsOperation {
   }
 
 public:
+  // Number of ranges the table is split into, valid after prepare().
+  size_t number_of_tasks() const { return _stop_task; }
+
   // Pauses for safepoint
   void pause(Thread* thread) {
     // This leaves internal state locked.
@@ -116,7 +119,9 @@ public:
   }
 };
 
-// For doing pausable/parallel bulk delete.
+// For doing pausable/parallel bulk delete. With is_mt, do_task() may be
+// called by several threads at once while the thread that called
+// prepare() keeps the resize lock.
 template <typename CONFIG, MEMFLAGS F>
 class ConcurrentHashTable<CONFIG, F>::BulkDeleteTask :
   public BucketsOperation
@@ -166,7 +171,10 @@ class ConcurrentHashTable<CONFIG, F>::GrowTask :
   public BucketsOperation
 {
  public:
-  GrowTask(ConcurrentHashTable<CONFIG, F>* cht) : BucketsOperation(cht) {
+  // With is_mt, do_task() may be called by several threads at once,
+  // as for BulkDeleteTask.
+  GrowTask(ConcurrentHashTable<CONFIG, F>* cht, bool is_mt = false)
+    : BucketsOperation(cht, is_mt) {
   }
   // Before start prepare must be called.
   bool prepare(Thread* thread) {
@@ -186,7 +194,11 @@ class ConcurrentHashTable<CONFIG, F>::GrowTask :
     if (!this->claim(&start, &stop)) {
       return false;
     }
-    BucketsOperation::_cht->internal_grow_range(thread, start, stop);
+    if (BucketsOperation::_is_mt) {
+      BucketsOperation::_cht->internal_grow_range_mt(thread, start, stop);
+    } else {
+      BucketsOperation::_cht->internal_grow_range(thread, start, stop);
+    }
     assert(BucketsOperation::_cht->_resize_lock_owner != NULL,
            "Should be locked");
     return true;
@@ -29,31 +29,66 @@
 #include <string.h>
 #include <stdio.h>
 #include <limits.h>
+#include <sys/mman.h>
 #include <new>
 
 #include "logging/log.hpp"
 #include "memory/allocation.inline.hpp"
 #include "memory/resourceArea.hpp"
+#include "runtime/os.hpp"
+#include "utilities/align.hpp"
 #include "utilities/decoder.hpp"
 #include "utilities/elfFile.hpp"
 #include "utilities/elfFuncDescTable.hpp"
 #include "utilities/elfStringTable.hpp"
 #include "utilities/elfSymbolTable.hpp"
 #include "utilities/ostream.hpp"
+#include "utilities/vmError.hpp"
 
 // For test only, disable elf section cache and force to read from file directly.
 bool ElfFile::_do_not_cache_elf_section = false;
 
-ElfSection::ElfSection(FILE* fd, const Elf_Shdr& hdr) : _section_data(NULL) {
-  _stat = load_section(fd, hdr);
+ElfSection::ElfSection(FILE* fd, const Elf_Shdr& hdr, bool map) :
+  _section_data(NULL), _mapped_base(NULL), _mapped_size(0) {
+  if (map && !ElfFile::_do_not_cache_elf_section && map_section(fd, hdr)) {
+    memcpy((void*)&_section_hdr, (const void*)&hdr, sizeof(hdr));
+    _stat = NullDecoder::no_error;
+  } else {
+    _stat = load_section(fd, hdr);
+  }
 }
 
 ElfSection::~ElfSection() {
-  if (_section_data != NULL) {
+  if (_mapped_base != NULL) {
+    ::munmap(_mapped_base, _mapped_size);
+  } else if (_section_data != NULL) {
     os::free(_section_data);
   }
 }
 
+// The mapping is made with plain mmap: os::map_memory() would record it
+// with NMT, which takes ThreadCritical and must be avoided while an error
+// is reported. While an error is reported, sections are not mapped at all,
+// so that the decoder does not add mappings to a crashing process.
+bool ElfSection::map_section(FILE* const fd, const Elf_Shdr& shdr) {
+  if (shdr.sh_size == 0 || VMError::is_error_reported()) {
+    return false;
+  }
+  // Mappings must start at a page boundary of the file.
+  size_t page_size = os::vm_page_size();
+  size_t offset = align_down((size_t)shdr.sh_offset, page_size);
+  size_t size = align_up((size_t)shdr.sh_offset + shdr.sh_size - offset, page_size);
+  char* base = (char*)::mmap(NULL, size, PROT_READ, MAP_PRIVATE, fileno(fd), (off_t)offset);
+  if (base == MAP_FAILED) {
+    log_debug(decoder)("Could not map elf section, reading it instead");
+    return false;
+  }
+  _mapped_base = base;
+  _mapped_size = size;
+  _section_data = base + (shdr.sh_offset - offset);
+  return true;
+}
+
 NullDecoder::decoder_status ElfSection::load_section(FILE* const fd, const Elf_Shdr& shdr) {
   memcpy((void*)&_section_hdr, (const void*)&shdr, sizeof(shdr));
 
@@ -80,9 +80,13 @@ class ElfSection {
 private:
   Elf_Shdr      _section_hdr;
   void*         _section_data;
+  char*         _mapped_base;   // mapping holding _section_data, if mapped
+  size_t        _mapped_size;
   NullDecoder::decoder_status _stat;
 public:
-  ElfSection(FILE* fd, const Elf_Shdr& hdr);
+  // With map, the section data is mapped from the file rather than copied
+  // into C-heap, if possible.
+  ElfSection(FILE* fd, const Elf_Shdr& hdr, bool map = false);
   ~ElfSection();
 
   NullDecoder::decoder_status status() const { return _stat; }
@@ -93,6 +97,8 @@ private:
   // load this section.
   // it return no_error, when it fails to cache the section data due to lack of memory
   NullDecoder::decoder_status load_section(FILE* const file, const Elf_Shdr& hdr);
+  // map this section read-only, returns false if it could not be mapped.
+  bool map_section(FILE* const file, const Elf_Shdr& hdr);
 };
 
 class FileReader : public StackObj {
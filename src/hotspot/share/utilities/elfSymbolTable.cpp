@@ -26,12 +26,16 @@
 
 #if !defined(_WINDOWS) && !defined(__APPLE__)
 
+#include "logging/log.hpp"
 #include "memory/allocation.inline.hpp"
+#include "runtime/os.hpp"
 #include "utilities/elfFuncDescTable.hpp"
 #include "utilities/elfSymbolTable.hpp"
+#include "utilities/quickSort.hpp"
 
 ElfSymbolTable::ElfSymbolTable(FILE* const file, Elf_Shdr& shdr) :
-  _next(NULL), _fd(file), _section(file, shdr) {
+  _next(NULL), _fd(file), _section(file, shdr, true /* map */),
+  _index(NULL), _index_length(0), _index_tried(false) {
   assert(file != NULL, "null file handle");
   _status = _section.status();
 
@@ -41,22 +45,28 @@ ElfSymbolTable::ElfSymbolTable(FILE* const file, Elf_Shdr& shdr) :
 }
 
 ElfSymbolTable::~ElfSymbolTable() {
+  if (_index != NULL) {
+    os::free(_index);
+  }
   if (_next != NULL) {
     delete _next;
   }
 }
 
+address ElfSymbolTable::symbol_address(const Elf_Sym* sym, ElfFuncDescTable* funcDescTable) const {
+  if (funcDescTable != NULL && funcDescTable->get_index() == sym->st_shndx) {
+    // We need to go another step trough the function descriptor table (currently PPC64 only)
+    return funcDescTable->lookup(sym->st_value);
+  } else {
+    return (address)sym->st_value;
+  }
+}
+
 bool ElfSymbolTable::compare(const Elf_Sym* sym, address addr, int* stringtableIndex, int* posIndex, int* offset, ElfFuncDescTable* funcDescTable) {
   if (STT_FUNC == ELF_ST_TYPE(sym->st_info)) {
     Elf_Word st_size = sym->st_size;
     const Elf_Shdr* shdr = _section.section_header();
-    address sym_addr;
-    if (funcDescTable != NULL && funcDescTable->get_index() == sym->st_shndx) {
-      // We need to go another step trough the function descriptor table (currently PPC64 only)
-      sym_addr = funcDescTable->lookup(sym->st_value);
-    } else {
-      sym_addr = (address)sym->st_value;
-    }
+    address sym_addr = symbol_address(sym, funcDescTable);
     if (sym_addr <= addr && (Elf_Word)(addr - sym_addr) < st_size) {
       *offset = (int)(addr - sym_addr);
       *posIndex = sym->st_name;
@@ -67,6 +77,82 @@ bool ElfSymbolTable::compare(const Elf_Sym* sym, address addr, int* stringtableI
   return false;
 }
 
+int ElfSymbolTable::compare_entries(const IndexEntry& e1, const IndexEntry& e2) {
+  if (e1._start != e2._start) {
+    return e1._start < e2._start ? -1 : 1;
+  }
+  // Keep symbols at the same address in symbol table order.
+  return e1._symbol - e2._symbol;
+}
+
+bool ElfSymbolTable::build_index(ElfFuncDescTable* funcDescTable) {
+  const Elf_Sym* symbols = (const Elf_Sym*)_section.section_data();
+  int count = _section.section_header()->sh_size / sizeof(Elf_Sym);
+  assert(symbols != NULL, "only in-memory sections are indexed");
+
+  // Only sized function symbols can ever match.
+  int length = 0;
+  for (int i = 0; i < count; i++) {
+    if (STT_FUNC == ELF_ST_TYPE(symbols[i].st_info) && symbols[i].st_size != 0) {
+      length++;
+    }
+  }
+  if (length == 0) {
+    return false;
+  }
+
+  IndexEntry* index = (IndexEntry*)os::malloc(length * sizeof(IndexEntry), mtInternal);
+  if (index == NULL) {
+    return false;
+  }
+  int pos = 0;
+  for (int i = 0; i < count; i++) {
+    const Elf_Sym* sym = &symbols[i];
+    if (STT_FUNC == ELF_ST_TYPE(sym->st_info) && sym->st_size != 0) {
+      index[pos]._start = symbol_address(sym, funcDescTable);
+      index[pos]._max_end = index[pos]._start + sym->st_size;
+      index[pos]._symbol = i;
+      pos++;
+    }
+  }
+  QuickSort::sort(index, length, compare_entries, false);
+  for (int i = 1; i < length; i++) {
+    index[i]._max_end = MAX2(index[i]._max_end, index[i - 1]._max_end);
+  }
+
+  _index = index;
+  _index_length = length;
+  log_debug(decoder)("Indexed %d of %d symbols", length, count);
+  return true;
+}
+
+bool ElfSymbolTable::lookup_in_index(address addr, int* stringtableIndex, int* posIndex, int* offset, ElfFuncDescTable* funcDescTable) {
+  const Elf_Sym* symbols = (const Elf_Sym*)_section.section_data();
+
+  // Find the last entry starting at or below addr.
+  int low = 0;
+  int high = _index_length - 1;
+  int found = -1;
+  while (low <= high) {
+    int mid = low + (high - low) / 2;
+    if (_index[mid]._start <= addr) {
+      found = mid;
+      low = mid + 1;
+    } else {
+      high = mid - 1;
+    }
+  }
+
+  // Usually that entry encloses addr.  Otherwise an earlier, larger
+  // symbol might, as long as the ends seen so far reach past addr.
+  for (int i = found; i >= 0 && _index[i]._max_end > addr; i--) {
+    if (compare(&symbols[_index[i]._symbol], addr, stringtableIndex, posIndex, offset, funcDescTable)) {
+      return true;
+    }
+  }
+  return false;
+}
+
 bool ElfSymbolTable::lookup(address addr, int* stringtableIndex, int* posIndex, int* offset, ElfFuncDescTable* funcDescTable) {
   assert(stringtableIndex, "null string table index pointer");
   assert(posIndex, "null string table offset pointer");
@@ -81,6 +167,13 @@ bool ElfSymbolTable::lookup(address addr, int* stringtableIndex, int* posIndex,
   Elf_Sym* symbols = (Elf_Sym*)_section.section_data();
 
   if (symbols != NULL) {
+    if (!_index_tried) {
+      _index_tried = true;
+      build_index(funcDescTable);
+    }
+    if (_index != NULL) {
+      return lookup_in_index(addr, stringtableIndex, posIndex, offset, funcDescTable);
+    }
     for (int index = 0; index < count; index ++) {
       if (compare(&symbols[index], addr, stringtableIndex, posIndex, offset, funcDescTable)) {
         return true;
@@ -34,9 +34,11 @@
 
 /*
  * symbol table object represents a symbol section in an elf file.
- * Whenever possible, it will load all symbols from the corresponding section
- * of the elf file into memory. Otherwise, it will walk the section in file
- * to look up the symbol that nearest the given address.
+ * Whenever possible, it will map the corresponding section of the elf file
+ * into memory, or else load it, and look up addresses through an index of
+ * the function symbols sorted by address, built on the first lookup.
+ * Otherwise, it will walk the section in file to look up the symbol that
+ * nearest the given address.
  */
 class ElfSymbolTable: public CHeapObj<mtInternal> {
   friend class ElfFile;
@@ -50,6 +52,25 @@ private:
   ElfSection      _section;
 
   NullDecoder::decoder_status _status;
+
+  // Entry of the address-sorted index.  max_end is the highest end address
+  // of this and all preceding entries, so a lookup knows how far back
+  // an enclosing symbol may start.
+  struct IndexEntry {
+    address _start;
+    address _max_end;
+    int     _symbol;        // index into the symbol section
+  };
+
+  IndexEntry*      _index;
+  int              _index_length;
+  bool             _index_tried;
+
+  bool build_index(ElfFuncDescTable* funcDescTable);
+  bool lookup_in_index(address addr, int* stringtableIndex, int* posIndex, int* offset, ElfFuncDescTable* funcDescTable);
+  static int compare_entries(const IndexEntry& e1, const IndexEntry& e2);
+  address symbol_address(const Elf_Sym* sym, ElfFuncDescTable* funcDescTable) const;
+
 public:
   ElfSymbolTable(FILE* const file, Elf_Shdr& shdr);
   ~ElfSymbolTable();
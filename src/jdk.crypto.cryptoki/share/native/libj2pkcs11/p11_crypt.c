@@ -132,7 +132,7 @@ Java_sun_security_pkcs11_wrapper_PKCS11_C_1Encrypt
  jlong directOut, jbyteArray jOut, jint jOutOfs, jint jOutLen)
 {
     CK_SESSION_HANDLE ckSessionHandle;
-    CK_RV rv;
+    CK_RV rv = CKR_OK;
 
     CK_BYTE_PTR inBufP;
     CK_BYTE_PTR outBufP;
@@ -166,8 +166,6 @@ Java_sun_security_pkcs11_wrapper_PKCS11_C_1Encrypt
                                     (CK_BYTE_PTR)(outBufP + jOutOfs),
                                     &ckEncryptedLen);
 
-    ckAssertReturnValueOK(env, rv);
-
 cleanup:
     if (directIn == 0 && inBufP != NULL) {
         (*env)->ReleasePrimitiveArrayCritical(env, jIn, inBufP, JNI_ABORT);
@@ -175,6 +173,8 @@ cleanup:
     if (directOut == 0 && outBufP != NULL) {
         (*env)->ReleasePrimitiveArrayCritical(env, jOut, outBufP, JNI_COMMIT);
     }
+    /* report errors only once the arrays are released */
+    ckAssertReturnValueOK(env, rv);
     return ckEncryptedLen;
 }
 #endif
@@ -198,7 +198,7 @@ Java_sun_security_pkcs11_wrapper_PKCS11_C_1EncryptUpdate
  jlong directOut, jbyteArray jOut, jint jOutOfs, jint jOutLen)
 {
     CK_SESSION_HANDLE ckSessionHandle;
-    CK_RV rv;
+    CK_RV rv = CKR_OK;
 
     CK_BYTE_PTR inBufP;
     CK_BYTE_PTR outBufP;
@@ -232,8 +232,6 @@ Java_sun_security_pkcs11_wrapper_PKCS11_C_1EncryptUpdate
                                           (CK_BYTE_PTR)(outBufP + jOutOfs),
                                           &ckEncryptedPartLen);
 
-    ckAssertReturnValueOK(env, rv);
-
 cleanup:
     if (directIn == 0 && inBufP != NULL) {
         (*env)->ReleasePrimitiveArrayCritical(env, jIn, inBufP, JNI_ABORT);
@@ -241,6 +239,8 @@ cleanup:
     if (directOut == 0 && outBufP != NULL) {
         (*env)->ReleasePrimitiveArrayCritical(env, jOut, outBufP, JNI_COMMIT);
     }
+    /* report errors only once the arrays are released */
+    ckAssertReturnValueOK(env, rv);
     return ckEncryptedPartLen;
 }
 #endif
@@ -368,7 +368,7 @@ Java_sun_security_pkcs11_wrapper_PKCS11_C_1Decrypt
  jlong directOut, jbyteArray jOut, jint jOutOfs, jint jOutLen)
 {
     CK_SESSION_HANDLE ckSessionHandle;
-    CK_RV rv;
+    CK_RV rv = CKR_OK;
 
     CK_BYTE_PTR inBufP;
     CK_BYTE_PTR outBufP;
@@ -401,8 +401,6 @@ Java_sun_security_pkcs11_wrapper_PKCS11_C_1Decrypt
                                     (CK_BYTE_PTR)(outBufP + jOutOfs),
                                     &ckOutLen);
 
-    ckAssertReturnValueOK(env, rv);
-
 cleanup:
     if (directIn == 0 && inBufP != NULL) {
         (*env)->ReleasePrimitiveArrayCritical(env, jIn, inBufP, JNI_ABORT);
@@ -410,6 +408,8 @@ cleanup:
     if (directOut == 0 && outBufP != NULL) {
         (*env)->ReleasePrimitiveArrayCritical(env, jOut, outBufP, JNI_COMMIT);
     }
+    /* report errors only once the arrays are released */
+    ckAssertReturnValueOK(env, rv);
     return ckOutLen;
 }
 #endif
@@ -433,7 +433,7 @@ Java_sun_security_pkcs11_wrapper_PKCS11_C_1DecryptUpdate
  jlong directOut, jbyteArray jOut, jint jOutOfs, jint jOutLen)
 {
     CK_SESSION_HANDLE ckSessionHandle;
-    CK_RV rv;
+    CK_RV rv = CKR_OK;
 
     CK_BYTE_PTR inBufP;
     CK_BYTE_PTR outBufP;
@@ -465,8 +465,6 @@ Java_sun_security_pkcs11_wrapper_PKCS11_C_1DecryptUpdate
                                           (CK_BYTE_PTR)(inBufP + jInOfs), jInLen,
                                           (CK_BYTE_PTR)(outBufP + jOutOfs),
                                           &ckDecryptedPartLen);
-    ckAssertReturnValueOK(env, rv);
-
 cleanup:
     if (directIn == 0 && inBufP != NULL) {
         (*env)->ReleasePrimitiveArrayCritical(env, jIn, inBufP, JNI_ABORT);
@@ -474,6 +472,8 @@ cleanup:
     if (directOut == 0 && outBufP != NULL) {
         (*env)->ReleasePrimitiveArrayCritical(env, jOut, outBufP, JNI_COMMIT);
     }
+    /* report errors only once the arrays are released */
+    ckAssertReturnValueOK(env, rv);
     return ckDecryptedPartLen;
 }
 
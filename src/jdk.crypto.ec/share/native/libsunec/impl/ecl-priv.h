@@ -48,6 +48,10 @@
 /* the following needs to go away... */
 #if defined(MP_USE_LONG_LONG_DIGIT) || defined(MP_USE_LONG_DIGIT)
 #define ECL_SIXTY_FOUR_BIT
+#if defined(__SIZEOF_INT128__)
+/* 64x64->128 bit multiplies for the fixed size P-256/P-384 code */
+#define ECL_USE_INT128
+#endif
 #else
 #define ECL_THIRTY_TWO_BIT
 #endif
@@ -286,6 +290,9 @@ mp_err ec_group_set_gfp224(ECGroup *group, ECCurveName);
 mp_err ec_group_set_gfp256(ECGroup *group, ECCurveName);
 mp_err ec_group_set_gfp384(ECGroup *group, ECCurveName);
 mp_err ec_group_set_gfp521(ECGroup *group, ECCurveName);
+#ifdef ECL_USE_INT128
+mp_err ec_group_set_nistp_64(ECGroup *group, ECCurveName name);
+#endif
 mp_err ec_group_set_gf2m163(ECGroup *group, ECCurveName name);
 mp_err ec_group_set_gf2m193(ECGroup *group, ECCurveName name);
 mp_err ec_group_set_gf2m233(ECGroup *group, ECCurveName name);
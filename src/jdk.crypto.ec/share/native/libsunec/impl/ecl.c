@@ -301,6 +301,19 @@ ecgroup_fromNameAndHex(const ECCurveName name,
                                                                 &order, params->cofactor);
                         if (group == NULL) { res = MP_UNDEF; goto CLEANUP; }
                         MP_CHECKOK(ec_group_set_gfp256(group, name));
+#ifdef ECL_USE_INT128
+                        MP_CHECKOK(ec_group_set_nistp_64(group, name));
+#endif
+                        break;
+                case ECCurve_SECG_PRIME_384R1:
+                        group =
+                                ECGroup_consGFp(&irr, &curvea, &curveb, &genx, &geny,
+                                                                &order, params->cofactor);
+                        if (group == NULL) { res = MP_UNDEF; goto CLEANUP; }
+                        MP_CHECKOK(ec_group_set_gfp384(group, name));
+#ifdef ECL_USE_INT128
+                        MP_CHECKOK(ec_group_set_nistp_64(group, name));
+#endif
                         break;
                 case ECCurve_SECG_PRIME_521R1:
                         group =
@@ -0,0 +1,692 @@
+/*
+ * Copyright (c) 2026 SAP SE. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/* Scalar multiplication for NIST P-256 and P-384 using fixed-size 64-bit
+ * limb Montgomery arithmetic. All routines run in time independent of the
+ * scalar and of the coordinates: field operations use masks instead of
+ * branches, points are added with the complete projective formulas of
+ * Renes, Costello and Batina ("Complete addition formulas for prime order
+ * elliptic curves", EUROCRYPT 2016, algorithms 4, 5 and 6 for a = -3) and
+ * precomputed points are fetched by scanning the whole table.
+ *
+ * The generator is multiplied with the comb method using the tables in
+ * ecp_64_table.h, an arbitrary point with a fixed 4-bit window. */
+
+#include "ecp.h"
+#include "mpi.h"
+#include "mplogic.h"
+#include "mpi-priv.h"
+#ifndef _KERNEL
+#include <string.h>
+#endif
+
+#ifdef ECL_USE_INT128
+
+#include "ecp_64_table.h"
+
+#define ECP64_MAX_LIMBS 6
+#define ECP64_COMB_TEETH 5
+#define ECP64_COMB_TABLES 4
+#define ECP64_COMB_SIZE ((1 << ECP64_COMB_TEETH) - 1)
+#define ECP64_WINDOW 4
+
+typedef unsigned __int128 ecp64_word;
+
+/* __int128 implies GCC or clang. The field routines below take the limb
+ * count as a parameter and are forced inline into per-curve callers so
+ * that their loops are unrolled for 4 and 6 limbs. */
+#define ECP64_INLINE __inline__ __attribute__((always_inline))
+
+typedef struct {
+        int n;                                  /* number of limbs */
+        const mp_digit *p;
+        mp_digit n0;                            /* -p^-1 mod 2^64 */
+        const mp_digit *rr;                     /* R^2 mod p */
+        const mp_digit *one;                    /* R mod p */
+        const mp_digit *b;                      /* curve b in Montgomery form */
+        const mp_digit *pm2;                    /* p - 2 */
+        int comb_spacing;
+        const mp_digit *comb;                   /* [tables][31][2n] */
+} ECP64Curve;
+
+/* Projective point (X : Y : Z) in Montgomery form; (0 : 1 : 0) is the point
+ * at infinity. */
+typedef struct {
+        mp_digit x[ECP64_MAX_LIMBS];
+        mp_digit y[ECP64_MAX_LIMBS];
+        mp_digit z[ECP64_MAX_LIMBS];
+} ECP64Point;
+
+static const ECP64Curve ecp64_p256 = {
+        4, ecp64_p256_p, ECP64_P256_N0, ecp64_p256_rr, ecp64_p256_one,
+        ecp64_p256_b, ecp64_p256_pm2, ECP64_P256_COMB_SPACING,
+        &ecp64_p256_comb[0][0][0]
+};
+
+static const ECP64Curve ecp64_p384 = {
+        6, ecp64_p384_p, ECP64_P384_N0, ecp64_p384_rr, ecp64_p384_one,
+        ecp64_p384_b, ecp64_p384_pm2, ECP64_P384_COMB_SPACING,
+        &ecp64_p384_comb[0][0][0]
+};
+
+/* Returns all ones if a == b, zero otherwise. */
+static mp_digit
+ecp64_eq_mask(mp_digit a, mp_digit b)
+{
+        mp_digit x = a ^ b;
+
+        return ((x | (0 - x)) >> (MP_DIGIT_BIT - 1)) - 1;
+}
+
+/* r = a if mask is all ones, r is unchanged if mask is zero. */
+static void
+ecp64_cmov(mp_digit *r, const mp_digit *a, mp_digit mask, int n)
+{
+        int i;
+
+        for (i = 0; i < n; i++) {
+                r[i] ^= mask & (r[i] ^ a[i]);
+        }
+}
+
+/* r = t - p if t (with the extra top bit hi) is not below p, r = t
+ * otherwise. Requires t < 2p. */
+static ECP64_INLINE void
+ecp64_reduce_once(mp_digit *r, const mp_digit *t, mp_digit hi,
+                                  const ECP64Curve *c, int n)
+{
+        mp_digit u[ECP64_MAX_LIMBS];
+        mp_digit borrow = 0, keep;
+        ecp64_word w;
+        int i;
+
+        for (i = 0; i < n; i++) {
+                w = (ecp64_word) t[i] - c->p[i] - borrow;
+                u[i] = (mp_digit) w;
+                borrow = (mp_digit) (w >> MP_DIGIT_BIT) & 1;
+        }
+        /* keep t when the subtraction underflowed past the top bit */
+        keep = 0 - ((hi ^ 1) & borrow);
+        for (i = 0; i < n; i++) {
+                r[i] = (t[i] & keep) | (u[i] & ~keep);
+        }
+}
+
+static ECP64_INLINE void
+ecp64_add_n(mp_digit *r, const mp_digit *a, const mp_digit *b,
+                        const ECP64Curve *c, int n)
+{
+        mp_digit t[ECP64_MAX_LIMBS];
+        mp_digit carry = 0;
+        ecp64_word w;
+        int i;
+
+        for (i = 0; i < n; i++) {
+                w = (ecp64_word) a[i] + b[i] + carry;
+                t[i] = (mp_digit) w;
+                carry = (mp_digit) (w >> MP_DIGIT_BIT);
+        }
+        ecp64_reduce_once(r, t, carry, c, n);
+}
+
+static ECP64_INLINE void
+ecp64_sub_n(mp_digit *r, const mp_digit *a, const mp_digit *b,
+                        const ECP64Curve *c, int n)
+{
+        mp_digit borrow = 0, carry = 0, mask;
+        ecp64_word w;
+        int i;
+
+        for (i = 0; i < n; i++) {
+                w = (ecp64_word) a[i] - b[i] - borrow;
+                r[i] = (mp_digit) w;
+                borrow = (mp_digit) (w >> MP_DIGIT_BIT) & 1;
+        }
+        /* add p back if a < b */
+        mask = 0 - borrow;
+        for (i = 0; i < n; i++) {
+                w = (ecp64_word) r[i] + (c->p[i] & mask) + carry;
+                r[i] = (mp_digit) w;
+                carry = (mp_digit) (w >> MP_DIGIT_BIT);
+        }
+}
+
+/* Montgomery multiplication r = a * b / R mod p (CIOS) for n limbs. r may
+ * alias a or b. */
+static ECP64_INLINE void
+ecp64_mont_mul(mp_digit *r, const mp_digit *a, const mp_digit *b,
+                           const ECP64Curve *c, int n)
+{
+        mp_digit t[ECP64_MAX_LIMBS + 2];
+        mp_digit m, carry;
+        ecp64_word w;
+        int i, j;
+
+        for (i = 0; i < n + 2; i++) {
+                t[i] = 0;
+        }
+        for (i = 0; i < n; i++) {
+                carry = 0;
+                for (j = 0; j < n; j++) {
+                        w = (ecp64_word) a[j] * b[i] + t[j] + carry;
+                        t[j] = (mp_digit) w;
+                        carry = (mp_digit) (w >> MP_DIGIT_BIT);
+                }
+                w = (ecp64_word) t[n] + carry;
+                t[n] = (mp_digit) w;
+                t[n + 1] = (mp_digit) (w >> MP_DIGIT_BIT);
+
+                m = t[0] * c->n0;
+                w = (ecp64_word) m * c->p[0] + t[0];
+                carry = (mp_digit) (w >> MP_DIGIT_BIT);
+                for (j = 1; j < n; j++) {
+                        w = (ecp64_word) m * c->p[j] + t[j] + carry;
+                        t[j - 1] = (mp_digit) w;
+                        carry = (mp_digit) (w >> MP_DIGIT_BIT);
+                }
+                w = (ecp64_word) t[n] + carry;
+                t[n - 1] = (mp_digit) w;
+                t[n] = t[n + 1] + (mp_digit) (w >> MP_DIGIT_BIT);
+        }
+        ecp64_reduce_once(r, t, t[n], c, n);
+}
+
+/* Field operations on elements of curve c. */
+static void
+ecp64_add(mp_digit *r, const mp_digit *a, const mp_digit *b,
+                  const ECP64Curve *c)
+{
+        if (c->n == 4) {
+                ecp64_add_n(r, a, b, c, 4);
+        } else {
+                ecp64_add_n(r, a, b, c, 6);
+        }
+}
+
+static void
+ecp64_sub(mp_digit *r, const mp_digit *a, const mp_digit *b,
+                  const ECP64Curve *c)
+{
+        if (c->n == 4) {
+                ecp64_sub_n(r, a, b, c, 4);
+        } else {
+                ecp64_sub_n(r, a, b, c, 6);
+        }
+}
+
+static void
+ecp64_mul(mp_digit *r, const mp_digit *a, const mp_digit *b,
+                  const ECP64Curve *c)
+{
+        if (c->n == 4) {
+                ecp64_mont_mul(r, a, b, c, 4);
+        } else {
+                ecp64_mont_mul(r, a, b, c, 6);
+        }
+}
+
+/* r = a^-1 mod p (in Montgomery form) by Fermat's little theorem; the
+ * exponent p - 2 is public so the square-and-multiply ladder does not
+ * leak anything about a. The inverse of zero is zero. */
+static void
+ecp64_inv(mp_digit *r, const mp_digit *a, const ECP64Curve *c)
+{
+        mp_digit t[ECP64_MAX_LIMBS];
+        int i, n = c->n;
+
+        for (i = 0; i < n; i++) {
+                t[i] = c->one[i];
+        }
+        for (i = n * MP_DIGIT_BIT - 1; i >= 0; i--) {
+                ecp64_mul(t, t, t, c);
+                if ((c->pm2[i / MP_DIGIT_BIT] >> (i % MP_DIGIT_BIT)) & 1) {
+                        ecp64_mul(t, t, a, c);
+                }
+        }
+        for (i = 0; i < n; i++) {
+                r[i] = t[i];
+        }
+}
+
+/* Loads a (reduced modulo p if necessary) into r in Montgomery form. */
+static mp_err
+ecp64_from_mp(mp_digit *r, const mp_int *a, const ECGroup *group,
+                          const ECP64Curve *c)
+{
+        mp_err res = MP_OKAY;
+        mp_digit t[ECP64_MAX_LIMBS];
+        mp_int at;
+        int i;
+
+        MP_DIGITS(&at) = 0;
+        if (MP_SIGN(a) != MP_ZPOS || mp_cmp(a, &group->meth->irr) >= 0) {
+                MP_CHECKOK(mp_init(&at, FLAG(a)));
+                MP_CHECKOK(mp_mod(a, &group->meth->irr, &at));
+                a = &at;
+        }
+        for (i = 0; i < c->n; i++) {
+                t[i] = (i < (int) MP_USED(a)) ? MP_DIGIT(a, i) : 0;
+        }
+        ecp64_mul(r, t, c->rr, c);
+
+  CLEANUP:
+        mp_clear(&at);
+        return res;
+}
+
+/* Stores a, converted out of Montgomery form, into r. */
+static mp_err
+ecp64_to_mp(mp_int *r, const mp_digit *a, const ECP64Curve *c)
+{
+        mp_err res = MP_OKAY;
+        mp_digit t[ECP64_MAX_LIMBS], one[ECP64_MAX_LIMBS];
+        int i;
+
+        for (i = 0; i < c->n; i++) {
+                one[i] = (i == 0);
+        }
+        ecp64_mul(t, a, one, c);
+
+        MP_CHECKOK(s_mp_pad(r, c->n));
+        for (i = 0; i < c->n; i++) {
+                MP_DIGIT(r, i) = t[i];
+        }
+        MP_SIGN(r) = MP_ZPOS;
+        MP_USED(r) = c->n;
+        s_mp_clamp(r);
+
+  CLEANUP:
+        return res;
+}
+
+/* Loads scalar k < 2^(64 * ECP64_MAX_LIMBS + 64) into k_out, zero padded. */
+static void
+ecp64_scalar(mp_digit *k_out, const mp_int *k)
+{
+        int i;
+
+        for (i = 0; i < ECP64_MAX_LIMBS + 1; i++) {
+                k_out[i] = (i < (int) MP_USED(k)) ? MP_DIGIT(k, i) : 0;
+        }
+}
+
+#define ECP64_BIT(k, i) (((k)[(i) / MP_DIGIT_BIT] >> ((i) % MP_DIGIT_BIT)) & 1)
+
+static void
+ecp64_set_inf(ECP64Point *r, const ECP64Curve *c)
+{
+        int i;
+
+        for (i = 0; i < c->n; i++) {
+                r->x[i] = 0;
+                r->y[i] = c->one[i];
+                r->z[i] = 0;
+        }
+}
+
+static void
+ecp64_pt_cmov(ECP64Point *r, const ECP64Point *a, mp_digit mask,
+                          const ECP64Curve *c)
+{
+        ecp64_cmov(r->x, a->x, mask, c->n);
+        ecp64_cmov(r->y, a->y, mask, c->n);
+        ecp64_cmov(r->z, a->z, mask, c->n);
+}
+
+/* r = a + b, complete for all inputs (algorithm 4). r may alias a or b. */
+static void
+ecp64_pt_add(ECP64Point *r, const ECP64Point *a, const ECP64Point *b,
+                         const ECP64Curve *c)
+{
+        mp_digit t0[ECP64_MAX_LIMBS], t1[ECP64_MAX_LIMBS], t2[ECP64_MAX_LIMBS];
+        mp_digit t3[ECP64_MAX_LIMBS], t4[ECP64_MAX_LIMBS];
+        mp_digit x3[ECP64_MAX_LIMBS], y3[ECP64_MAX_LIMBS], z3[ECP64_MAX_LIMBS];
+
+        ecp64_mul(t0, a->x, b->x, c);
+        ecp64_mul(t1, a->y, b->y, c);
+        ecp64_mul(t2, a->z, b->z, c);
+        ecp64_add(t3, a->x, a->y, c);
+        ecp64_add(t4, b->x, b->y, c);
+        ecp64_mul(t3, t3, t4, c);
+        ecp64_add(t4, t0, t1, c);
+        ecp64_sub(t3, t3, t4, c);
+        ecp64_add(t4, a->y, a->z, c);
+        ecp64_add(x3, b->y, b->z, c);
+        ecp64_mul(t4, t4, x3, c);
+        ecp64_add(x3, t1, t2, c);
+        ecp64_sub(t4, t4, x3, c);
+        ecp64_add(x3, a->x, a->z, c);
+        ecp64_add(y3, b->x, b->z, c);
+        ecp64_mul(x3, x3, y3, c);
+        ecp64_add(y3, t0, t2, c);
+        ecp64_sub(y3, x3, y3, c);
+        ecp64_mul(z3, c->b, t2, c);
+        ecp64_sub(x3, y3, z3, c);
+        ecp64_add(z3, x3, x3, c);
+        ecp64_add(x3, x3, z3, c);
+        ecp64_sub(z3, t1, x3, c);
+        ecp64_add(x3, t1, x3, c);
+        ecp64_mul(y3, c->b, y3, c);
+        ecp64_add(t1, t2, t2, c);
+        ecp64_add(t2, t1, t2, c);
+        ecp64_sub(y3, y3, t2, c);
+        ecp64_sub(y3, y3, t0, c);
+        ecp64_add(t1, y3, y3, c);
+        ecp64_add(y3, t1, y3, c);
+        ecp64_add(t1, t0, t0, c);
+        ecp64_add(t0, t1, t0, c);
+        ecp64_sub(t0, t0, t2, c);
+        ecp64_mul(t1, t4, y3, c);
+        ecp64_mul(t2, t0, y3, c);
+        ecp64_mul(y3, x3, z3, c);
+        ecp64_add(y3, y3, t2, c);
+        ecp64_mul(x3, x3, t3, c);
+        ecp64_sub(x3, x3, t1, c);
+        ecp64_mul(z3, t4, z3, c);
+        ecp64_mul(t1, t3, t0, c);
+        ecp64_add(z3, z3, t1, c);
+
+        memcpy(r->x, x3, sizeof(x3));
+        memcpy(r->y, y3, sizeof(y3));
+        memcpy(r->z, z3, sizeof(z3));
+}
+
+/* r = a + (bx, by) for an affine point other than infinity (algorithm 5).
+ * r may alias a. */
+static void
+ecp64_pt_add_aff(ECP64Point *r, const ECP64Point *a, const mp_digit *bx,
+                                 const mp_digit *by, const ECP64Curve *c)
+{
+        mp_digit t0[ECP64_MAX_LIMBS], t1[ECP64_MAX_LIMBS], t2[ECP64_MAX_LIMBS];
+        mp_digit t3[ECP64_MAX_LIMBS], t4[ECP64_MAX_LIMBS];
+        mp_digit x3[ECP64_MAX_LIMBS], y3[ECP64_MAX_LIMBS], z3[ECP64_MAX_LIMBS];
+
+        ecp64_mul(t0, a->x, bx, c);
+        ecp64_mul(t1, a->y, by, c);
+        ecp64_add(t3, bx, by, c);
+        ecp64_add(t4, a->x, a->y, c);
+        ecp64_mul(t3, t3, t4, c);
+        ecp64_add(t4, t0, t1, c);
+        ecp64_sub(t3, t3, t4, c);
+        ecp64_mul(t4, by, a->z, c);
+        ecp64_add(t4, t4, a->y, c);
+        ecp64_mul(y3, bx, a->z, c);
+        ecp64_add(y3, y3, a->x, c);
+        ecp64_mul(z3, c->b, a->z, c);
+        ecp64_sub(x3, y3, z3, c);
+        ecp64_add(z3, x3, x3, c);
+        ecp64_add(x3, x3, z3, c);
+        ecp64_sub(z3, t1, x3, c);
+        ecp64_add(x3, t1, x3, c);
+        ecp64_mul(y3, c->b, y3, c);
+        ecp64_add(t1, a->z, a->z, c);
+        ecp64_add(t2, t1, a->z, c);
+        ecp64_sub(y3, y3, t2, c);
+        ecp64_sub(y3, y3, t0, c);
+        ecp64_add(t1, y3, y3, c);
+        ecp64_add(y3, t1, y3, c);
+        ecp64_add(t1, t0, t0, c);
+        ecp64_add(t0, t1, t0, c);
+        ecp64_sub(t0, t0, t2, c);
+        ecp64_mul(t1, t4, y3, c);
+        ecp64_mul(t2, t0, y3, c);
+        ecp64_mul(y3, x3, z3, c);
+        ecp64_add(y3, y3, t2, c);
+        ecp64_mul(x3, x3, t3, c);
+        ecp64_sub(x3, x3, t1, c);
+        ecp64_mul(z3, t4, z3, c);
+        ecp64_mul(t1, t3, t0, c);
+        ecp64_add(z3, z3, t1, c);
+
+        memcpy(r->x, x3, sizeof(x3));
+        memcpy(r->y, y3, sizeof(y3));
+        memcpy(r->z, z3, sizeof(z3));
+}
+
+/* r = 2a, complete for all inputs (algorithm 6). r may alias a. */
+static void
+ecp64_pt_dbl(ECP64Point *r, const ECP64Point *a, const ECP64Curve *c)
+{
+        mp_digit t0[ECP64_MAX_LIMBS], t1[ECP64_MAX_LIMBS], t2[ECP64_MAX_LIMBS];
+        mp_digit t3[ECP64_MAX_LIMBS];
+        mp_digit x3[ECP64_MAX_LIMBS], y3[ECP64_MAX_LIMBS], z3[ECP64_MAX_LIMBS];
+
+        ecp64_mul(t0, a->x, a->x, c);
+        ecp64_mul(t1, a->y, a->y, c);
+        ecp64_mul(t2, a->z, a->z, c);
+        ecp64_mul(t3, a->x, a->y, c);
+        ecp64_add(t3, t3, t3, c);
+        ecp64_mul(z3, a->x, a->z, c);
+        ecp64_add(z3, z3, z3, c);
+        ecp64_mul(y3, c->b, t2, c);
+        ecp64_sub(y3, y3, z3, c);
+        ecp64_add(x3, y3, y3, c);
+        ecp64_add(y3, x3, y3, c);
+        ecp64_sub(x3, t1, y3, c);
+        ecp64_add(y3, t1, y3, c);
+        ecp64_mul(y3, x3, y3, c);
+        ecp64_mul(x3, x3, t3, c);
+        ecp64_add(t3, t2, t2, c);
+        ecp64_add(t2, t2, t3, c);
+        ecp64_mul(z3, c->b, z3, c);
+        ecp64_sub(z3, z3, t2, c);
+        ecp64_sub(z3, z3, t0, c);
+        ecp64_add(t3, z3, z3, c);
+        ecp64_add(z3, z3, t3, c);
+        ecp64_add(t3, t0, t0, c);
+        ecp64_add(t0, t3, t0, c);
+        ecp64_sub(t0, t0, t2, c);
+        ecp64_mul(t0, t0, z3, c);
+        ecp64_add(y3, y3, t0, c);
+        ecp64_mul(t0, a->y, a->z, c);
+        ecp64_add(t0, t0, t0, c);
+        ecp64_mul(z3, t0, z3, c);
+        ecp64_sub(x3, x3, z3, c);
+        ecp64_mul(z3, t0, t1, c);
+        ecp64_add(z3, z3, z3, c);
+        ecp64_add(z3, z3, z3, c);
+
+        memcpy(r->x, x3, sizeof(x3));
+        memcpy(r->y, y3, sizeof(y3));
+        memcpy(r->z, z3, sizeof(z3));
+}
+
+/* r = k * G with the comb tables: bit b of the index into table s at
+ * column i is bit (5s + b) * spacing + i of k. */
+static void
+ecp64_base_mul(ECP64Point *r, const mp_int *k, const ECP64Curve *c)
+{
+        mp_digit kd[ECP64_MAX_LIMBS + 1];
+        mp_digit tx[ECP64_MAX_LIMBS], ty[ECP64_MAX_LIMBS], mask;
+        const mp_digit *e;
+        ECP64Point sum;
+        int i, s, b, j, idx, n = c->n, d = c->comb_spacing;
+
+        ecp64_scalar(kd, k);
+        ecp64_set_inf(r, c);
+        for (i = d - 1; i >= 0; i--) {
+                ecp64_pt_dbl(r, r, c);
+                for (s = 0; s < ECP64_COMB_TABLES; s++) {
+                        idx = 0;
+                        for (b = 0; b < ECP64_COMB_TEETH; b++) {
+                                idx |= (int) ECP64_BIT(kd,
+                                        (ECP64_COMB_TEETH * s + b) * d + i) << b;
+                        }
+                        /* fetch entry idx without a data-dependent address */
+                        memset(tx, 0, sizeof(tx));
+                        memset(ty, 0, sizeof(ty));
+                        e = c->comb + s * ECP64_COMB_SIZE * 2 * n;
+                        for (j = 1; j <= ECP64_COMB_SIZE; j++, e += 2 * n) {
+                                mask = ecp64_eq_mask(j, idx);
+                                ecp64_cmov(tx, e, mask, n);
+                                ecp64_cmov(ty, e + n, mask, n);
+                        }
+                        /* index zero adds nothing, but the sum is computed
+                         * anyway and discarded */
+                        ecp64_pt_add_aff(&sum, r, tx, ty, c);
+                        ecp64_pt_cmov(r, &sum, ~ecp64_eq_mask(idx, 0), c);
+                }
+        }
+}
+
+/* r = k * (px, py) with a fixed window of 4 bits. */
+static mp_err
+ecp64_point_mul(ECP64Point *r, const mp_int *k, const mp_int *px,
+                                const mp_int *py, const ECGroup *group,
+                                const ECP64Curve *c)
+{
+        mp_err res = MP_OKAY;
+        mp_digit kd[ECP64_MAX_LIMBS + 1];
+        ECP64Point table[1 << ECP64_WINDOW], t;
+        int i, j, idx, n = c->n;
+
+        ecp64_set_inf(&table[0], c);
+        if (ec_GFp_pt_is_inf_aff(px, py) == MP_YES) {
+                ecp64_set_inf(&table[1], c);
+        } else {
+                MP_CHECKOK(ecp64_from_mp(table[1].x, px, group, c));
+                MP_CHECKOK(ecp64_from_mp(table[1].y, py, group, c));
+                memcpy(table[1].z, c->one, n * sizeof(mp_digit));
+        }
+        for (j = 2; j < (1 << ECP64_WINDOW); j++) {
+                if (j & 1) {
+                        ecp64_pt_add(&table[j], &table[j - 1], &table[1], c);
+                } else {
+                        ecp64_pt_dbl(&table[j], &table[j / 2], c);
+                }
+        }
+
+        ecp64_scalar(kd, k);
+        ecp64_set_inf(r, c);
+        for (i = n * MP_DIGIT_BIT - ECP64_WINDOW; i >= 0; i -= ECP64_WINDOW) {
+                for (j = 0; j < ECP64_WINDOW; j++) {
+                        ecp64_pt_dbl(r, r, c);
+                }
+                idx = (int) (kd[i / MP_DIGIT_BIT] >> (i % MP_DIGIT_BIT))
+                        & ((1 << ECP64_WINDOW) - 1);
+                memset(&t, 0, sizeof(t));
+                for (j = 0; j < (1 << ECP64_WINDOW); j++) {
+                        ecp64_pt_cmov(&t, &table[j], ecp64_eq_mask(j, idx), c);
+                }
+                ecp64_pt_add(r, r, &t, c);
+        }
+
+  CLEANUP:
+        return res;
+}
+
+/* Converts a to affine coordinates; infinity becomes (0, 0) as for the
+ * rest of the library. */
+static mp_err
+ecp64_to_affine(mp_int *rx, mp_int *ry, const ECP64Point *a,
+                                const ECP64Curve *c)
+{
+        mp_err res = MP_OKAY;
+        mp_digit zi[ECP64_MAX_LIMBS], t[ECP64_MAX_LIMBS];
+
+        ecp64_inv(zi, a->z, c);
+        ecp64_mul(t, a->x, zi, c);
+        MP_CHECKOK(ecp64_to_mp(rx, t, c));
+        ecp64_mul(t, a->y, zi, c);
+        MP_CHECKOK(ecp64_to_mp(ry, t, c));
+
+  CLEANUP:
+        return res;
+}
+
+/* Computes R = nP. Elliptic curve points P and R can be identical. Uses
+ * fixed size Montgomery arithmetic; timing is ignored as every scalar is
+ * processed in constant time. */
+static mp_err
+ec_GFp_nistp_64_pt_mul(const mp_int *n, const mp_int *px, const mp_int *py,
+                                           mp_int *rx, mp_int *ry, const ECGroup *group,
+                                           int timing)
+{
+        mp_err res = MP_OKAY;
+        const ECP64Curve *c = (const ECP64Curve *) group->extra1;
+        ECP64Point r;
+
+        (void)timing;
+        MP_CHECKOK(ecp64_point_mul(&r, n, px, py, group, c));
+        MP_CHECKOK(ecp64_to_affine(rx, ry, &r, c));
+
+  CLEANUP:
+        return res;
+}
+
+/* Computes R = nG with the precomputed comb tables. */
+static mp_err
+ec_GFp_nistp_64_base_mul(const mp_int *n, mp_int *rx, mp_int *ry,
+                                                 const ECGroup *group)
+{
+        const ECP64Curve *c = (const ECP64Curve *) group->extra1;
+        ECP64Point r;
+
+        ecp64_base_mul(&r, n, c);
+        return ecp64_to_affine(rx, ry, &r, c);
+}
+
+/* Computes R = k1G + k2P. Allows k1 = NULL or { k2, P } = NULL. Like
+ * ec_GFp_nistp_64_pt_mul, ignores timing. */
+static mp_err
+ec_GFp_nistp_64_pts_mul(const mp_int *k1, const mp_int *k2, const mp_int *px,
+                                                const mp_int *py, mp_int *rx, mp_int *ry,
+                                                const ECGroup *group, int timing)
+{
+        mp_err res = MP_OKAY;
+        const ECP64Curve *c = (const ECP64Curve *) group->extra1;
+        ECP64Point r, t;
+
+        (void)timing;
+        if (k2 == NULL || px == NULL || py == NULL) {
+                ARGCHK(k1 != NULL, MP_BADARG);
+                ecp64_base_mul(&r, k1, c);
+        } else {
+                MP_CHECKOK(ecp64_point_mul(&r, k2, px, py, group, c));
+                if (k1 != NULL) {
+                        ecp64_base_mul(&t, k1, c);
+                        ecp64_pt_add(&r, &r, &t, c);
+                }
+        }
+        MP_CHECKOK(ecp64_to_affine(rx, ry, &r, c));
+
+  CLEANUP:
+        return res;
+}
+
+/* Wire in the 64-bit limb scalar multiplication for P-256 and P-384. The
+ * field arithmetic of the group is left alone; it is still used for point
+ * validation. */
+mp_err
+ec_group_set_nistp_64(ECGroup *group, ECCurveName name)
+{
+        if (name == ECCurve_NIST_P256) {
+                group->extra1 = (void *) &ecp64_p256;
+        } else if (name == ECCurve_NIST_P384) {
+                group->extra1 = (void *) &ecp64_p384;
+        } else {
+                return MP_OKAY;
+        }
+        group->point_mul = &ec_GFp_nistp_64_pt_mul;
+        group->base_point_mul = &ec_GFp_nistp_64_base_mul;
+        group->points_mul = &ec_GFp_nistp_64_pts_mul;
+        return MP_OKAY;
+}
+
+#endif /* ECL_USE_INT128 */
@@ -0,0 +1,1846 @@
+/*
+ * Copyright (c) 2026 SAP SE. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/* This file is generated by make/scripts/generate_ecp64_table.py, do not
+ * edit it by hand. */
+
+#ifndef _ECP_64_TABLE_H
+#define _ECP_64_TABLE_H
+
+/* Constants and fixed-base comb tables for the 64-bit limb NIST P-256 and
+ * P-384 code in ecp_64.c. Limbs are stored least significant first. The
+ * values are derived from the curve parameters in ecl-curve.h; each of the
+ * four tables has 5 teeth. */
+
+/* P256: p, -p^-1 mod 2^64, R^2 mod p, R mod p, b*R mod p and p - 2 */
+static const mp_digit ecp64_p256_p[4] = {
+        0xffffffffffffffffULL, 0x00000000ffffffffULL,
+        0x0000000000000000ULL, 0xffffffff00000001ULL
+};
+static const mp_digit ecp64_p256_rr[4] = {
+        0x0000000000000003ULL, 0xfffffffbffffffffULL,
+        0xfffffffffffffffeULL, 0x00000004fffffffdULL
+};
+static const mp_digit ecp64_p256_one[4] = {
+        0x0000000000000001ULL, 0xffffffff00000000ULL,
+        0xffffffffffffffffULL, 0x00000000fffffffeULL
+};
+static const mp_digit ecp64_p256_b[4] = {
+        0xd89cdf6229c4bddfULL, 0xacf005cd78843090ULL,
+        0xe5a220abf7212ed6ULL, 0xdc30061d04874834ULL
+};
+static const mp_digit ecp64_p256_pm2[4] = {
+        0xfffffffffffffffdULL, 0x00000000ffffffffULL,
+        0x0000000000000000ULL, 0xffffffff00000001ULL
+};
+#define ECP64_P256_N0 0x0000000000000001ULL
+#define ECP64_P256_COMB_SPACING 13
+
+/* P256 comb table: entry [s][j - 1] holds the affine point
+ * sum(bit b of j * 2^((5 * s + b) * 13) * G), coordinates in Montgomery form. */
+static const mp_digit ecp64_p256_comb[4][31][8] = {
+    {
+        {
+            0x79e730d418a9143cULL, 0x75ba95fc5fedb601ULL,
+            0x79fb732b77622510ULL, 0x18905f76a53755c6ULL,
+            0xddf25357ce95560aULL, 0x8b4ab8e4ba19e45cULL,
+            0xd2e88688dd21f325ULL, 0x8571ff1825885d85ULL
+        },
+        {
+            0x80009862d5d721d5ULL, 0x0c3357a35bd3a182ULL,
+            0x27f3a83b7aa2cda4ULL, 0xb58ae74ef6f83085ULL,
+            0x2a911a812e6dad6bULL, 0xde286051f43d6c5bULL,
+            0x4bdccc41f996c4d8ULL, 0xe7312ec00ae1e24eULL
+        },
+        {
+            0x0d51d723cbfa40bdULL, 0xd5bcb3d56e125d25ULL,
+            0xd38307563eb80ef4ULL, 0x9e8ae698c862a769ULL,
+            0x8e317e6b811cd3d3ULL, 0xdaf2a13a6e2da88fULL,
+            0x19fccc84231c5196ULL, 0x8bff01ef6886e9c4ULL
+        },
+        {
+            0xf2369f0b879fbbedULL, 0x0ff0ae86da9d1869ULL,
+            0x5251d75956766f45ULL, 0x4984d8c02be8d0fcULL,
+            0x7ecc95a6d21008f0ULL, 0x29bd54a03a1a1c49ULL,
+            0xab9828c5d26c50f3ULL, 0x32c0087c51d0d251ULL
+        },
+        {
+            0xa0fd31d422e8ec59ULL, 0x4083bfc1c6c20d0eULL,
+            0x72ec9b87892396d8ULL, 0xae8932931f29988eULL,
+            0xf7f0511fd2d7d7beULL, 0x5fc40179062aae82ULL,
+            0x67edcaef6229d211ULL, 0x9630567160093ea0ULL
+        },
+        {
+            0x0e0f2bb5f0321c9eULL, 0x7d8379fd6782f2c7ULL,
+            0x4cbc3eebadafc70dULL, 0x46fc3c65d0cff85bULL,
+            0xc2b4aa9c3a9357e2ULL, 0xdd9c7d2203d4a8d4ULL,
+            0xf30ac6e181a12600ULL, 0x8361933d7492bb3bULL
+        },
+        {
+            0xe7b5f227e91ae70bULL, 0x5fea1750e1cecc3bULL,
+            0xc224b68f27de7145ULL, 0x02fd5a5ae78441ebULL,
+            0xef82506e6b8d9ee3ULL, 0x2fe096e6a4d71d96ULL,
+            0x89419a9e809bea95ULL, 0x4fcc109cc0392db1ULL
+        },
+        {
+            0x5109b78571ba1861ULL, 0x48b22d5cd0c8f93dULL,
+            0xe8fa84a78633bb93ULL, 0x53fba6ba5aebbd08ULL,
+            0x7ff27df3e5eea7d8ULL, 0x521c879668ca7158ULL,
+            0xb9d5133bce6f1a05ULL, 0x2d50cd53fd0ebee4ULL
+        },
+        {
+            0x5f1a838347df8d33ULL, 0x1418816d1ac4043dULL,
+            0x26f65eeb0995a0deULL, 0xef86affc08a5f4eaULL,
+            0x187f7fbbcdd34363ULL, 0x5a0140890a3ad666ULL,
+            0x25fea57a0a4bc7aaULL, 0x447c90b33cd78a3bULL
+        },
+        {
+            0x90225b096c3545feULL, 0x7ea479ebafdcaaa8ULL,
+            0x95797ab6f4389842ULL, 0x6083eb92961ba504ULL,
+            0x9d11f18eda688b96ULL, 0x063e51b5f5d9a5acULL,
+            0x13040ccdfb8ffc22ULL, 0x9069f5d8763a7678ULL
+        },
+        {
+            0x5288dbe03868b393ULL, 0x7516800d3a23fc89ULL,
+            0x4e705b18affe0ca7ULL, 0x04e4e4af9e08e741ULL,
+            0xdf5e536c6f95a9a3ULL, 0xbe5f30551cf203daULL,
+            0xa77427d135ca6d91ULL, 0x24b595f69dbbaa74ULL
+        },
+        {
+            0x65e71152935f7ed2ULL, 0xe5e063c065acd147ULL,
+            0xc64556e15c2c1bb7ULL, 0xc8fd1bf229986722ULL,
+            0xf8bb3f6b3a212516ULL, 0xa48b6cef7acce8c4ULL,
+            0xe34aa8aa623034e8ULL, 0xaefb61e39bd76b74ULL
+        },
+        {
+            0x4da5fa3e5779c6deULL, 0xa51890bf958b2dd8ULL,
+            0xc4907e340fca8d8fULL, 0x0120b3c04b6dfba8ULL,
+            0x8cca2fa4d532dec2ULL, 0xb2d871958bdc6874ULL,
+            0x456b2f15a6c0ffa3ULL, 0x8a9a84bb972d7221ULL
+        },
+        {
+            0xdb718ed87ebfc9d8ULL, 0x4552fa1bb9b8d419ULL,
+            0xa81a9528d9fa652aULL, 0x591a305600a320f1ULL,
+            0x1d8fd3a41c915191ULL, 0x5c58815cf024760dULL,
+            0xaff6242c11dc04b1ULL, 0x0f956e42730d6d73ULL
+        },
+        {
+            0x220fc2feb3587f66ULL, 0x748593844bf90b39ULL,
+            0x6028ad322fefc35aULL, 0xcbcce93ea336688bULL,
+            0xdd89bbf4fe74420eULL, 0x67efa77f5a07dcc6ULL,
+            0x39b7748b62945826ULL, 0xdbbc922a32286a03ULL
+        },
+        {
+            0x83f49167ceca9754ULL, 0x426d2cf64b7939a0ULL,
+            0x2555e355723fd0bfULL, 0xa96e6d06c4f144e2ULL,
+            0x4768a8dd87880e61ULL, 0x15543815e508e4d5ULL,
+            0x09d7e772b1b65e15ULL, 0x63439dd6ac302fa0ULL
+        },
+        {
+            0xf2675562a0be5d0eULL, 0x4b524d254d1bb068ULL,
+            0xbc2c5ff2a9b75b8cULL, 0x4f326643d9a6f548ULL,
+            0x50dd68441258835eULL, 0x7d21beee676090e0ULL,
+            0xb0b62c65f4a17b42ULL, 0x60dfae28b3cec3b0ULL
+        },
+        {
+            0x98cf534ce9bd2811ULL, 0x70e812b8e28ff10fULL,
+            0xf2b964d59fe87285ULL, 0x66bb01363a498761ULL,
+            0x6fd465f7751e41a4ULL, 0xf517bfca2d6f40bbULL,
+            0x7d22f919aada97d4ULL, 0x1634a7921ac4d44eULL
+        },
+        {
+            0xf379c939a5fcf856ULL, 0x39135dac50ce7b94ULL,
+            0x3e3a2ebf6556652fULL, 0x006b2b4084eed936ULL,
+            0x2b2fcb758364634aULL, 0xd60fe238a32b74d5ULL,
+            0x66425f07ca471dc9ULL, 0x008472d55e731a00ULL
+        },
+        {
+            0xceea69a66c029990ULL, 0x0c0765a08b9a9ecdULL,
+            0xef6f3d36633e6712ULL, 0x1e7c2307cd1ef0c2ULL,
+            0xab0fe770546548b5ULL, 0xc3bee5cf785673bcULL,
+            0xa48b81576fb58206ULL, 0xed45c72021e7555aULL
+        },
+        {
+            0x34c86ea74adc5981ULL, 0x05fe20bba614d11fULL,
+            0xf8f6b0a18ea71df8ULL, 0x3ec8a969ce7ae412ULL,
+            0x5de6c695a2b3c5adULL, 0x54578aa97fb06b92ULL,
+            0x244d09d909cf8e6aULL, 0xb0fff1394a95b3b4ULL
+        },
+        {
+            0x11aaad5ede96dc22ULL, 0x91e5bb9a0df0b170ULL,
+            0x8da6c8480b1ac009ULL, 0x69ac4271db1b0858ULL,
+            0xc45c1b42f4fdf8a3ULL, 0x05a48ad2865b1559ULL,
+            0x05452856d02287d8ULL, 0x8261bb4e2451db3bULL
+        },
+        {
+            0x6e80b69907eaf68dULL, 0xfeceabb38528642dULL,
+            0xe18f0fa91fc58c04ULL, 0xc545e4c0ce89a111ULL,
+            0xb232273d3aa606cfULL, 0x7ced4d6ba498fe86ULL,
+            0x49d110866c8c2ffdULL, 0xeb2fc4fe1261f5b9ULL
+        },
+        {
+            0x271214018695e156ULL, 0x91ab0d67250dbb61ULL,
+            0x529a7bc81486e2dfULL, 0x033802f548a73e69ULL,
+            0x6a4c79c350a3cdb1ULL, 0x91dd0f4700b4a7c0ULL,
+            0x15a9d7a213b870c2ULL, 0x6db9e5d20970f823ULL
+        },
+        {
+            0x0338390a544cebcdULL, 0x38a40f438e141caaULL,
+            0xdb9972327dbc98c0ULL, 0xba42a0849468b7f0ULL,
+            0xe4600ff59bd61245ULL, 0xb08a22310f8103a0ULL,
+            0x94b0badd4a28628fULL, 0x247e3c6e1afcf9fdULL
+        },
+        {
+            0xe556e347cb5a8f7fULL, 0x3c3fe0e957c423c5ULL,
+            0xf63a5f42fc227fc4ULL, 0xbc84deac9c93be44ULL,
+            0x458c2ef89b87d4b5ULL, 0xa94d111b29cb0882ULL,
+            0xd4d234e802c9c5c0ULL, 0xf9dd41fcd7240329ULL
+        },
+        {
+            0x1428962ca48849a3ULL, 0xcddf09d7351332f9ULL,
+            0x5c24130b15b8ae9eULL, 0x43363c86b4eb6a77ULL,
+            0x55fd20883206b993ULL, 0xa54ba8ada7a3e2bdULL,
+            0x7ceb99cadee2217eULL, 0xd7996a6eea36972dULL
+        },
+        {
+            0x413e3b787d6c99cbULL, 0x75978ac4f2771720ULL,
+            0x9b45e0aa13b0ec41ULL, 0x1dfd2722e1db36f0ULL,
+            0xb539404ebaffaa2eULL, 0xd8eedb946b2a20ddULL,
+            0xc10c85f16aa6414cULL, 0xb416d475ac6bf2d7ULL
+        },
+        {
+            0xe973197b447fd8bcULL, 0x94151356e62e27fbULL,
+            0x8eaaa7643cc67bc8ULL, 0x42b6ad49da28083cULL,
+            0x64d17c97c1319b88ULL, 0x9b49b9b2aaa5cb2eULL,
+            0xb0d069440307950cULL, 0x23e9a0b8d0cd1019ULL
+        },
+        {
+            0x3ea262e8d34c7d81ULL, 0x261e8538239c0988ULL,
+            0x854cc8832989681cULL, 0xc58506d2c1f27c05ULL,
+            0xfd8c5e2dddeb489cULL, 0x2f4a6acbe3acf506ULL,
+            0xb4d5b3a8db434158ULL, 0xed452b5cb3e07947ULL
+        },
+        {
+            0xc7663633e0f4d67eULL, 0xff5ac14cdd7ca58bULL,
+            0x41630907c0020895ULL, 0xd320188c4646161aULL,
+            0xc40f2bc6334f36fcULL, 0x6b88a71576cf9b07ULL,
+            0x38b990908506f0d0ULL, 0x01906400591b1f82ULL
+        }
+    },
+    {
+        {
+            0x027cc8b8fac61d9aULL, 0x7d25e062e3c6fe8aULL,
+            0xe08805bfe5bff503ULL, 0x13271e6c6ff632f7ULL,
+            0x55dca6c0232f76a5ULL, 0x8957c32d701ef426ULL,
+            0xee728bcba10a5178ULL, 0x5ea60411b62c5173ULL
+        },
+        {
+            0x96649933aed1d1f7ULL, 0x566eaff350563090ULL,
+            0x345057f0ad2e39cfULL, 0x148ff65b1f832124ULL,
+            0x042e89d4cf94cf0dULL, 0x319bec84520c58b3ULL,
+            0x2a2676265361aa0dULL, 0xc86fa3028fbc87adULL
+        },
+        {
+            0x275783e3ac118d02ULL, 0xda5d19ac2ae8258bULL,
+            0xf07669e61079bfe6ULL, 0x37b0ba175fac136bULL,
+            0x20e7596ea0bdc379ULL, 0xb9f5fcb6aa883b08ULL,
+            0xf0466e82c74afcc1ULL, 0x20f89bb6cae3c1c7ULL
+        },
+        {
+            0x1cb43668e039c256ULL, 0x5f26fb8b7c17fd5dULL,
+            0xeee426af79aa062bULL, 0x072002d0d78fbf04ULL,
+            0x4c9ca237e84fb7e3ULL, 0xb401d8a10c82133dULL,
+            0xaaa525926d7e4181ULL, 0xe943083373dbb152ULL
+        },
+        {
+            0x8f592af90be526ddULL, 0x64a8bb00833d07d2ULL,
+            0xbefdb6c87c10c2a0ULL, 0x73dc23baba2e54fbULL,
+            0x3486f434595d9072ULL, 0xe80edb94e42f03d9ULL,
+            0x33379ce65ea3a96dULL, 0x79c06f74229f0231ULL
+        },
+        {
+            0x3c1a96194a2ad3ecULL, 0xf69115d5e72195c1ULL,
+            0x18cfcb9ed42c0edaULL, 0x4e1d3f3a0aa15c71ULL,
+            0xb9340415f6195dedULL, 0xbe3393f5d3cdb3f5ULL,
+            0x48a6ffea558613caULL, 0xa37916c4a194a9c7ULL
+        },
+        {
+            0x5388f8e277dcd287ULL, 0xc8fc44311b089be7ULL,
+            0xcf5845ee20f5c0bcULL, 0x772c2ed5fc1b7603ULL,
+            0x6915eda23ce1b0b0ULL, 0x7f190ff5ff9c7c45ULL,
+            0xd0f49021ebc78aa2ULL, 0x5b1e5e83d5323fafULL
+        },
+        {
+            0x20d3c982cf7d62d2ULL, 0x1f36e29d23ba8150ULL,
+            0x48ae0bf092763f9eULL, 0x7a527e6b1d3a7007ULL,
+            0xb4a89097581a85e3ULL, 0x1f1a520fdc158be5ULL,
+            0xf98db37d167d726eULL, 0x8802786e1113e862ULL
+        },
+        {
+            0x085d8685dec55bdbULL, 0x49b71f060e943e48ULL,
+            0xbf7c2dacee7942f7ULL, 0xe62a02bd981278c5ULL,
+            0x842a8ba004122a7aULL, 0x810bf45f9a7f9096ULL,
+            0x0b2f0c27aa2369d0ULL, 0xef0979a77fc1d040ULL
+        },
+        {
+            0x92bae6c281ac90f0ULL, 0x567141659fca8739ULL,
+            0x9a3e78874d63a811ULL, 0xc0c7bf4bfeaea0f3ULL,
+            0x165c324814b7567aULL, 0x96f5ec09718d9bc5ULL,
+            0xe5ff206fcb4adba0ULL, 0x8214bffb67a4b223ULL
+        },
+        {
+            0x1c60f5a9f627c427ULL, 0x3bb60042b43cfd8bULL,
+            0x6563a069a641284cULL, 0xa4afa25a890fdee4ULL,
+            0xcd01aac2eb476481ULL, 0x8ec8484a2cbc0432ULL,
+            0x50f9401798ca733bULL, 0x5107e15366e4ca27ULL
+        },
+        {
+            0xfde989a043c5b0fdULL, 0xe9c8974f2e8fd33bULL,
+            0xfed8883144fd3b8cULL, 0x5b4350e7feb50d63ULL,
+            0x56c170240257958aULL, 0x6442bd5303118f05ULL,
+            0x0c6f95008f6a8cb8ULL, 0x185e483f616e886aULL
+        },
+        {
+            0x901d7cbdc8e31cf5ULL, 0xf6f204326271befeULL,
+            0x5b1a33ead0b30cd8ULL, 0xff880552beb5e4eeULL,
+            0xb0106d3c661ce201ULL, 0x0971fffb109f5b05ULL,
+            0xbca65b9f5e5121d2ULL, 0x039236649ac0182bULL
+        },
+        {
+            0x3e988ccaf95d8778ULL, 0xfeaf99b2d482365eULL,
+            0xcd8ddd5e34c9110bULL, 0x18823887e429c5d9ULL,
+            0xb29fef9bb0464ddfULL, 0xa833d4bec415a089ULL,
+            0xef52e2e261d27678ULL, 0x20d04ccaf8e21cb3ULL
+        },
+        {
+            0x914a3848e812401fULL, 0x99c850e9e2f2307fULL,
+            0x747b44980e71e005ULL, 0x6c50d375710ea239ULL,
+            0x0c9bf9186473c863ULL, 0x4488ffb930e0630bULL,
+            0xe589231916ff67b6ULL, 0x60719bd3bce98319ULL
+        },
+        {
+            0x5a4b46c64a8a3d62ULL, 0x8469c4d0247743d2ULL,
+            0x2bb3a13d88f7e433ULL, 0x62b23a1001be5849ULL,
+            0xe83596b4a63d1a4cULL, 0x454e7fea7d183f3eULL,
+            0x643fce6117afb01cULL, 0x4e65e5e61c4c3638ULL
+        },
+        {
+            0x591f9ce26d7c89e9ULL, 0x8ac0b8edc55b0643ULL,
+            0xe57eea44fcc78bebULL, 0xd799d809688008caULL,
+            0xb81d19b9fd5c76e7ULL, 0x0ebd040d3ec8d418ULL,
+            0x0156019983767761ULL, 0x6ee277a547cdac80ULL
+        },
+        {
+            0x211c387c7ebc6317ULL, 0xb58153cb7fe79023ULL,
+            0xbd1e01ace191ecc6ULL, 0xab13d65b8104639dULL,
+            0x290b2ed84da66d69ULL, 0xcd1135105357dce7ULL,
+            0xb44f79ad693b7c3dULL, 0x594249c81b862590ULL
+        },
+        {
+            0x555add058936a485ULL, 0x298222fa329bbc65ULL,
+            0x57eaaf0f0ba5441eULL, 0xe419d2281e9580f2ULL,
+            0xe15712d9d57251a4ULL, 0xb30806afbd3a930bULL,
+            0xf90e0bc36552a055ULL, 0x76dd5ca5131a2ea9ULL
+        },
+        {
+            0x8bc8714ecfab5710ULL, 0x55b19fcbbc552657ULL,
+            0x61b45f9883fae884ULL, 0x184d3703675c9342ULL,
+            0x1fcf6aa4b5233b00ULL, 0xeb715667ebb275e5ULL,
+            0x4eaa2ec95f17bb44ULL, 0xf069989244fbe977ULL
+        },
+        {
+            0x93df525b676e8747ULL, 0x09a1a9c3a90b5e62ULL,
+            0x79b2a1f61d7717a2ULL, 0x93abece602c2ece3ULL,
+            0x2640c0074566d5f7ULL, 0x5d718ba611b5d2c9ULL,
+            0x602c670a87da5654ULL, 0xbaeabf2af25fd910ULL
+        },
+        {
+            0x1cc0aa3dbaa36d37ULL, 0x4c8a66457b884b2eULL,
+            0x24dc21023807a963ULL, 0x843c4aeb298b312dULL,
+            0xfe6fe09c83eef330ULL, 0x812202f90b84b9beULL,
+            0xbbf31af964ae2bccULL, 0xfc4356b690253e31ULL
+        },
+        {
+            0x7a16564e390031a4ULL, 0xe14950b2b6faa71aULL,
+            0x81e3f3af89e2e758ULL, 0x406b18d8c16662f1ULL,
+            0x741ca8723f431f39ULL, 0xe0df4d1257f1644fULL,
+            0x1093914745374813ULL, 0x4904a8aab361cdb4ULL
+        },
+        {
+            0xc05ae9ef3b0236e3ULL, 0x305ef2c41af27e67ULL,
+            0x0de8a1bb3887c5e6ULL, 0x6ad0373614bdf0f1ULL,
+            0x0641c41f589ea82cULL, 0x1e47de7333bdaaf4ULL,
+            0x4303abc9b16a40e3ULL, 0xd46171b3597b5f21ULL
+        },
+        {
+            0xcc20a371faf8dae8ULL, 0x26fafa86236312ddULL,
+            0xad2541f1c4e71db4ULL, 0x2f1e09644afe6966ULL,
+            0x3f869c1af81060e5ULL, 0x328a482c5d256421ULL,
+            0x0bb38a90b932d2c9ULL, 0x89bbbad809a59ce1ULL
+        },
+        {
+            0x596c55aedd7fcabcULL, 0x49750bca31f4c259ULL,
+            0x015fac0022aa5e95ULL, 0xcb60abc25f8e8b15ULL,
+            0xda202a48d5dbb9eeULL, 0x9737783033fa3fa6ULL,
+            0xa27729031e33d24cULL, 0x262735f378e693f8ULL
+        },
+        {
+            0xceee708cbe49fa3cULL, 0x140c6f3aed23c2feULL,
+            0xd5e029fe65db6e4fULL, 0xcde72449b4fa8813ULL,
+            0xd9f79cd20323b7c9ULL, 0x4da3f5f7b52d7709ULL,
+            0x898fe29d9cf4f86cULL, 0x58cf66f65108c86bULL
+        },
+        {
+            0x4e0cf3c14b08fd14ULL, 0xc66e365cb63f75fcULL,
+            0x61ac5ae1a0efb37eULL, 0x141a54d07b7109cbULL,
+            0xb1ecb5fb59717067ULL, 0xdf14e12aac64d3f0ULL,
+            0x680b62ae02ba81bdULL, 0xb4cba8e72a37a78bULL
+        },
+        {
+            0xcab4017933801a92ULL, 0x7b1a1bc894b6095cULL,
+            0x3567b439353a1904ULL, 0x97608b436cfde315ULL,
+            0x004390ac555f9ac7ULL, 0xc33e74877733966fULL,
+            0xd024b9d40bb4bb28ULL, 0xcf2c6f0d3845fa22ULL
+        },
+        {
+            0x3df5563bae42157aULL, 0xe0bced5102dba7abULL,
+            0x7388f04fb87ffea8ULL, 0xc8686038c85f92ddULL,
+            0x25314554fb69596cULL, 0xb405b886f210dcdbULL,
+            0x255fd15b697ca21aULL, 0x46c45c0a92ac7b53ULL
+        },
+        {
+            0xb2d9a7290f2e95c2ULL, 0xdc8c491a5ce8cfbdULL,
+            0x723e1dda7e72149fULL, 0xeb387460879dc0eaULL,
+            0x1e61c262d06df99fULL, 0x221573cc689b216eULL,
+            0x657cc913b3b421f0ULL, 0x721a2dfe8ba1f027ULL
+        }
+    },
+    {
+        {
+            0xb4480f0441c23fa3ULL, 0xb4712eb0c1989a2eULL,
+            0x3ccbba0f93a29ca7ULL, 0x6e205c14d619428cULL,
+            0x90db7957b3641686ULL, 0x0432691d45ac8b4eULL,
+            0x07a759acf64e0350ULL, 0x0514d89c9c972517ULL
+        },
+        {
+            0xa3e3369390d45871ULL, 0xe976404006166d8dULL,
+            0xb5c3368289a90403ULL, 0x4bd1798372f1d637ULL,
+            0xa616679ed5d2c53aULL, 0x5ec4bcd8fdcf3b87ULL,
+            0xae6d7613b66a694eULL, 0x7460fc76e3fc27e5ULL
+        },
+        {
+            0x97148478db6d3301ULL, 0x090156a492ca470dULL,
+            0xb92d573feb1cc760ULL, 0xf88792ada81f0659ULL,
+            0x2c0524561c2dee5eULL, 0x598cc3428fa2977bULL,
+            0x1cde388a07fd0d64ULL, 0x2eb94cae1c51006cULL
+        },
+        {
+            0x488f1185ca8d9d1aULL, 0xadf2c77dd987ded2ULL,
+            0x5f3039f060c46124ULL, 0xe5d70b7571e095f4ULL,
+            0x82d586506260e70fULL, 0x39d75ea7f750d105ULL,
+            0x8cf3d0b175bac364ULL, 0xf3a7564d21d01329ULL
+        },
+        {
+            0x8bb4edc3f611aaa9ULL, 0x3993073f5d9964adULL,
+            0xb582b8297235bd4fULL, 0x0f949f3cc17d5a38ULL,
+            0x52c21a6a9d42739bULL, 0xf4b0f82c1208c919ULL,
+            0xd2dd1a71ec93a693ULL, 0xabb0688e4d1a050bULL
+        },
+        {
+            0x5dbb87d9e5104e17ULL, 0x059e3cde8a52e28eULL,
+            0xe6dec00a3ccd88eeULL, 0x6272793e896fb480ULL,
+            0xe96644f9b27405bfULL, 0x86cdb7fb48700d04ULL,
+            0x07b95880a67d3019ULL, 0x3cd8916bb0e4f310ULL
+        },
+        {
+            0x2212d174dd9dbaa3ULL, 0xee0454f65ea44d1dULL,
+            0x390cf3a5c9ad654cULL, 0x38fb1bc1b28eac9cULL,
+            0x653c139e74738393ULL, 0x0d4f3c2b2004dd4bULL,
+            0x5c32166cc1fce4e3ULL, 0x5a5626451e696718ULL
+        },
+        {
+            0x0435d97a205b9d8bULL, 0x6eb8f064056756d4ULL,
+            0xd5e88a8bb6f8210eULL, 0x070ef12dec9fd9eaULL,
+            0x4d8495053bcc876aULL, 0x12a75338a7404ce3ULL,
+            0xd22b49e1b8a1db5eULL, 0xec1f205114bfa5adULL
+        },
+        {
+            0xd9ab213c74afca46ULL, 0x516a5a8c9c1ee4cdULL,
+            0xb6190830de0ce864ULL, 0x73f4756a3468b97eULL,
+            0x1302954ba066f427ULL, 0x1b09ec813e34aa26ULL,
+            0xed14ab1ab4e7c460ULL, 0x64d76e83f8507539ULL
+        },
+        {
+            0x8b8209725c5bc644ULL, 0x50ecaeff79c0912bULL,
+            0xd62f80a792ea4f01ULL, 0x3f3d5ec3a05e0bc6ULL,
+            0x7506241f634f8bbbULL, 0x7cc455c146f20c0fULL,
+            0xeeb0595369da1db3ULL, 0xe4bf0e8b3bbb530dULL
+        },
+        {
+            0x118488e0f2bf1d21ULL, 0x4f4e7db65f0f73d5ULL,
+            0xda38795cedf90578ULL, 0xd2c6a50e36c71c63ULL,
+            0xd19a382f5de5e85dULL, 0x5dfcc2f1d238d0ceULL,
+            0xa77ad697f6d562bcULL, 0x3ec05a5860d35f13ULL
+        },
+        {
+            0xa0907d0f70e9fe01ULL, 0x50be7c833b85097fULL,
+            0x51c6258c20171ad2ULL, 0x6b5e281b746591c6ULL,
+            0x3445591862afa1cfULL, 0x158947beefc8eb9dULL,
+            0x6de89cd6e759a068ULL, 0x05475f45dee60a8bULL
+        },
+        {
+            0xc466f5614e04d490ULL, 0x1c783f5c2c26fe38ULL,
+            0x4690dbb226f28730ULL, 0xbca7380bada51fd5ULL,
+            0x199c29c3cf7823d1ULL, 0x209af8d2aaf86f4bULL,
+            0xfe8f9f78329200f9ULL, 0x0586887281232a60ULL
+        },
+        {
+            0x7a97128a15ed65fbULL, 0xb8fcc1e3b8548764ULL,
+            0x12e6541b4a478bddULL, 0x63aec8eafd985b52ULL,
+            0x8ae070f83929ca38ULL, 0x5653aade31724a4cULL,
+            0xd0fb9ba8973e8969ULL, 0x36b3ee595ee28b00ULL
+        },
+        {
+            0x63b7ef751a02f95cULL, 0xbc4f279a07c65cd3ULL,
+            0x20e617443026415cULL, 0xc0209dd41b91af20ULL,
+            0x05ac76ce74d36c7eULL, 0x0114ef9bf4a05e47ULL,
+            0x10329eb6871d1829ULL, 0x10d5391109a6d2a6ULL
+        },
+        {
+            0x01079383171b445fULL, 0x9bcf21e38131ad4cULL,
+            0x8cdfe205c93987e8ULL, 0xe63f4152c92e8c8fULL,
+            0x729462a930add43dULL, 0x62ebb143c980f05aULL,
+            0x4f3954e53b06e968ULL, 0xfe1d75ad242cf6b1ULL
+        },
+        {
+            0x18eb175ac35bb745ULL, 0x4473e59c0d32a3beULL,
+            0x2f7318bd7928e292ULL, 0x32509ca6c8761bc2ULL,
+            0xfa311e197408a58eULL, 0x1cf3fd6d2b21fd58ULL,
+            0x57d3945b66332647ULL, 0x4288f14d622f834bULL
+        },
+        {
+            0xa14fade7e4992e74ULL, 0x7b9a0262807908beULL,
+            0x99ce48e3e5e24676ULL, 0x53926a65ec412e47ULL,
+            0xfe65893993511946ULL, 0xf0bb4a4a6cc1ad1dULL,
+            0xd99e33200d75f57cULL, 0x84fb78cc50dd0babULL
+        },
+        {
+            0x53df81a6932b6b6fULL, 0xc0b61413ebaeb291ULL,
+            0xd44c9c088bc6f50bULL, 0x9d43134e0de1a826ULL,
+            0x4e9cc9972b74fdd3ULL, 0x8c715bff441250adULL,
+            0x53899603607b5504ULL, 0x024bc5283b1d3882ULL
+        },
+        {
+            0x33476f9fd26add7bULL, 0x32ffe20e131a932cULL,
+            0x708af5a16e31d9d6ULL, 0x3ccab1fce73a03e9ULL,
+            0x4c170c21157df0e4ULL, 0x6af865c844fe6695ULL,
+            0xe48f11f3f4aa0b43ULL, 0x1fa0b791cb79172dULL
+        },
+        {
+            0x1d225d94e695a558ULL, 0x85c4f13913fc34bbULL,
+            0xa41144931abc8dbfULL, 0x07a4480505393af2ULL,
+            0x3baa137f893e7be0ULL, 0x18bd03d165f1b174ULL,
+            0x33ecca40f39ecd3eULL, 0x7d70e8def2333ab1ULL
+        },
+        {
+            0x66ccb33fbfa0eac5ULL, 0x543ea003e6ca7f86ULL,
+            0x225c9c590f2b04d5ULL, 0xb2526b613292fd29ULL,
+            0x261a6f5e7492880aULL, 0xc6bce47fd46ac1a8ULL,
+            0xe4935c6cde2f5d17ULL, 0x163c4a08a3d66524ULL
+        },
+        {
+            0xc5ad4b0c7cfc6285ULL, 0xda80f5082bdae572ULL,
+            0x3c122fb14d0194c9ULL, 0x70d9df3c36b5d4e8ULL,
+            0x5fb418bd0bde8b44ULL, 0x1bc214a504380630ULL,
+            0x5e99f2dc0dbef8b5ULL, 0x05b9e8a0237fd9baULL
+        },
+        {
+            0x71b29acc4d20503dULL, 0x55e6ddec09b3d84bULL,
+            0x07a7b09992b16683ULL, 0x825323e8c20143daULL,
+            0x5f5fcced88d1fddcULL, 0x2330b64c7d7150cfULL,
+            0x1269a817101d30f6ULL, 0x754310bffb8815bbULL
+        },
+        {
+            0x1d12dfcf14c90971ULL, 0x5a597c5e95650be6ULL,
+            0xf084ac6e357b9a5aULL, 0x767f35ac92ea3358ULL,
+            0x77f2ab410aae69f4ULL, 0x4a48c74de6a1a692ULL,
+            0xcaddb06af059d39cULL, 0x6a669e4922af19fcULL
+        },
+        {
+            0x4f9b092b6c28fd9dULL, 0xc262351c0058e162ULL,
+            0x08f63d786e6a3221ULL, 0x89ffb6e9cd14d0b9ULL,
+            0xaedaeff796dafed2ULL, 0x59eeb29c28ff5bb6ULL,
+            0x26559b3b2b7ea688ULL, 0xd6417a5afe5a79d2ULL
+        },
+        {
+            0x71019021e0d7fa69ULL, 0x4652b8ebe0c7b5abULL,
+            0x3b982594d0e7a378ULL, 0x85e69fc9053c64d3ULL,
+            0xf302cddb3571503cULL, 0xeae46dca155fa704ULL,
+            0xfdb71a85933025a1ULL, 0xd63246457ff3c753ULL
+        },
+        {
+            0x022bb515a0b6d79aULL, 0x170e8de74919d99cULL,
+            0x5e73dad1929ebcb4ULL, 0xb8bd5b5186e90a83ULL,
+            0x1fc31e371c0c7762ULL, 0x88e9dbed5903e703ULL,
+            0x20a451a629758260ULL, 0x2daf046e3886a802ULL
+        },
+        {
+            0xcc9360d5bda9b617ULL, 0xa9f50dbe6e62917bULL,
+            0x23a40fac1716d189ULL, 0xd2b7dd1860226866ULL,
+            0xb70d00bb19445eb3ULL, 0x3991d16076e4f56dULL,
+            0x6e39f3f6729db628ULL, 0x00cfe9a2c5eae327ULL
+        },
+        {
+            0x5b7c95eacc4ba0f7ULL, 0xa58bef3afd57c1c1ULL,
+            0xb9b5af4ec9ef1383ULL, 0xc3c4898290effdd9ULL,
+            0xa4592968541454f1ULL, 0x07d4c2946adac9a6ULL,
+            0x275eff0bf2318a15ULL, 0x30f683c181d79201ULL
+        },
+        {
+            0x5f2efb5a58df3d9cULL, 0x9e3e7782c4e15587ULL,
+            0xdeb21a1772e3d2baULL, 0xc85eb568d1a4eaf8ULL,
+            0xa0d7e2a9c5feca74ULL, 0x9211ab4e919c9b84ULL,
+            0x36ef365e34513f4eULL, 0xf6cf8a7fede886b2ULL
+        }
+    },
+    {
+        {
+            0xc492ec644cd8f64cULL, 0x58a2d790279d7b51ULL,
+            0x0ced1fc51fc75256ULL, 0x3e658aed8f433017ULL,
+            0x0b61942e05da59ebULL, 0xba3d60a30ddc3722ULL,
+            0x7c311cd1742e7f87ULL, 0x6473ffeef6b01b6eULL
+        },
+        {
+            0x75d9bc15adf7cccfULL, 0x81a3e5d6dfa1e1b0ULL,
+            0x8c39e444249bc17eULL, 0xf37dccb28ea7fd43ULL,
+            0xda654873907fba12ULL, 0x35daa6da4a372904ULL,
+            0x0564cfc66283a6c5ULL, 0xd09fa4f64a9395bfULL
+        },
+        {
+            0xea770750df956c7bULL, 0x6420582b60bb490fULL,
+            0x94c8194ad01d041cULL, 0x03287d9d5f5bf72eULL,
+            0x36917885d8175292ULL, 0x22e07a2285ff2e77ULL,
+            0x20526905607f2289ULL, 0xdb7d7c88e8bf697bULL
+        },
+        {
+            0x63b99ce74462007dULL, 0xb8ab48a54cb5f5b7ULL,
+            0x9ec673d2f55edde7ULL, 0xd1567f748cfaefdaULL,
+            0x46381b6b0887bcecULL, 0x694497cee178f3c2ULL,
+            0x5e6525e31e6266cbULL, 0x5931de26697d6413ULL
+        },
+        {
+            0x3b6ae83b31f0b922ULL, 0xdc2cf2873cce5ea5ULL,
+            0x833d79530acb6d93ULL, 0x3427fd5720ee696aULL,
+            0xda1cb473c53f4e37ULL, 0x9ee3755e21cd1ecaULL,
+            0x6f68194559f7ea4eULL, 0x4d4eab3bb2c5a7afULL
+        },
+        {
+            0xc35681f538006409ULL, 0x6c6df4158de57c1aULL,
+            0x1be27e206450137fULL, 0x1a8434fa89f25dc0ULL,
+            0xb0e4522614d9a3c1ULL, 0x656a1d9ebbdc0ffbULL,
+            0xf85654f7eaca60feULL, 0xf8f3a3ac4543a5a8ULL
+        },
+        {
+            0x51ffdf1a86ab91fdULL, 0xeeacaa9e55e791fdULL,
+            0xbceec7b0465090fdULL, 0x90eba5c4bc39d3d0ULL,
+            0x151ffb474afb5b75ULL, 0x6e06c2b6b90a8a1aULL,
+            0x4cadbd7e4ce8b71fULL, 0x6b750519b02b37b1ULL
+        },
+        {
+            0x9f51439e558df019ULL, 0x230da4baac712b27ULL,
+            0x518919e355185a24ULL, 0x4dcefcdd84b78f50ULL,
+            0xa7d90fb2a47d4c5aULL, 0x55ac9abfb30e009eULL,
+            0xfd2fc35974eed273ULL, 0xb72d824cdbea8fafULL
+        },
+        {
+            0x1c206696cf5de6caULL, 0xa168ec94717436a2ULL,
+            0x68a97d56c3eb016bULL, 0xb22ac4e41615c1a7ULL,
+            0x2d824c8f52c3e4e9ULL, 0xf1aed163c2cc793fULL,
+            0xb0cb21ca1d5186e5ULL, 0xbcffda9056d8589cULL
+        },
+        {
+            0x884a020f0ce6f811ULL, 0xd98922a74baf8d03ULL,
+            0xbb4fd35dd492ca1bULL, 0x9f9e2ac148a8d301ULL,
+            0x34bcc58aa3ead551ULL, 0x5d2477c774e0118fULL,
+            0xd566c0fb3c78a2feULL, 0x53014be99c8855b2ULL
+        },
+        {
+            0x177470168986e2a0ULL, 0xd89ada069c6b7a4dULL,
+            0x0bd615aa483eafd4ULL, 0x1d3fa4d1f5d700ffULL,
+            0x1050eaf3ec267326ULL, 0x76c193f6f4d5998bULL,
+            0x268d498126dfcddeULL, 0x7534889d1cd7c3a8ULL
+        },
+        {
+            0x67b352701a482cfcULL, 0xfb5e6fe4d7c84385ULL,
+            0x40ce13fc62475da5ULL, 0xb4c363fd49052701ULL,
+            0x17aa70713f49ca78ULL, 0x6a45490cb52e307eULL,
+            0x7b8d760157cf999cULL, 0x081eb667dbcd8068ULL
+        },
+        {
+            0xc3bfd908878eec1cULL, 0xfff2c98e17fd7b98ULL,
+            0x6df3cffb37f108f5ULL, 0xb2c87404e57b09d0ULL,
+            0x374f18eff02abe17ULL, 0x677060b02346bc4eULL,
+            0x467d1f1816e6a981ULL, 0x1bfc284c021f8d56ULL
+        },
+        {
+            0xcb08854f5c665e6cULL, 0x1ccf3f984c12f890ULL,
+            0x74a8b4021cbf8d38ULL, 0x14db02971fb7d55aULL,
+            0x7d353d25b664b398ULL, 0x515b1a41666fdee8ULL,
+            0x52feb42afc9f287cULL, 0x9e8d07335e607790ULL
+        },
+        {
+            0xb2e235a69624a20fULL, 0xb183cd903efded30ULL,
+            0xc74f40c2afce57daULL, 0xc7adb87b1b66525fULL,
+            0x3ee3c33ab09f60eaULL, 0x176e9416cd98a5c1ULL,
+            0x716efb3574bfc718ULL, 0xf65691543c30a7e0ULL
+        },
+        {
+            0x2842589b319540c3ULL, 0x18490f59a283d6f8ULL,
+            0xa2731f84daae9fcbULL, 0x3db6d960c3683ba0ULL,
+            0xc85c63bb14611069ULL, 0xb19436af0788bf05ULL,
+            0x905459df347460d2ULL, 0x73f6e094e11a7db1ULL
+        },
+        {
+            0xe3e1986c2510ebd4ULL, 0x4cd9cd7584c598b1ULL,
+            0x4def2d14292f52efULL, 0x2bbee68c66d6af56ULL,
+            0xc5530529e46bfe0bULL, 0xc094df097fa33c22ULL,
+            0x1846e1a673a0c5eaULL, 0xf3b2d70f25c461a2ULL
+        },
+        {
+            0xc751f8fd745ac367ULL, 0x257391f8968f4494ULL,
+            0xd8d659f1477e58e7ULL, 0x7873f9b146ad204aULL,
+            0xb62b094ecec45236ULL, 0xfcaef7a82ad85155ULL,
+            0xb39429343b993bf2ULL, 0xc14dae5a64486cdbULL
+        },
+        {
+            0x641e6ab7a067d873ULL, 0x6df277814cf13482ULL,
+            0xa3fbdad378052d05ULL, 0x3f7f1aed8a1690daULL,
+            0xaf084d5fc5f17613ULL, 0xacf02b7f3662e8feULL,
+            0x4ee73688bea797ecULL, 0x02584ad96b03dad7ULL
+        },
+        {
+            0x61ad6fc8fb542e24ULL, 0xda60c7266613ef08ULL,
+            0x37c50029ad208c04ULL, 0x7d51e2fa1ddfc781ULL,
+            0xe048a1898e0ff925ULL, 0x928e996b0c6d2c5dULL,
+            0x15d0d6bdffb5a6b7ULL, 0xd6dfd7612f13649cULL
+        },
+        {
+            0xe74bcf734439fac0ULL, 0xee89d0d3b8315e8aULL,
+            0xd6893d2cff0708b7ULL, 0xf9c93c830866da5aULL,
+            0x218ee74466204739ULL, 0x0371db9597e82a36ULL,
+            0xe76510ab5cb3eacdULL, 0xf9e829138ad9af87ULL
+        },
+        {
+            0x44235d5d8a275038ULL, 0x664f134b962856ecULL,
+            0xec6d51a0afeb191fULL, 0x27c516576a58edb6ULL,
+            0xf4bd4e5d8eea725dULL, 0x86fa32afd6555609ULL,
+            0x6959330eb7920375ULL, 0x6deaee74ad4e2064ULL
+        },
+        {
+            0x8de908e14d5aac59ULL, 0x9e201173edfa85a9ULL,
+            0x1713058017ef7691ULL, 0xc59854187d6000ccULL,
+            0xc1b34201cd3303acULL, 0x3c5924e16b6bf75fULL,
+            0x5823dd677a1d0d29ULL, 0xf5211a1a14d67c44ULL
+        },
+        {
+            0xa469050b4c3533cfULL, 0x24f564cd08c02f53ULL,
+            0xbc24a8770c1f517aULL, 0x0d08a71f273931f0ULL,
+            0x6f2e30044c73f88eULL, 0xf191f1faa987c78dULL,
+            0xdd78353aeda506deULL, 0xcbdea332ee90d2b3ULL
+        },
+        {
+            0xf1ab1d781b89b8a0ULL, 0x762374fc22c50cd2ULL,
+            0x4c20540f1773018aULL, 0x45b77480db81ae56ULL,
+            0x3509dc05ddea34a9ULL, 0x0e8da2f2ed01174cULL,
+            0xbaa903d78c1b53baULL, 0x892a426b878b28f5ULL
+        },
+        {
+            0x928c0aede5139b84ULL, 0xec97bcc6698b74bdULL,
+            0x178129b536178efbULL, 0xf9e0c3eea959c634ULL,
+            0x0d63645632fd3b8dULL, 0x64ae237e87b75e95ULL,
+            0x15aa7394b1d6d362ULL, 0xa653415731e8605cULL
+        },
+        {
+            0x685b7fa29c2fe128ULL, 0x9e0ab66ee53198f8ULL,
+            0xef77411bf845b801ULL, 0xf4b20cb59a5b372bULL,
+            0x92beec047683d9e9ULL, 0x40b238329cdd3032ULL,
+            0xa5af113edb674e5fULL, 0xf458111d444a50a8ULL
+        },
+        {
+            0x35c1379c80315b61ULL, 0x35d6202edfb24f98ULL,
+            0x14414710ad16488bULL, 0x7a40600b9f947ce6ULL,
+            0x1ca83b60bf88a985ULL, 0x19de7c525518ed89ULL,
+            0x733ab48be80e260dULL, 0x610ffb1412f0b171ULL
+        },
+        {
+            0x9b20f556f2550a8aULL, 0x74979917df36103eULL,
+            0xb6df4572dd7db3f5ULL, 0x116cde70b49cd06cULL,
+            0xa11c46cd24f12d47ULL, 0xa9dc454edc79b331ULL,
+            0x05f95f1c098ea77fULL, 0x4934ca2a4cd32bc3ULL
+        },
+        {
+            0xec12328a5eff5a48ULL, 0x3f197f56b57a56d5ULL,
+            0x99250992911c922aULL, 0x5055f6c927f6e461ULL,
+            0x0590e6c4a4f2d3e9ULL, 0x66dc9f91a46a56eaULL,
+            0x9608b5b8dad94429ULL, 0xf82082e761124b29ULL
+        },
+        {
+            0x992652fcefd316caULL, 0x165e02137844926dULL,
+            0x60fef172bdd65fb5ULL, 0xe754effe1a433361ULL,
+            0x381f46dc82bd1607ULL, 0xffe5514093892da4ULL,
+            0x931dba3993a8d10eULL, 0x4f656e18ef65d70aULL
+        }
+    }
+};
+
+/* P384: p, -p^-1 mod 2^64, R^2 mod p, R mod p, b*R mod p and p - 2 */
+static const mp_digit ecp64_p384_p[6] = {
+        0x00000000ffffffffULL, 0xffffffff00000000ULL,
+        0xfffffffffffffffeULL, 0xffffffffffffffffULL,
+        0xffffffffffffffffULL, 0xffffffffffffffffULL
+};
+static const mp_digit ecp64_p384_rr[6] = {
+        0xfffffffe00000001ULL, 0x0000000200000000ULL,
+        0xfffffffe00000000ULL, 0x0000000200000000ULL,
+        0x0000000000000001ULL, 0x0000000000000000ULL
+};
+static const mp_digit ecp64_p384_one[6] = {
+        0xffffffff00000001ULL, 0x00000000ffffffffULL,
+        0x0000000000000001ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL
+};
+static const mp_digit ecp64_p384_b[6] = {
+        0x081188719d412dccULL, 0xf729add87a4c32ecULL,
+        0x77f2209b1920022eULL, 0xe3374bee94938ae2ULL,
+        0xb62b21f41f022094ULL, 0xcd08114b604fbff9ULL
+};
+static const mp_digit ecp64_p384_pm2[6] = {
+        0x00000000fffffffdULL, 0xffffffff00000000ULL,
+        0xfffffffffffffffeULL, 0xffffffffffffffffULL,
+        0xffffffffffffffffULL, 0xffffffffffffffffULL
+};
+#define ECP64_P384_N0 0x0000000100000001ULL
+#define ECP64_P384_COMB_SPACING 20
+
+/* P384 comb table: entry [s][j - 1] holds the affine point
+ * sum(bit b of j * 2^((5 * s + b) * 20) * G), coordinates in Montgomery form. */
+static const mp_digit ecp64_p384_comb[4][31][12] = {
+    {
+        {
+            0x3dd0756649c0b528ULL, 0x20e378e2a0d6ce38ULL,
+            0x879c3afc541b4d6eULL, 0x6454868459a30effULL,
+            0x812ff723614ede2bULL, 0x4d3aadc2299e1513ULL,
+            0x23043dad4b03a4feULL, 0xa1bfa8bf7bb4a9acULL,
+            0x8bade7562e83b050ULL, 0xc6c3521968f4ffd9ULL,
+            0xdd8002263969a840ULL, 0x2b78abc25a15c5e9ULL
+        },
+        {
+            0x31bdb48372876ae8ULL, 0xe3325d98961ed1bfULL,
+            0x18c042469b6fc64dULL, 0x0dcc15fa15786b8cULL,
+            0x81acdb068e63da4aULL, 0xd3a4b643dada70fbULL,
+            0x46361afedea424ebULL, 0xdc2d2cae89b92970ULL,
+            0xf389b61b615694e6ULL, 0x7036def1872951d2ULL,
+            0x40fd3bdad93badc7ULL, 0x45ab6321380a68d3ULL
+        },
+        {
+            0x47d23302d99917acULL, 0xefce627c33f7a04bULL,
+            0xb96cc6d8b8ef9f36ULL, 0x8571890525c35409ULL,
+            0x4a5f4f0fee91edb9ULL, 0xae758e2a60172b89ULL,
+            0x7efb78630b7e96aeULL, 0xfda98be3c0225b0eULL,
+            0x6f327742e17bbcf7ULL, 0xa4941bd6f2b9284eULL,
+            0x85b9c8ee55729e13ULL, 0xee1709b95ffa8268ULL
+        },
+        {
+            0xb083ba6aec074aeaULL, 0x46fac5ef7f0b505bULL,
+            0x95367a21fc82dc03ULL, 0x227be26a9d3679d8ULL,
+            0xc70f6d6c7e9724c0ULL, 0xcd68c757f9ebec0fULL,
+            0x29dde03e8ff321b2ULL, 0xf84ad7bb031939dcULL,
+            0xdaf590c90f602f4bULL, 0x17c5288849722bc4ULL,
+            0xa8df99f0089b22b6ULL, 0xc21bc5d4e59b9b90ULL
+        },
+        {
+            0x72ce5d93912e4266ULL, 0xb9e2fe47eb938baaULL,
+            0x43f949bd2b49a1c4ULL, 0xb9046d1c0d1675a0ULL,
+            0xe44cd59eb94f4d5bULL, 0x0e5a52c4ba5e8badULL,
+            0x548319de845268beULL, 0x4bafa151bd9f3484ULL,
+            0x3aa97c67834641b9ULL, 0xbc655a8d5409580aULL,
+            0x8671939d862bf901ULL, 0x7db1d5c598381c63ULL
+        },
+        {
+            0xa8e4214550bd7aeaULL, 0x397e9e4b455fd5cbULL,
+            0x13bbd702385e79ebULL, 0xbe1d94b95fd29a02ULL,
+            0x3ec587d9454dd50aULL, 0xeee28749074daebbULL,
+            0x8a01efcf6963fa4cULL, 0x675f207d5164fe01ULL,
+            0x48867863c747996aULL, 0xd432f46552bacad3ULL,
+            0x89a35209de03accfULL, 0x29cc150e54b11e28ULL
+        },
+        {
+            0xaab9862e034b6df1ULL, 0x38ca48efa15d3816ULL,
+            0xea98fa5bb583a6d0ULL, 0x6ff1f22cbb1c3a75ULL,
+            0x9f33b4e776745ddaULL, 0x2bd68678a105b1d6ULL,
+            0xc5ce108ac429046cULL, 0x80ebcc56bb5731eeULL,
+            0xf2b6118609d2e1dcULL, 0x088b89d269815ccaULL,
+            0x796faa99e3e24848ULL, 0x934f8ec3f9249d3fULL
+        },
+        {
+            0xac6dbdf6edc9ce62ULL, 0xa58f5b440f9c006eULL,
+            0x16694de3dc28e1b0ULL, 0x2d039cf2a6647711ULL,
+            0xa13bbe6fc5b08b4bULL, 0xe44da93010ebd8ceULL,
+            0xcd47208719649a16ULL, 0xe18f4e44683e5df1ULL,
+            0xb3f66303929bfa28ULL, 0x7c378e43818249bfULL,
+            0x76068c80847f7cd9ULL, 0xee3db6d1987eba16ULL
+        },
+        {
+            0x0be691dde461dc73ULL, 0x9f50d64b1ce3b6e5ULL,
+            0x99b6c99cd5b6e7b1ULL, 0x2376eaff787f667eULL,
+            0x64e9af31bc5962c4ULL, 0x7d79d59e6461b828ULL,
+            0x7ceb47a61ab7dcdaULL, 0x600d8fd347a8b18aULL,
+            0x2f2d9fb2ef8ff564ULL, 0xe127d3b143ed7068ULL,
+            0x593e374b491cacbeULL, 0x082c2c5267448046ULL
+        },
+        {
+            0xce25c98cc15c00d9ULL, 0x573d7653447fee04ULL,
+            0xb2eb085aa7f8d6a2ULL, 0xc097fe12fc3f4b25ULL,
+            0x7917512b1944c21eULL, 0x30defd62c5389707ULL,
+            0x5b813a0224525598ULL, 0xb96e53b375e791e6ULL,
+            0x01b81ffe1666da3aULL, 0xe15440e4fbfcaebfULL,
+            0x1a6ce71344876b1bULL, 0xd6721192aa8fcf5cULL
+        },
+        {
+            0x8efeef952e056d86ULL, 0x4ba875ccc70a4323ULL,
+            0x188be243261afabcULL, 0xd0712f75d9ae2284ULL,
+            0x5dd21e2e34acee30ULL, 0x8b83143fcdb4a0c8ULL,
+            0x2f0e9f58ad368b68ULL, 0x9818c33fb9eaa564ULL,
+            0x66aeff041710e6fdULL, 0x8dc4cfa7a24bdec2ULL,
+            0x7a6423edbc985a59ULL, 0xac014698542d84fbULL
+        },
+        {
+            0x2a286fcd1ffddc7eULL, 0x29bd5d17a971cd4bULL,
+            0x439a00e960d6a286ULL, 0x1b54096cd4173003ULL,
+            0x5fe645647cdd7f85ULL, 0x846f3f696b1e9e42ULL,
+            0xeac30b0aef6730bcULL, 0x91e6b5885bc2b61fULL,
+            0xc65ebd039a598dc6ULL, 0x947bd14981dda656ULL,
+            0x662d617e52c65a92ULL, 0x1a1c7cf012782b49ULL
+        },
+        {
+            0xb6c226a704ab18b9ULL, 0xe58f78ef9481d38dULL,
+            0x504bf4707651c54aULL, 0xaa34238f6f77091bULL,
+            0x79a12a660bf1babaULL, 0xe417df1baf47bd43ULL,
+            0xdee4a65490a9474fULL, 0x7fb1545b9b8d4118ULL,
+            0x7814ea736b21498dULL, 0xa17419a8b2958ec0ULL,
+            0x07f367bde885d60bULL, 0xfaf51c7e2a23fd2aULL
+        },
+        {
+            0x7ae81e38dc741a6fULL, 0x9ef5fd5c8c46236bULL,
+            0x02414c595383f4a9ULL, 0xf44e3134630586a5ULL,
+            0x4ee9d4fc09d3bea9ULL, 0x90e205280cfd83b0ULL,
+            0x51daf54e2b32ce27ULL, 0x892eda1c8370873bULL,
+            0x0bb94c34a007c33aULL, 0x8f8f2e4bf44f6d0cULL,
+            0x0e87f98f5faa77c3ULL, 0xe8d6159cde6ac012ULL
+        },
+        {
+            0x6ae8fa9b72c8ab70ULL, 0x8abd4ed95209081aULL,
+            0xe84f2ff26c9782d3ULL, 0x8d4a88351bc49ce2ULL,
+            0x5bba72a1445cc0e7ULL, 0xb154176064bcdbf2ULL,
+            0x787743ecccfb83ccULL, 0x0c3c6db7a3902252ULL,
+            0x8d4ee7cd9633af1eULL, 0x785bae77f89cc1e1ULL,
+            0xc541d9e485013d97ULL, 0x504c61d30d4d8eceULL
+        },
+        {
+            0x22313dee5852b59bULL, 0x6f56c8e8b6a0b37fULL,
+            0x43d6eeaea76ec380ULL, 0xa16551360275ad36ULL,
+            0xe5c1b65adf095bdaULL, 0xbd1ffa8d367c44b0ULL,
+            0xe2b419c26b48af2bULL, 0x57bbbd973da194c8ULL,
+            0xb5fbe51fa2baff05ULL, 0xa0594d706269b5d0ULL,
+            0x0b07b70523e8d667ULL, 0xae1976b563e016e7ULL
+        },
+        {
+            0x0df82167f07a572dULL, 0x31400e2273cf044bULL,
+            0x3e68fd798ef91221ULL, 0x4ffdd567b478f59eULL,
+            0xd4ed15613e5c59ddULL, 0x2159c3252996763eULL,
+            0x69897b7da5a8bc97ULL, 0x16714401c17ed62bULL,
+            0xea9c9813d721c585ULL, 0x851248892d0cfa62ULL,
+            0x4e502b8dedf90752ULL, 0x9068431c2ed8d972ULL
+        },
+        {
+            0xc9b38cc62532ed9dULL, 0xb081394db731fcdfULL,
+            0x195992359d9b632fULL, 0x650b89b1540b773fULL,
+            0x856e4867a301913fULL, 0xb98fd5ced035a90bULL,
+            0xb8c51981136720d7ULL, 0xa5b9fc69f23a4f89ULL,
+            0x2e99fae39e0f408aULL, 0x8fdefcc890db359dULL,
+            0x53818d26ca8bac6bULL, 0x135b60cf8942e00bULL
+        },
+        {
+            0xe5d4d199d070bfa7ULL, 0x45e916d2c543ffa0ULL,
+            0x653cafdee9d27c5bULL, 0xf59062e97d4d885dULL,
+            0xb6f7eb8bebf4085cULL, 0x08fe3e6af8acf249ULL,
+            0x1754385bf3432eabULL, 0x1f16f13b456bd5c1ULL,
+            0xdd0fa0c0df39b48bULL, 0xa57617a74d22b64fULL,
+            0x29a333eb25e57ff8ULL, 0x5a54b8c5c2e19266ULL
+        },
+        {
+            0xb0e1937416abe21eULL, 0x56a84b0ddbb7fee0ULL,
+            0x23523186e01ab268ULL, 0x967688ca4fd68a47ULL,
+            0xbe94edbd7f557d85ULL, 0x5fc8832054f177e9ULL,
+            0xbb0b1297124ad063ULL, 0x5747fab9016d2a29ULL,
+            0xb39240aa0c73a71cULL, 0x131e72b764953444ULL,
+            0xfad520cc2469c5deULL, 0x8cb2e7588406ab64ULL
+        },
+        {
+            0x5c5c6b8c13a8d7c0ULL, 0xf8ed7185a38b06e9ULL,
+            0xa3ef36fdca1b5047ULL, 0xbb41ff89678bbec0ULL,
+            0x44ea1a077758ef81ULL, 0x6111ffdad0d1e433ULL,
+            0xbe14fe3078b06958ULL, 0x034bd8c224e99b2aULL,
+            0x1bb698fc25e3999fULL, 0xc90c7d80ea745c8fULL,
+            0x1d44da582e75bc78ULL, 0xe0c043f4678de8afULL
+        },
+        {
+            0x4acc2a05fa56a797ULL, 0x9ee22386bc8d16b8ULL,
+            0x082644273459afe1ULL, 0xee137bdc490ef1b4ULL,
+            0xa533d1cda49df96cULL, 0x858b860017f084bfULL,
+            0x19d94a5cb8ce06d4ULL, 0x34d9746f02027fc3ULL,
+            0xbc897f727f61681eULL, 0xa364783f59956590ULL,
+            0x4fe977b800a805a7ULL, 0x797fe922ad1ecfe4ULL
+        },
+        {
+            0xa3df33164768f3c5ULL, 0x0c46ee911d48ebcaULL,
+            0x6a3d5ec3c2f03567ULL, 0x2d777d1147578e63ULL,
+            0x80cea6f086af15c9ULL, 0xa8f034e84e6a3140ULL,
+            0x56ca6070755600c5ULL, 0xf5a68a815a30ace9ULL,
+            0x65151adf96011bcbULL, 0x671b8f63f70a4f74ULL,
+            0x9e183a42e43bf55fULL, 0x7f884c05d2f64481ULL
+        },
+        {
+            0xe80ed8b5a33323a9ULL, 0xa2da833d2168af00ULL,
+            0x0726bf4d076320f9ULL, 0x6a217d288fad15b1ULL,
+            0x518e88a2dfbbfab8ULL, 0xe3c068fd7fc4c941ULL,
+            0x4ae243836f411680ULL, 0x966295a9fc192bacULL,
+            0x08ad3cf54944202eULL, 0x7af28af4005bd62fULL,
+            0xade4962f6c12c0a5ULL, 0x48f147d183201a85ULL
+        },
+        {
+            0x8a942ba9ceff4cb1ULL, 0x28cfa87c9c779a4eULL,
+            0xc65a8784519d0824ULL, 0xd1c679f7d828332bULL,
+            0xabc271edffaf2a55ULL, 0x9d6683a82a065804ULL,
+            0xe5d6ff4388f657e3ULL, 0x0fefeb8ef3503f68ULL,
+            0x814092a85040964fULL, 0x66e94ba71ab075e1ULL,
+            0xd1be12303b24df41ULL, 0x790bed4207f14bcfULL
+        },
+        {
+            0xe415e811a9a8a217ULL, 0x64ad6a831a60c599ULL,
+            0x65db85cdcbb73972ULL, 0x0cf822b412d69ccaULL,
+            0xeec7bd2f3eaea364ULL, 0x629cf6a0e6cf960fULL,
+            0x56412dcb16b9ce73ULL, 0x483fb917738207bcULL,
+            0x8cbb4cf59be659a8ULL, 0x5013c8354280afd5ULL,
+            0xa41636a1cc194353ULL, 0x1d81ee74dc2905eeULL
+        },
+        {
+            0xe2c295fca0e9db0eULL, 0x4c70ee796bcbc838ULL,
+            0x21c778bbde0aaf19ULL, 0x8f1b88ae0df81248ULL,
+            0x75b3bd3872e0b22bULL, 0x3739c270032741dcULL,
+            0x600f87089010a6dcULL, 0xb0cad3adfe03c066ULL,
+            0x661b7a2e91ce2762ULL, 0xdd3fddd658f796c6ULL,
+            0x9f5e9a0f0c26535fULL, 0xf37d5bf5100942b6ULL
+        },
+        {
+            0xf0d8f6a613609027ULL, 0xc2db0c03704544fbULL,
+            0x701dcf5b72439c6cULL, 0x3c3ce00e99a189c3ULL,
+            0x5c42ac87d32164f4ULL, 0x1bd18cf22b31aa07ULL,
+            0x3c94619c8cd609e5ULL, 0xb2e4d537a759b3afULL,
+            0x254e134733398885ULL, 0xb0ef13cb0bcdf619ULL,
+            0x7561c518cd768726ULL, 0x1c7c4331ab8ec7e2ULL
+        },
+        {
+            0xd530ac7eb89b40afULL, 0xe1bc821402b64feaULL,
+            0x98287562aedf18c0ULL, 0xb2d43762c55e5e27ULL,
+            0x4e00af905c366b0aULL, 0xb93c6541fb359f38ULL,
+            0x07f1ab163149989fULL, 0x41b72cbde601b67aULL,
+            0xd5ea555870496cd7ULL, 0xf9f2a6554e335acfULL,
+            0x5a47d3de2e545b53ULL, 0xe9b31cef95357e7eULL
+        },
+        {
+            0x18e90783156a0db3ULL, 0x8933255c2988c6ddULL,
+            0xfde822fb653ae2bbULL, 0xab6d0d9a27b95a89ULL,
+            0xf8b2c8239022d191ULL, 0x10c11f64c571fc1aULL,
+            0xf92ad20e81b4ec46ULL, 0x2614be8a5f512ea1ULL,
+            0xf0d97f4c93398404ULL, 0x4a06721f75cc0f63ULL,
+            0xc3757b728e0acae9ULL, 0x1f908d2a56854667ULL
+        },
+        {
+            0xe68331d212eefecfULL, 0x8f71c232584ca5e3ULL,
+            0x9c06f2c3ddd94131ULL, 0x2dd6b16b2370b1beULL,
+            0xde37ccb1c7464c80ULL, 0x81bcb89c87fae154ULL,
+            0x645cf447362c4575ULL, 0x8826e5d43ff83dd3ULL,
+            0x07108d28533dc63eULL, 0x5f115d6d6af58e2aULL,
+            0x6c4ba09f1d739106ULL, 0xe50309f54f24025aULL
+        }
+    },
+    {
+        {
+            0xa05c751cd1d1b007ULL, 0x016c213b0213e478ULL,
+            0x9c56e26cf4c98feeULL, 0x6084f8b9e7b3a7c7ULL,
+            0xa0b042f6decc1646ULL, 0x4a6f3c1afbf3a0bcULL,
+            0x94524c2c51c9f909ULL, 0xf3b3ad403a6d3748ULL,
+            0x18792d6e7ce1f9f5ULL, 0x8ebc2fd7fc0c34faULL,
+            0x032a9f41780a1693ULL, 0x34f9801e56a60019ULL
+        },
+        {
+            0x2af8ed8170d4d7bcULL, 0xabc3e15fb632435cULL,
+            0x4c0e726f78219356ULL, 0x8c1962a1b87254c4ULL,
+            0x30796a71c9e7691aULL, 0xd453ef19a75a12eeULL,
+            0x535f42c213ae4964ULL, 0x86831c3c0da9586aULL,
+            0xb7f1ef35e39a7a58ULL, 0xa2789ae2d459b91aULL,
+            0xeadbca7f02fd429dULL, 0x94f215d465290f57ULL
+        },
+        {
+            0xdb3df8c712fd0302ULL, 0x19c06d7b99eb32d0ULL,
+            0x4a30f40d5a5b819aULL, 0x27e4a448fd17a6b9ULL,
+            0x3a77dd8696c42f90ULL, 0x7067884650878b00ULL,
+            0xca6341bfc6fddf2dULL, 0xbcff3232ba160573ULL,
+            0x4e77bba57768120eULL, 0x6de2620c445f693bULL,
+            0x7cc2b13469c56b1aULL, 0xefe3770d2784ff2dULL
+        },
+        {
+            0xbbccce39a368eff6ULL, 0xd8caabdf8ceb5c43ULL,
+            0x9eae35a5d2252fdaULL, 0xa8f4f20954e7dd49ULL,
+            0xa56d72a6295100fdULL, 0x20fc1fe856767727ULL,
+            0xbf60b2480bbaa5abULL, 0xa4f3ce5a313911f2ULL,
+            0xc2a67ad4b93dab9cULL, 0x18cd0ed022d71f39ULL,
+            0x04380c425f304db2ULL, 0x26420cbb6729c821ULL
+        },
+        {
+            0x18de20cf6c8aeacbULL, 0x987eb7fa68f84a36ULL,
+            0xde05448a2014cd86ULL, 0x9bd2c01cfaae90deULL,
+            0x1aeb6ba409b2a4faULL, 0x631bfc1ab539ee83ULL,
+            0x5af9931f361dbeadULL, 0xeb60bf8a6d6b1ae8ULL,
+            0x5ee9763e6d201b78ULL, 0x8d1728d48070f7f3ULL,
+            0x8200417a997326a6ULL, 0xad1d72a6078db810ULL
+        },
+        {
+            0xa8c79e36d97e39eaULL, 0x43af43577aeabc7eULL,
+            0x5961699968f0218cULL, 0x477fe2ac33f1dbf9ULL,
+            0xd840cf71ab4c57baULL, 0x0560af5323c6c85cULL,
+            0x1946fa55941e5c90ULL, 0xa4b337fee541a8b9ULL,
+            0xd9dcd6aca870e6c1ULL, 0xbda7334d868a8ed9ULL,
+            0xee79c18b8f773835ULL, 0xcbb928c245435544ULL
+        },
+        {
+            0x6c6806ffcea1445fULL, 0xcdeea7bceb7209aaULL,
+            0x60943b3ebf0f0a6eULL, 0x7a371a098ebbc250ULL,
+            0x7f4f757db8657ff7ULL, 0x6cab095399cce744ULL,
+            0xc053b24d3da44592ULL, 0xd64775bd257d227eULL,
+            0x0e98f477027aba90ULL, 0xe9ee28b05ad12950ULL,
+            0x024cf499e09b2a63ULL, 0xb4d2adc898a7296cULL
+        },
+        {
+            0x11a8fde5f0ce2df4ULL, 0xbc70ca3efa8d26dfULL,
+            0x6818c275c74dfe82ULL, 0x2b0294ac38373a50ULL,
+            0x584c4061e8e5f88fULL, 0x1c05c1ca7342383aULL,
+            0x263895b3911430ecULL, 0xef9b0032a5171453ULL,
+            0x144359da84da7f0cULL, 0x76e3095a924a09f2ULL,
+            0x612986e3d69ad835ULL, 0x70e03ada392122afULL
+        },
+        {
+            0xeb599eb19e2b2fd9ULL, 0x58bffc1f308ab459ULL,
+            0x5e95d8f3a9775713ULL, 0x5cc182f89ef3f87fULL,
+            0x468014c677673987ULL, 0x6a13dc23813f04e4ULL,
+            0xc847c4e2fc21f2b2ULL, 0x954ab705d1504b3bULL,
+            0xa8b327304daf1e4dULL, 0x78ac4b0bd526dff1ULL,
+            0xed23f1b7c49a1257ULL, 0xba4d67622430b687ULL
+        },
+        {
+            0xc51acfcc2d104237ULL, 0xe11b2fc5e696d88fULL,
+            0x4b6694c46a11c88fULL, 0xbbd76cafc92cd8c3ULL,
+            0xc2975447334c7bf2ULL, 0xb84587f2f7d1862bULL,
+            0xe41844b6aa32c54eULL, 0x89c50d4c67c33955ULL,
+            0x5a5f04b77099e6b8ULL, 0x770733bd2f4a1a90ULL,
+            0xbdac09a97977b91dULL, 0x46ecb3a7fa0509efULL
+        },
+        {
+            0x8eec80925af7fba5ULL, 0x52df76e5dc2d0bf7ULL,
+            0x429db33eeefe88c4ULL, 0x295dc1e7a89dc198ULL,
+            0x605dab87541b35b2ULL, 0x25d9ea876e3fce50ULL,
+            0x29141e5516ab030aULL, 0x6b02115054640b9aULL,
+            0xfb102e4e597b7389ULL, 0x4f4bd9f30240cf03ULL,
+            0xf1bc7a141c42535dULL, 0x53148b857e52f380ULL
+        },
+        {
+            0x777229255a46a228ULL, 0x7777e10914c5adabULL,
+            0x49839f999db43057ULL, 0xffd5166dbe719cfaULL,
+            0x76d94ce8d919958aULL, 0x672cd2473d628b0cULL,
+            0x1512f6c263ff2e7bULL, 0x2e425d49268979fbULL,
+            0x07385c5ecbc24e20ULL, 0xa648dda041fa106fULL,
+            0xc1025e8f7c661baaULL, 0xd8f9b3e5d6fe4512ULL
+        },
+        {
+            0x62b8340b7ed47406ULL, 0x1376b10ae65388fbULL,
+            0x1e492f07a40237b6ULL, 0xf7d12ccc9a157b60ULL,
+            0x2b9d8cbc8e279c2eULL, 0x8a34421ba7e67993ULL,
+            0x72d1318b41c374a9ULL, 0xe87f6875db45ed7bULL,
+            0x7e3fb46a52017c62ULL, 0x0e005d9c7f92d569ULL,
+            0x61ea79187dae3328ULL, 0xa2ae27213a8f032eULL
+        },
+        {
+            0xfa8e10d7001a1ea9ULL, 0xdcd068b870956f9aULL,
+            0x387489c23ce3d083ULL, 0x55fc7dbaa6e00226ULL,
+            0xcc3fef950979b80cULL, 0x847830083fd4f8d9ULL,
+            0xaa4241963457f509ULL, 0x26a76bc2f104e4b5ULL,
+            0xfee81ed49d651f44ULL, 0xa4ed72c7f9a9bf5eULL,
+            0x432cf554e2e0dd18ULL, 0x63e5314aaa8ec6ffULL
+        },
+        {
+            0x80c1f675253575baULL, 0x228049809e61e640ULL,
+            0xcf20d103f82febb4ULL, 0xf149ade3a588e75aULL,
+            0x84aac62d6cb08ae4ULL, 0x40393bc088fbc116ULL,
+            0xd40d9a2d81a0f4c6ULL, 0xf5d380a923f4c0a7ULL,
+            0x84758fb0efb7212cULL, 0x793e46ecfdec1f38ULL,
+            0xb7734c12d3206851ULL, 0x01f66e336e0ede1fULL
+        },
+        {
+            0xfa2db51a8d688e31ULL, 0x225b696ca09c88d4ULL,
+            0x9f88af1d6059171fULL, 0x1c5fea5e782a0993ULL,
+            0xe0fb15884ec710d3ULL, 0xfaf372e5d32ce365ULL,
+            0xd9f896ab26506f45ULL, 0x8d3503388373c724ULL,
+            0x1b76992dca6e7342ULL, 0x76338fca6fd0c08bULL,
+            0xc3ea4c65a00f5c23ULL, 0xdfab29b3b316b35bULL
+        },
+        {
+            0x8c7abbf97bfe8f0cULL, 0x8137c78bf01290f5ULL,
+            0x07efa408bd4235ebULL, 0x6cdbca8546fac1cfULL,
+            0xce82bb668124f31cULL, 0x0e6c12e6cdc55820ULL,
+            0xf383030d1e13497dULL, 0xe0f16db36a2cdd04ULL,
+            0x9df51171836adec3ULL, 0x6c693b725d5d5c44ULL,
+            0xcaffefc3220fd191ULL, 0xaf5af6ace5f10a10ULL
+        },
+        {
+            0x60d9b43b95ed27c1ULL, 0xb9949b04ca3db08aULL,
+            0xad7d69f7ab68d887ULL, 0x43bb7b8cffbb8292ULL,
+            0xbf2d3d789e14b03eULL, 0x3b1b1d6b95c210ccULL,
+            0xef595846dd6e907eULL, 0xb2c4a6a8da46625eULL,
+            0xb66787ef93217c6fULL, 0xc489fcd21c9b34abULL,
+            0x5f5df93a68937945ULL, 0xdcb05d7d1ee8b08aULL
+        },
+        {
+            0xe23bdb26804708b8ULL, 0x00803ae39c43ec8cULL,
+            0xc5e7fdd7fa9a5044ULL, 0x351a328b8188822dULL,
+            0x9bdf53b63bc96a96ULL, 0x87f75b8dc238f9a1ULL,
+            0xb04b942090f8fa2eULL, 0xdef76e7100a681e3ULL,
+            0xf13fffff0ac44df1ULL, 0x5f3aab59f0fa3242ULL,
+            0x937e86027243a691ULL, 0x324ab4be0c3b5096ULL
+        },
+        {
+            0x0795ba8e287af8c5ULL, 0x3ed176d96e29071cULL,
+            0xa66745754032d5ffULL, 0x05df4fb07b7d0b61ULL,
+            0x832f7ad0a84abfa7ULL, 0x6340e5b4590c3cc4ULL,
+            0xff60a5bc12f3d25fULL, 0xa62d53dd3c499d93ULL,
+            0x9cc1e923a81aa8a0ULL, 0xb0b233c65b077c27ULL,
+            0x4e29f6bda3d81fbeULL, 0x61dc1c795116ad41ULL
+        },
+        {
+            0x10e02b8be8a70bbbULL, 0x631ec2cf154232bcULL,
+            0xe90363bec4dad21dULL, 0x2bb4d94a424574a5ULL,
+            0xbf5e3bcf143e2c2eULL, 0x96484d42fa067cf0ULL,
+            0x344852d1cf58f88eULL, 0x89c5c60bdae86b47ULL,
+            0x6da022c56b5a156fULL, 0xca28247e7e39abaaULL,
+            0xb7bbfd705451526dULL, 0x631e08a94361121eULL
+        },
+        {
+            0xe573696938196860ULL, 0xd08502897ae55fb5ULL,
+            0x50f6f8b1778bce66ULL, 0x50514470f482aad5ULL,
+            0x204865e4a54f327aULL, 0xf0d3fbfa37b2dd9bULL,
+            0x62cc750786a86540ULL, 0x48574fe90685ac9fULL,
+            0xc4932e696ed306f1ULL, 0x118bcb3e77a3d1a4ULL,
+            0xa660de99e72c528dULL, 0xe529723c4f598fcbULL
+        },
+        {
+            0xea66ab7503ce2e29ULL, 0x2e2e811952bc0048ULL,
+            0x88570a3c57224f9cULL, 0xd3df2adfea42ce66ULL,
+            0x9c308807fc217733ULL, 0x26e81c520b51f094ULL,
+            0x516ceb709d2563f6ULL, 0x1c83bc7475814accULL,
+            0xb7ec99dc881a26b4ULL, 0xbd0931e1f734ad46ULL,
+            0x3c18b1503d9b9a4cULL, 0xec8df34b900bf9c2ULL
+        },
+        {
+            0x51ee4630641810caULL, 0x6ce3cbfe1e8ef7a7ULL,
+            0xba24ebb320723c50ULL, 0x072f23908709c239ULL,
+            0x6f06d2d6a544d1ddULL, 0xfd8dbc75b2d30780ULL,
+            0xe21b5a864f7a63d8ULL, 0x03ede1e8e627db9cULL,
+            0xa66bb3e2ebc83733ULL, 0x3280634a9c0cadbfULL,
+            0x4398666a3aae9d35ULL, 0xa70513216bc47576ULL
+        },
+        {
+            0x8131bdc67f146b44ULL, 0xa2063d3be9664bd7ULL,
+            0x9e11212c07d03017ULL, 0x8bee58f75ead4b7eULL,
+            0x6c029fc899457ce6ULL, 0xa0311b1da5787d62ULL,
+            0x9eb2d7e323d8bc10ULL, 0x9b64e9117c8054b6ULL,
+            0x4e4a8d866cfd9cefULL, 0x3945c8bddc30f069ULL,
+            0xf811c71d33f9b5e7ULL, 0xcb12dd9b1ef8dedaULL
+        },
+        {
+            0x8b85bdefc0388589ULL, 0x30be3cf375baeea9ULL,
+            0x600758afbf51df24ULL, 0xc72824d0b4219591ULL,
+            0xa2f0a161763f1e7dULL, 0xc361928816fcdc3dULL,
+            0xedf39f8e54d5a1efULL, 0x49b8e46e0d5e28e2ULL,
+            0x11d06bc9996bbaffULL, 0xc7153b1f5829da61ULL,
+            0xd3af46862c425ea7ULL, 0x2d5627fef0522508ULL
+        },
+        {
+            0x874d1df2fca16178ULL, 0x5d765fc9c9f03261ULL,
+            0x860af3b2a6136729ULL, 0x84b705496e9e2ff5ULL,
+            0x27f2d326331e0723ULL, 0x51d49b17542b61d0ULL,
+            0xb5f462552c62a422ULL, 0xbd28625ec0ff0a4dULL,
+            0xa8a75e62df5eb2c6ULL, 0x0a46fa30b6fe0bf8ULL,
+            0xf1e5f7ba2edda4fbULL, 0x017b5a91e4f34742ULL
+        },
+        {
+            0xe0b811264307ea90ULL, 0xcac8af40d2c2b042ULL,
+            0x8ed2756329b52b86ULL, 0xedd02114c89326d1ULL,
+            0x91e3d48be8c6e85aULL, 0xec23c011989aa892ULL,
+            0x8fd3b7249a2a7883ULL, 0xffee367ca0cc8768ULL,
+            0x5ab31435266935ddULL, 0x3666952d8d6a3dbbULL,
+            0x7f55fd4a595d7b47ULL, 0x1ca8e8c484418b96ULL
+        },
+        {
+            0x4833e9d8057d31d2ULL, 0xad89b4e1c69ff827ULL,
+            0xdf14c3253ba66224ULL, 0x1305f6b6e5fe09e4ULL,
+            0x0191f33a73706fb7ULL, 0x3f605fb1477ed56fULL,
+            0x34ea13c704e13a76ULL, 0x2e9c361d87f4e8c0ULL,
+            0x8e1d0ee28e2a9973ULL, 0x87ed436cfc87c506ULL,
+            0x2c0e7585d6f9bc4cULL, 0x32fa114fdc43f879ULL
+        },
+        {
+            0x6799cce8f3bde97fULL, 0x14a918ee393e4c26ULL,
+            0x85fc5c5f641c384bULL, 0x1151a039df78465eULL,
+            0xe0b27397e843bf2eULL, 0x72ca732e1518f660ULL,
+            0x3279a5ea9db840cdULL, 0x0aabbb7cc1b2e101ULL,
+            0x211740ed063cd745ULL, 0x18d5a37f64aa1aa5ULL,
+            0x026383d79251c734ULL, 0xc7b6d723652c067fULL
+        },
+        {
+            0xb7f6033d9ede2d4cULL, 0x989bcebb685387faULL,
+            0x2963d1e292f66749ULL, 0x161d09b3a86472ecULL,
+            0xf954163a2031b9bdULL, 0x3b117e9e6dd2277cULL,
+            0x13662c45cd1836adULL, 0xa9c09d2ba607ac2dULL,
+            0x29e6092b73800805ULL, 0xb2577fcefec93ca9ULL,
+            0xdefc4fe9228b48d3ULL, 0x5d7a722d53588a92ULL
+        }
+    },
+    {
+        {
+            0x5b0b5d692a7aecedULL, 0x4c03450c01dc545fULL,
+            0x72ad0a4a404a3458ULL, 0x1de8e2559f467b60ULL,
+            0xa4b3570590634809ULL, 0x76f30205706f0178ULL,
+            0x588d21ab4454f0e5ULL, 0xd22df54964134928ULL,
+            0xf4e7e73d241bcd90ULL, 0xb8d8a1d22facc7ccULL,
+            0x483c35a71d25d2a0ULL, 0x7f8d25451ef9f608ULL
+        },
+        {
+            0x3f2eff53de1e4e55ULL, 0x6b749943e4d3ecc4ULL,
+            0xaf10b18a0dde190dULL, 0xf491b98da26b0409ULL,
+            0x66080782a2b1d944ULL, 0x59277dc697e8c541ULL,
+            0xfdbfc5f6006f18aaULL, 0x435d165bfadd8be1ULL,
+            0x8e5d263857645ef4ULL, 0x31bcfda6a0258363ULL,
+            0xf5330ab8d35d2503ULL, 0xb71369f0c7cab285ULL
+        },
+        {
+            0xb469ebf279e62713ULL, 0x029fc34c3e683c3aULL,
+            0x1697f668521373c4ULL, 0x411a75fa9c9cd7acULL,
+            0xaa555e41a03b3662ULL, 0xd3ea580f82bbe1ceULL,
+            0x6251dbda8ef86effULL, 0xe0945ecb7f53f62cULL,
+            0xc4e26c95f96d2e24ULL, 0x69ac60ad4fcb9d04ULL,
+            0x14d4db436e8b5833ULL, 0x9cbe6be6ffdb93f9ULL
+        },
+        {
+            0xc0426b775e3c647bULL, 0xbfcbd9398cf05348ULL,
+            0x31d312e3172c0d3dULL, 0x5f49fde6ee754737ULL,
+            0x895530f06da7ee61ULL, 0xcf281b0ae8b3a5fbULL,
+            0xfd14973541b8a543ULL, 0x41a625a73080dd30ULL,
+            0xe2baae07653908cfULL, 0xc3d01436ba02a278ULL,
+            0xa0d0222e7b21b8f8ULL, 0xfdc270e9d7ec1297ULL
+        },
+        {
+            0xc676ee54a0065409ULL, 0x4b2e1eeb55886617ULL,
+            0x94b4864044d50f22ULL, 0xa4368435018ae966ULL,
+            0x9e940fb30aa6370dULL, 0x9abfedf58b296430ULL,
+            0x4edaa387e660e8acULL, 0x81f9a60e3b6fd2c4ULL,
+            0x3efa5dc5494f04f8ULL, 0xb5cdf81c26586ce7ULL,
+            0xc9fcd9fe46f2a6e2ULL, 0x5bdb68577172c1b8ULL
+        },
+        {
+            0x7cd656b796d4707cULL, 0xf6dd0ec20b77cb3eULL,
+            0xe8659698e27226d7ULL, 0x0ae0501ab1a49363ULL,
+            0xf319b391ad08cde5ULL, 0xfcf11bacae446fa4ULL,
+            0x98efc78cae874fb2ULL, 0xf12b9796d34261bcULL,
+            0x40edb88893d91e26ULL, 0x9c0138aedd92fbe1ULL,
+            0x347ad756774b012cULL, 0x0582057d5502443aULL
+        },
+        {
+            0x069def57b7c7624bULL, 0x2b7a6976038aec83ULL,
+            0x430128f21ccd827fULL, 0x2c73a3e233736fc0ULL,
+            0xb9d16646181bb63cULL, 0x9df3af92636341caULL,
+            0xf57eb78e40196135ULL, 0x8815008d2e0924fdULL,
+            0xe116a4edc524f5c0ULL, 0xc8cea68848b84b41ULL,
+            0x26f802298e7169f7ULL, 0x45e1a7c1771cfd00ULL
+        },
+        {
+            0x140a0f9fdd93d50aULL, 0x4799ffde83b7abacULL,
+            0x78ff7c2304a1f742ULL, 0xc0568f51195ba34eULL,
+            0xe97183603b7f78b4ULL, 0x9cfd1ff1f9efaa53ULL,
+            0xe924d2c5bb06022eULL, 0x9987fa86faa2af6dULL,
+            0x4b12e73f6ee37e0fULL, 0x1836fdfa5e5a1ddeULL,
+            0x7f1b92259dcd6416ULL, 0xcb2c1b4d677544d8ULL
+        },
+        {
+            0x1362399c8302884cULL, 0xbf325bb427823662ULL,
+            0x7dd1f60a2d06faceULL, 0x2061f66336266cbbULL,
+            0x7f0d1c43bbc089aeULL, 0x6554004c91ad2d7fULL,
+            0xb73aa18823717cdfULL, 0x0cd82f2725273012ULL,
+            0x3c8a49c9db57c3b8ULL, 0xa08b6e2884c1efc1ULL,
+            0x66232dae5980d43eULL, 0xf14045c897e2a9beULL
+        },
+        {
+            0x1bc74216221baa34ULL, 0xb6fd0dc0626b407dULL,
+            0x622713cf5c69d587ULL, 0x9ec77f295e015255ULL,
+            0x844c4aeb3dd2c825ULL, 0xf2a3dbd436684de2ULL,
+            0x93eefabd5ed0218eULL, 0xec9377f6232d825dULL,
+            0xf26c06893447f88dULL, 0x9f7bd25867b18d37ULL,
+            0x00b83e5c34214173ULL, 0x553c53300ac4ec94ULL
+        },
+        {
+            0xff362726c81a07bdULL, 0x802cf089cdbcd692ULL,
+            0x123d7f4f2c2bdaf5ULL, 0xa752a8b3a108d00fULL,
+            0x64f86914e63e98aeULL, 0xb2300de95963ebb7ULL,
+            0x014e6ec87ea27a2dULL, 0xc94f1d5af1fba183ULL,
+            0x4fe5fd5495ef5824ULL, 0x901dee0cb1cee1f9ULL,
+            0x2ee5e93b0a1e5913ULL, 0x079559f22fbefc09ULL
+        },
+        {
+            0x10a68a960b272184ULL, 0x7b2efaa7d6d611eaULL,
+            0x08f05473f2e7c70dULL, 0x75ec37d73e507f73ULL,
+            0xc6a1ba436c7963cfULL, 0x14c43616353c300aULL,
+            0x7050bb96724ca9cfULL, 0x107a76c035499033ULL,
+            0xbf70d3dcba6a5aa5ULL, 0xf2430018d1fb8aa3ULL,
+            0x52976b04e1bc0d09ULL, 0xdf312e1c1f549f57ULL
+        },
+        {
+            0x067af333b2148194ULL, 0x51d6aac9492138aaULL,
+            0x4b3729c1be70bf60ULL, 0xae4e902dc5ddc4cdULL,
+            0xab68696558e56c90ULL, 0xfaf70ddc0f49342aULL,
+            0xd5b6febf9605b0deULL, 0xcd6e8e8cb9b19fe9ULL,
+            0xcb4c6636aff5bf32ULL, 0x5df15bff875b9b70ULL,
+            0x4ca73ef4b82a0afcULL, 0x9611e193584dc3c8ULL
+        },
+        {
+            0x16061819ba48f3b9ULL, 0xf3b96f151a881492ULL,
+            0x31e16ee792338eeaULL, 0xb69e2a178767ae96ULL,
+            0x00abc8ba94c3b6a2ULL, 0xe7371a05dcda48f9ULL,
+            0x027ee4a409aa7b33ULL, 0xc126e1d1bfc3ea66ULL,
+            0x681cfa0655b3b2d2ULL, 0xa2c3b62c3eb5bbaeULL,
+            0x0f6d2928fd396912ULL, 0x050e3988b9230398ULL
+        },
+        {
+            0x4cbaf3ceb4943d11ULL, 0x1c557cc004a0ea7fULL,
+            0xbe29584f77f4ef73ULL, 0xac4553e9687e55b6ULL,
+            0x31144cbd768938afULL, 0x8c2035ba5e7a1064ULL,
+            0x6ae0cd76257006abULL, 0x7a750b6269d58855ULL,
+            0xd7a3664f11bf4285ULL, 0x9cad6f10dc0ae7c0ULL,
+            0x4ac1181b93f35d07ULL, 0xb19e4e080691216fULL
+        },
+        {
+            0x9e9af3151c4c9d90ULL, 0x8665c5a9d12e0a89ULL,
+            0x204abd9258286493ULL, 0x79959889b2e09205ULL,
+            0x0c727a3dfe56b101ULL, 0xf366244c8b657f26ULL,
+            0xde35d954cca65be2ULL, 0x52ee1230b0fd41ceULL,
+            0xfa03261f36019feeULL, 0xafda42d966511d8fULL,
+            0xf63211dd821148b9ULL, 0x7b56af7e6f13a3e1ULL
+        },
+        {
+            0xfdd2596fb878cfb7ULL, 0x3a28765b73dc9b36ULL,
+            0x5ce85b639e3a3d11ULL, 0xb2c149bde9e2ab27ULL,
+            0x6056ca61ea337e49ULL, 0xbc1d46f11e614c12ULL,
+            0xdc1ebfb6ed96d94bULL, 0x4fa5fcbe506077e5ULL,
+            0x414ceaf88cf4e5ecULL, 0x1644f605ffe85d7dULL,
+            0xa17a2fd9a4c61a6aULL, 0x2d70e3f535cbb62aULL
+        },
+        {
+            0x19970ef7f56790aaULL, 0xc41c6def41afdfedULL,
+            0xd532763febd44b12ULL, 0x86cd36c50997a2e5ULL,
+            0xd0af7c8fd969d040ULL, 0xa53360856f7fccedULL,
+            0x980f3313d650fc68ULL, 0xda0e402fa09fcd9fULL,
+            0xb1ed3a684be9e45aULL, 0x9e9d3adbf4f75491ULL,
+            0x87d5ff1bb55f0282ULL, 0xcdcb5a87fec3f119ULL
+        },
+        {
+            0x2f1b74498cd21adeULL, 0xd099389d47576b34ULL,
+            0x13a611d4d9b69f40ULL, 0x5825209e852a38a9ULL,
+            0x02aa0b2ab62c3b24ULL, 0xda2d6579b31ffdb5ULL,
+            0x3e3cfe0b265cb1a2ULL, 0xf495f01dff271f1aULL,
+            0xc58d7fcf32966fb9ULL, 0xe8ea7786e5261eb5ULL,
+            0x505fb045a8e76529ULL, 0x9114d13f4786e79dULL
+        },
+        {
+            0xf97b33cf9ae826b9ULL, 0xd038319ff654654dULL,
+            0x68e45698bbc5ba16ULL, 0x4a45877aa36c24aaULL,
+            0x47043295b594ec74ULL, 0xaba938d449b17378ULL,
+            0x4f38319410728596ULL, 0x7f1a842e9f0f6fe2ULL,
+            0x222d097614821ec1ULL, 0x45b23936451c46dcULL,
+            0xf4d275d4eaa8097eULL, 0xbbebea25f9a95f08ULL
+        },
+        {
+            0xf2fa9baf84ed6a93ULL, 0x9a11f1895f7f1f04ULL,
+            0x2c27f0a03de9c340ULL, 0xd87b328e11e9149eULL,
+            0x13b95737b2fd9084ULL, 0xa0f38b8ded9ae321ULL,
+            0xbf7144363a1ca77dULL, 0x7e51266a50947a13ULL,
+            0xeb6556c2a6c2e996ULL, 0xe0c2fe9046c1212bULL,
+            0x8a85e7a4bc47abfbULL, 0x2c5ac75c71494265ULL
+        },
+        {
+            0xb4652d0ce7a42325ULL, 0x28a89fd6e7d50027ULL,
+            0x4eb25e5ce0e5e18cULL, 0x98d6f8ee77805a94ULL,
+            0x98e7b9b8732168a7ULL, 0x258251ecc4a6d952ULL,
+            0xff3a30fc8e23bc40ULL, 0xdeda1641af1aaa95ULL,
+            0x6f669f789e358186ULL, 0x5377d234f35860b8ULL,
+            0xe43ac0f4a5b3e7cbULL, 0x1e1f58550367838fULL
+        },
+        {
+            0x8f1d014ff6144ec8ULL, 0x7a805e759720da45ULL,
+            0xf6914251e9847ebbULL, 0x3134b3b3ac68ef52ULL,
+            0xe96706e87d29cc5dULL, 0xb205e772eb61e63cULL,
+            0xdf6336fba7ab066cULL, 0xc191db981c060992ULL,
+            0x572f4a5d6f07d364ULL, 0xa41773c795164632ULL,
+            0xa9a5bc4f1b556761ULL, 0xcde308ed821bfca0ULL
+        },
+        {
+            0xb537eec27a9d9d42ULL, 0xf067cf2c432d6c88ULL,
+            0x6c917151066c9342ULL, 0x7fbb15e491cd7f69ULL,
+            0xe73790224580336aULL, 0xbe8b7265eb146f5cULL,
+            0x2429b93fc9da2bceULL, 0x0d78112cf526af07ULL,
+            0xb2c392bc7ddf811cULL, 0x3039757a899a345dULL,
+            0x700775477ec2253dULL, 0x80faa8b5058b6a1bULL
+        },
+        {
+            0x26974b69c9036fa2ULL, 0xe124a25d0f4195d3ULL,
+            0x3e7cd1842999d794ULL, 0xad49a6c3298d22fbULL,
+            0x6723413d48c1ef56ULL, 0xcba820ee3709382eULL,
+            0x0f9dc81c12b713b3ULL, 0x97555aa8569d9b6bULL,
+            0x12ee39e5a03e0707ULL, 0xf1f46f04ebc3bad7ULL,
+            0x47de29a8a0e5f222ULL, 0x3fd84947ae8d9532ULL
+        },
+        {
+            0x2a07e1e54bc0669fULL, 0xa127466c77ae8870ULL,
+            0xfdc8da584ea24d40ULL, 0x539b6d534efc156fULL,
+            0x8787afb118ad936cULL, 0xa5a26a5f71af160fULL,
+            0x5db4817f64a909a3ULL, 0xaa3e6e129e170283ULL,
+            0x19b03c28e41befe3ULL, 0x208ce0851da67c64ULL,
+            0x117a71ec3bd2f5d7ULL, 0x7b6026814cc4e0bfULL
+        },
+        {
+            0x50463c1f1a5d7d20ULL, 0xabe9b89f292540abULL,
+            0x6d21ae2bfcce6ffdULL, 0xee272931bdd12d86ULL,
+            0x795fce2f08a7dfe6ULL, 0xa6b587bd935c5a6bULL,
+            0xfed759e1fb7dc627ULL, 0x2b6619d323cd6caeULL,
+            0x0eab53bf480d20c0ULL, 0x6c353958980a06d0ULL,
+            0xfcaa1e8f9784592cULL, 0xcba7f42d824c9622ULL
+        },
+        {
+            0xb787610f2a15a2a8ULL, 0xc83865730cb9c1ecULL,
+            0xd70354447324a14dULL, 0xc2c8ed6698c3d357ULL,
+            0x4a442750b50bdb41ULL, 0xaa4d48fff674ff42ULL,
+            0x5897e20e44191dd0ULL, 0xa5bea70f33bc788dULL,
+            0xbe09f253c4c88e7aULL, 0x35a03644b46cd66dULL,
+            0x174bafc0a30803ebULL, 0x0b7929bb5823db12ULL
+        },
+        {
+            0x02470e91529927b4ULL, 0x7be30bece1df46b3ULL,
+            0x4ce647ed5d5ccb4fULL, 0xfb9dc94634b778b7ULL,
+            0x76eac995a518ee75ULL, 0x42350a84c0c0cd7eULL,
+            0x370a1ad5db339072ULL, 0xe491e1077bc77864ULL,
+            0xa83b6fd2219b892bULL, 0x3cde4bac234c6df2ULL,
+            0x86c32a2b8fc13971ULL, 0x738dd5d7aa21685bULL
+        },
+        {
+            0x9ac677cc32fd0734ULL, 0x2a80a867b8706df5ULL,
+            0xb6115df9dbcbf780ULL, 0xf021e3fe1fdf0fadULL,
+            0xa03f758cd814d25cULL, 0x1be4a4be76862ec5ULL,
+            0x1b2cf54336117569ULL, 0xe09ee3c00268b07aULL,
+            0x818422c3302a3f11ULL, 0x24cf45ba2d332e74ULL,
+            0x3d0a2443276e58c6ULL, 0x7a2d1a1364015d6cULL
+        },
+        {
+            0xc2a095b9ecaa7059ULL, 0xba1d6bb648f8d6d6ULL,
+            0x90d8fc61579f6ce8ULL, 0xa620880ab13539a4ULL,
+            0xd1b9f70c7ad58fc5ULL, 0x27aab7592b3b9923ULL,
+            0x45af661a3a2ebe58ULL, 0xfa2db6d039e4c632ULL,
+            0x5948ab5315994ff9ULL, 0xd25789a1f2585ef6ULL,
+            0x9e1f3db7753121a5ULL, 0x8018581df1b60330ULL
+        }
+    },
+    {
+        {
+            0xbcc88422c2ec3731ULL, 0x78a3e4d410dc4ec2ULL,
+            0x745da1ef2571d6b1ULL, 0xf01c2921739a956eULL,
+            0xeffd8065e4bffc16ULL, 0x6efe62a1f36fe72cULL,
+            0xf49e90d20f4629a4ULL, 0xadd1dcc78ce646f4ULL,
+            0xcb78b583b7240d91ULL, 0x2e1a7c3c03f8387fULL,
+            0x16566c223200f2d9ULL, 0x2361b14baaf80a84ULL
+        },
+        {
+            0xc20fb9111a42e5e7ULL, 0x075a678b81d12863ULL,
+            0x12bcbc6a5cc0aa89ULL, 0x5279c6ab4fb9f01eULL,
+            0xbc8e178911ae1b89ULL, 0xae74a706c290003cULL,
+            0x9949d6ec79df3f45ULL, 0xba18e26296c8d37fULL,
+            0x68de6ee2dd2275bfULL, 0xa9e4fff8c419f1d5ULL,
+            0xbc759ca4a52b5a40ULL, 0xff18cbd863b0996dULL
+        },
+        {
+            0x512d2bd0b3bdc52aULL, 0x6ca47ee9b4b31323ULL,
+            0x2cbf9130c2807d57ULL, 0xf77a6c5377b05579ULL,
+            0x060d1686cd827a01ULL, 0xb2bfdcc94d060eeeULL,
+            0x2167ef3f4aa9a23dULL, 0x5d83db331557a750ULL,
+            0xc88ef8acb42e51e1ULL, 0x79473900afa1ae46ULL,
+            0xe511c625e1b4a918ULL, 0xf0be6e201573cf7aULL
+        },
+        {
+            0xd23658c8d2e15a8cULL, 0x23f93df716ba28caULL,
+            0x6dab10ec082210f1ULL, 0xfb1add91bfc36490ULL,
+            0xeda8b02f9a4f2d14ULL, 0x9060318c56560443ULL,
+            0x6c01479e64711ab2ULL, 0x41446fc7e337eb85ULL,
+            0x4dcf3c1d71888397ULL, 0x87a9c04e13c34fd2ULL,
+            0xfe0e08ec510c15acULL, 0xfc0d0413c0f495d2ULL
+        },
+        {
+            0x82559d91ff88320cULL, 0x321dec9e965ac653ULL,
+            0x2210c11308a16dd8ULL, 0xd8ac4738d6a8e525ULL,
+            0xd0be9868747c8bfeULL, 0x30c8b8baf1e2f485ULL,
+            0x32f2ecf320eb7f95ULL, 0x2d4702e0e8639e44ULL,
+            0xfa36aca81e375480ULL, 0x1188e69fd1ec324dULL,
+            0x10502f98597dc127ULL, 0x471113597e9850dcULL
+        },
+        {
+            0x20448376648d0e7dULL, 0x34e4b9c2a4482079ULL,
+            0xace6f1d6f650b621ULL, 0x6a556ccac9420a45ULL,
+            0x9a6f10983a372144ULL, 0x663e85ca559c0308ULL,
+            0x32be5aaea531a8bcULL, 0x6292fc31665d8377ULL,
+            0x30f1ec29b1072b86ULL, 0x1edd8ccc3842c06bULL,
+            0x888639acd3f3184aULL, 0x7ed3365dc61b45f9ULL
+        },
+        {
+            0x39c7719ac0859b33ULL, 0x0fe34e457e32321cULL,
+            0xa0ff9509c499dee0ULL, 0x806fd921ac479e7fULL,
+            0xf19f626540221682ULL, 0xf4ec128b148e3665ULL,
+            0xbca87a205b3529d9ULL, 0xad783587394bfab6ULL,
+            0x9e79a83893d15e9cULL, 0x9a52b8aa8220c8e6ULL,
+            0x765b8a67acf7b50eULL, 0xe57eb4e3346dfa21ULL
+        },
+        {
+            0xc32730e8dd14d47eULL, 0xcdc1fd42c0f01e0fULL,
+            0x2bacfdbf3f5cd846ULL, 0x45f364167272d4ddULL,
+            0xdd813a795eb75776ULL, 0xb57885e450997be2ULL,
+            0xda054e2bdb8c9829ULL, 0x4161d820aab5a594ULL,
+            0x4c428f31026116a3ULL, 0x372af9a0dcd85e91ULL,
+            0xfda6e903673adc2dULL, 0x4526b8aca8db59e6ULL
+        },
+        {
+            0x9902de8a11070360ULL, 0xfd8a700c96b9c077ULL,
+            0xf5acaa823a6d4579ULL, 0x085506b74ec411faULL,
+            0xdfdce4f15dc55b2fULL, 0x18ac97a0fef30171ULL,
+            0x8dd67ef35fa55e14ULL, 0xba5b5ed397aceccfULL,
+            0x5d72c6bab42803a0ULL, 0xd8b2cf556ae7d432ULL,
+            0x5d16408b732c2157ULL, 0x7bbd9254658acddaULL
+        },
+        {
+            0xb49b90faf649514dULL, 0x6066ae3150e9f31dULL,
+            0x5a6d557b8626d7feULL, 0xe9fdbd8134a9dd5cULL,
+            0x7be787c7894ba2d8ULL, 0x46c3f6687c5c2425ULL,
+            0x588676c3ffdc387dULL, 0xcbb51731ab6f890aULL,
+            0x47f35e486a6f245dULL, 0x4f7cfe15183b01e7ULL,
+            0x155162a5faa8deb6ULL, 0xc99ca77a53707e55ULL
+        },
+        {
+            0x2365db7248f1fe0fULL, 0xc3810704bed034c9ULL,
+            0x31784eccec8ee689ULL, 0x0afef342eb61595aULL,
+            0xaa6a7ccf802a6e7bULL, 0x1a3af9219cce4b91ULL,
+            0x64e5adc646a30e92ULL, 0x6bb156948f6f63c6ULL,
+            0xd94f43513e567a0aULL, 0x4996e9440c4b6b57ULL,
+            0xa960836f48768226ULL, 0x15a2388b6e9f104eULL
+        },
+        {
+            0x1ea2d99be2045650ULL, 0xb385a3da2f68bf37ULL,
+            0x65e0fb84338020afULL, 0x95bbb4eaad04a2aeULL,
+            0x62f963dae7402f0fULL, 0xddaa5a0962a6bca9ULL,
+            0x63c55129223f7430ULL, 0x61a137e4cc22e1bfULL,
+            0x44f6aa8f0d52a241ULL, 0x21ae5ead4c074811ULL,
+            0x14ed17cf8bcebafcULL, 0xd1f7d334e1427ae7ULL
+        },
+        {
+            0x5a196e84a65562d8ULL, 0xcbf02607613f593fULL,
+            0x36d25167de217dd2ULL, 0x0077eb2225db897eULL,
+            0xa01c9b9de7d81483ULL, 0x5c3d37f1e2f1264bULL,
+            0x50dedc6a8852504eULL, 0x6ec1f2257bd6e0f1ULL,
+            0xf55d547da6a2780bULL, 0x1fa361bc3c9590a1ULL,
+            0x406afa0d68afceccULL, 0xb3acf835e4201aa9ULL
+        },
+        {
+            0x91ad008f41de2b11ULL, 0xaa838273077e17e9ULL,
+            0x62a71340d558fa78ULL, 0x6a377ab7c232da52ULL,
+            0xd816ba7403ea5534ULL, 0x7d0b7cbf2d8c5c3fULL,
+            0xf973c6bbb7022ee5ULL, 0x0af72ccf0eb7c914ULL,
+            0x49a4219bb94ceba7ULL, 0x9098969832e07aecULL,
+            0x725f579588be123dULL, 0xebe5a5bb0f10d0ebULL
+        },
+        {
+            0xbec4ce0f180eddc9ULL, 0x91fb6447d91268b5ULL,
+            0x25e3e5a6cc590234ULL, 0x91fca3300c155e2aULL,
+            0x44a45923ea10c7c7ULL, 0x613dcff93baa6cb0ULL,
+            0x4974e5e6eafa94daULL, 0xe23c88bb36b6e68fULL,
+            0x0ce0b9802ea46814ULL, 0x2e414799b1b20a3aULL,
+            0x92cbf491ddac006dULL, 0x61eed0958a291c68ULL
+        },
+        {
+            0x2e7d0a16204be028ULL, 0x4f1d082ed0e41851ULL,
+            0x15f1ddc63eb317f9ULL, 0xf02750715adf71d7ULL,
+            0x2ce33c2eee858bc3ULL, 0xa24c76d1da73b71aULL,
+            0x9ef6a70a6c70c483ULL, 0xefcf170505cf9612ULL,
+            0x9f5bf5a67502de64ULL, 0xd11122a1a4701973ULL,
+            0x82cfaac2a2ea7b24ULL, 0x6cad67cc0a4582e1ULL
+        },
+        {
+            0xaffa27d7d737d652ULL, 0xf0768af07e4b78dbULL,
+            0xafe04814caafe0a9ULL, 0x28b69f26ab46a47dULL,
+            0x9b0c6447783a2081ULL, 0x07788054944655b0ULL,
+            0x9bd0e43afe1fad60ULL, 0x3a23fc0504e2ed84ULL,
+            0x43cd26b4dfede602ULL, 0x79078cc77d0468f9ULL,
+            0x9ef04fab6d82dcc5ULL, 0x7b1901ca4e283c22ULL
+        },
+        {
+            0xbfe43437cc33fbf2ULL, 0x72da10b0270311f7ULL,
+            0x212c14d8d05d37c8ULL, 0x5d949fd3961889f1ULL,
+            0x24285e35ab3e1bdbULL, 0xf1a0d8ca402e7c07ULL,
+            0x0faf34fbee5d9281ULL, 0x67c8d79558341ef8ULL,
+            0x24339b51a0ae8af4ULL, 0x9405f0a6ab048008ULL,
+            0x122a47d01a83c1b8ULL, 0x554470c1938a1c21ULL
+        },
+        {
+            0xe098517cfeb32792ULL, 0x80514127039209f0ULL,
+            0x95c71b928e331a36ULL, 0x147e447a23175feaULL,
+            0x3bf93a3346bdd2d4ULL, 0x35bfff59870d0afaULL,
+            0x9843093f12da103aULL, 0x1fefe3b55fb4e482ULL,
+            0xed624f7ce2f7c94bULL, 0x6cb2e4f4eb88e39fULL,
+            0x1d644910483ad883ULL, 0x1443c3de20734a97ULL
+        },
+        {
+            0x8bc4b390fbf367c8ULL, 0x9d44525845f38aafULL,
+            0xf373af73bd690ffaULL, 0xf4990deb0a072ca0ULL,
+            0xa7c225250ab4d3fcULL, 0xc2977a65c9da9b38ULL,
+            0x31d21264318adbdcULL, 0x7f80852c59e37522ULL,
+            0xc3a47a5c4042244aULL, 0x3968b14415b34a19ULL,
+            0xf52f19ffc326ee89ULL, 0xa5cc52e422ba44deULL
+        },
+        {
+            0xb6bf1df360e12707ULL, 0x49e18d3de06ea42eULL,
+            0x27e2642a9fb217aeULL, 0x9d18f2a4abf3c768ULL,
+            0xcbca16150144f80dULL, 0x22fef4da87de7e0dULL,
+            0xd44505eb9d7294c8ULL, 0x7a4cd6cb689996f8ULL,
+            0x7d77f2dedfd9400eULL, 0x3dc897c3bbe4149eULL,
+            0xcdcc41238b1b954dULL, 0x2a0b2c2ab0e320a7ULL
+        },
+        {
+            0x6df54aec688948f3ULL, 0x4f3bc3741a380070ULL,
+            0x836d51b3a6af7df5ULL, 0x4da72b5c29ae6272ULL,
+            0x240414e11755af57ULL, 0xc370794590666ca7ULL,
+            0xfa2dcd66fd7833fbULL, 0x2b763a6ec6fdffb1ULL,
+            0x6333d9fb245359e5ULL, 0x4a90a761556525a7ULL,
+            0x19df9f55d3a93ebeULL, 0xf7e5a576373b9c0cULL
+        },
+        {
+            0x6fd96f8517e6b135ULL, 0x2d8d57e2e0072884ULL,
+            0xf30c84ac138e611fULL, 0x27ddda90655cf1b8ULL,
+            0xc76df08c000b9b2eULL, 0x93adfc7865b13697ULL,
+            0x83853360dd73a56eULL, 0xe987e8736b1ba120ULL,
+            0x567cbea4a9171d05ULL, 0x302c77697975f4fbULL,
+            0xba9ddd2ec6dabd16ULL, 0xd6e7622fe350e5d6ULL
+        },
+        {
+            0x7c55b3c23008fa2aULL, 0xc075a4268d31d7e8ULL,
+            0xcc26d2912494fae0ULL, 0x11fcdc1663769fbfULL,
+            0x549998b9e200bb00ULL, 0xf624c68da71352caULL,
+            0x37e3f076910d5f3cULL, 0xeea69df2c06236f5ULL,
+            0x2eb89642d6914df1ULL, 0x02e85f36737adaaaULL,
+            0x9629990938d8e215ULL, 0xf87d737b0dd2a09fULL
+        },
+        {
+            0x4d18e00e196586a3ULL, 0x1f4526eaf2a6bb96ULL,
+            0x0df4053343d3c649ULL, 0x93e72565f3cff001ULL,
+            0x72b2fe17e2503251ULL, 0xf37fd73118d8ebe7ULL,
+            0x1bc83a97aae8ee51ULL, 0x6fa591079ad72ce1ULL,
+            0x5cb23c5c754c39f9ULL, 0xf68c62e61575781aULL,
+            0x4e2a9f080cab7c81ULL, 0xc844dc364d2e3269ULL
+        },
+        {
+            0x78826d6365ec8537ULL, 0x698e1a9b1ee67461ULL,
+            0x7aba50bd99e81879ULL, 0x058a363ef4168b04ULL,
+            0xdd4e8bb490d043f5ULL, 0x79ded89a3ffa97fcULL,
+            0xd71a93e37a306becULL, 0xf5ddc115fc74b0b4ULL,
+            0x6f0adf78dfa39299ULL, 0xa00bb33325f83f0aULL,
+            0x2b8a1f9e51e692f5ULL, 0xaa75e86dfd525544ULL
+        },
+        {
+            0xd4407e8fdec08b5eULL, 0xb79746f3a5600de7ULL,
+            0xfefa8c0bcdf8cab9ULL, 0x78d06bd2625985f5ULL,
+            0xe3b221e67c391caeULL, 0xe086ce0cb484833fULL,
+            0x2c426966ab1e46a9ULL, 0x00c1165af34cb4b6ULL,
+            0x45831eb841682553ULL, 0x905420ccca6e3495ULL,
+            0xa656127bf6e50ca2ULL, 0x1a5e13fb6d15d49dULL
+        },
+        {
+            0x9fe285bae8e0b4a9ULL, 0xd44c77f8a0c80413ULL,
+            0x5f376ba4eaf35fa6ULL, 0xc4a8aecbf7285807ULL,
+            0x4804c3131fa02f4dULL, 0x18443636e481c62cULL,
+            0x9aa1d58e3e49093cULL, 0xc79960e316723fa3ULL,
+            0xd884fef0d1186074ULL, 0xbdf4b77fe285d157ULL,
+            0xcfbf592dc39c8728ULL, 0x26df21c18d66ad2dULL
+        },
+        {
+            0x523973f2399293d6ULL, 0x8324509452053f38ULL,
+            0x915b7dfec271f828ULL, 0xac9d901a64db45ffULL,
+            0xe495790b77f23f3bULL, 0x3c7ca6ddebc887d9ULL,
+            0xef5ee508b668e409ULL, 0x9b1b50caac505d80ULL,
+            0x8efca9fdd058b6d8ULL, 0x7983efea8983fa49ULL,
+            0xe946c8d091a437f6ULL, 0xa8b9657da347a1f2ULL
+        },
+        {
+            0xf3880fca5ce976a7ULL, 0xcc10a2926ad9c401ULL,
+            0x3634bed1fbf7fa34ULL, 0xd4cb2db5d7230c7eULL,
+            0x377c36c17ac6104fULL, 0x098bcf90901c51dfULL,
+            0x81c9f5d918edd2d3ULL, 0xa29a6552030cfaf8ULL,
+            0xd9122b4f0a577702ULL, 0xd819d2ce81194fbbULL,
+            0x381747a44efeca8fULL, 0xc08bc6e73d4fd1a3ULL
+        },
+        {
+            0x51afa04b22933489ULL, 0x2d82008fdbf383d7ULL,
+            0xecc91d2c30965ed4ULL, 0x35f148103e7c31b8ULL,
+            0x7e3d48e8cb5dacb3ULL, 0xb9f65487fffd44f2ULL,
+            0x6f4db2230b6eed56ULL, 0x76f508a250fc02a3ULL,
+            0xd326a104efb655e3ULL, 0xb7d3a9ebee86d1e9ULL,
+            0xfc84665f67df07caULL, 0x5b44632dc877d836ULL
+        }
+    }
+};
+
+#endif /* _ECP_64_TABLE_H */
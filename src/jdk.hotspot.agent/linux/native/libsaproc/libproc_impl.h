@@ -56,6 +56,11 @@ typedef struct map_info {
    off_t            offset;   // file offset of this mapping
    uintptr_t        vaddr;    // starting virtual address
    size_t           memsz;    // size of the mapping
+   char*            mmap_base; // start of the mmap()ed file range, NULL if not mapped
+   size_t           mmap_size; // size of the mmap()ed file range
+   char*            data;     // mapped contents at vaddr, NULL if not mapped
+   size_t           data_size; // number of bytes readable at data
+   bool             no_mmap;  // mapping the file range failed, use pread()
    struct map_info* next;
 } map_info;
 
@@ -88,6 +93,27 @@ struct core_data {
    // part of the class sharing workaround
    map_info*          class_share_maps;// class share maps in a linked list
    map_info**         map_array; // sorted (by vaddr) array of map_info pointers
+   map_info*          last_map;  // map_info returned by the last successful lookup
+};
+
+// number of blocks in the live process read cache, must be a power of 2
+#define PROC_CACHE_BLOCKS      64
+// size of one read cache block. 4K blocks never straddle a page boundary
+// on any of the supported page sizes.
+#define PROC_CACHE_BLOCK_SIZE  4096
+// marks an unused cache block, never a valid block aligned address
+#define PROC_CACHE_EMPTY       ((uintptr_t) -1)
+
+// one block of the live process read cache
+typedef struct proc_cache_block {
+   uintptr_t          addr;      // block aligned start address, PROC_CACHE_EMPTY if empty
+   char               data[PROC_CACHE_BLOCK_SIZE];
+} proc_cache_block;
+
+struct proc_data {
+   int                mem_fd;    // file descriptor of /proc/<pid>/mem, -1 if not available
+   bool               use_vm_readv; // false once process_vm_readv is known to fail
+   proc_cache_block*  cache;     // direct mapped read cache, valid while process is stopped
 };
 
 struct ps_prochandle {
@@ -99,6 +125,7 @@ struct ps_prochandle {
    int                num_threads;
    thread_info*       threads;   // head of thread list
    struct core_data*  core;      // data only used for core dumps, NULL for process
+   struct proc_data*  proc;      // data only used for live processes, NULL for core
 };
 
 int pathmap_open(const char* name);
@@ -30,6 +30,8 @@
 #include <stddef.h>
 #include <elf.h>
 #include <link.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "libproc_impl.h"
 #include "ps_core_common.h"
 #include "proc_service.h"
@@ -84,6 +86,7 @@ static bool sort_map_array(struct ps_prochandle* ph) {
   }
 
   ph->core->map_array = array;
+  ph->core->last_map = NULL;
   // sort the map_info array by base virtual address.
   qsort(ph->core->map_array, ph->core->num_maps, sizeof (map_info*),
         core_cmp_mapping);
@@ -105,6 +108,63 @@ static bool sort_map_array(struct ps_prochandle* ph) {
 #define MIN(x, y) (((x) < (y))? (x): (y))
 #endif
 
+// Segments are mmap()ed lazily on first access and reads are served by
+// copying from the mapping. This avoids one pread() per read, which
+// dominates the analysis time of large cores. Mapping is only done for
+// 64-bit SA, 32-bit address space is too small for large cores.
+static bool core_map_segment(map_info* mp) {
+#ifdef _LP64
+   struct stat st;
+   int page_size;
+   off_t delta;
+   size_t avail;
+   void* base;
+
+   if (mp->data != NULL) {
+      return true;
+   }
+   if (mp->no_mmap) {
+      return false;
+   }
+   mp->no_mmap = true;
+
+   // never map beyond the end of the file, touching such pages raises SIGBUS.
+   if (fstat(mp->fd, &st) != 0 || mp->offset >= st.st_size) {
+      return false;
+   }
+   avail = MIN(mp->memsz, (size_t) (st.st_size - mp->offset));
+
+   page_size = sysconf(_SC_PAGE_SIZE);
+   delta = mp->offset % page_size;
+   base = mmap(NULL, avail + delta, PROT_READ, MAP_PRIVATE, mp->fd, mp->offset - delta);
+   if (base == MAP_FAILED) {
+      print_debug("can't mmap %zu bytes of segment @ 0x%lx\n", avail, mp->vaddr);
+      return false;
+   }
+
+   mp->mmap_base = (char*) base;
+   mp->mmap_size = avail + delta;
+   mp->data      = mp->mmap_base + delta;
+   mp->data_size = avail;
+   mp->no_mmap   = false;
+   return true;
+#else
+   return false;
+#endif
+}
+
+// drops the mapping of a segment, e.g. because it is redirected to another file
+static void core_unmap_segment(map_info* mp) {
+   if (mp->mmap_base != NULL) {
+      munmap(mp->mmap_base, mp->mmap_size);
+   }
+   mp->mmap_base = NULL;
+   mp->mmap_size = 0;
+   mp->data      = NULL;
+   mp->data_size = 0;
+   mp->no_mmap   = false;
+}
+
 static bool core_read_data(struct ps_prochandle* ph, uintptr_t addr, char *buf, size_t size) {
    ssize_t resid = size;
    int page_size=sysconf(_SC_PAGE_SIZE);
@@ -124,7 +184,10 @@ static bool core_read_data(struct ps_prochandle* ph, uintptr_t addr, char *buf,
       len = MIN(resid, mp->memsz - mapoff);
       off = mp->offset + mapoff;
 
-      if ((len = pread(fd, buf, len, off)) <= 0) {
+      if (core_map_segment(mp) && mapoff < mp->data_size) {
+         len = MIN(len, mp->data_size - mapoff);
+         memcpy(buf, mp->data + mapoff, len);
+      } else if ((len = pread(fd, buf, len, off)) <= 0) {
          break;
       }
 
@@ -135,7 +198,7 @@ static bool core_read_data(struct ps_prochandle* ph, uintptr_t addr, char *buf,
       // mappings always start at page boundary. But, may end in fractional
       // page. fill zeros for possible fractional page at the end of a mapping.
       rem = mp->memsz % page_size;
-      if (rem > 0) {
+      if (rem > 0 && mapoff + len == mp->memsz) {
          rem = page_size - rem;
          len = MIN(resid, rem);
          resid -= len;
@@ -175,8 +238,25 @@ static bool core_get_lwp_regs(struct ps_prochandle* ph, lwpid_t lwp_id,
    return false;
 }
 
+// unmap all segments before the common clean-up closes the files
+static void core_unmap_release(struct ps_prochandle* ph) {
+   if (ph->core) {
+      map_info* map = ph->core->maps;
+      while (map) {
+         core_unmap_segment(map);
+         map = map->next;
+      }
+      map = ph->core->class_share_maps;
+      while (map) {
+         core_unmap_segment(map);
+         map = map->next;
+      }
+   }
+   core_release(ph);
+}
+
 static ps_prochandle_ops core_ops = {
-   .release=  core_release,
+   .release=  core_unmap_release,
    .p_pread=  core_read_data,
    .p_pwrite= core_write_data,
    .get_lwp_regs= core_get_lwp_regs
@@ -410,6 +490,7 @@ static bool read_lib_segments(struct ps_prochandle* ph, int lib_fd, ELF_EHDR* li
         print_debug("overwrote with new address mapping (memsz %ld -> %ld)\n",
                      existing_map->memsz, ROUNDUP(lib_php->p_memsz, page_size));
 
+        core_unmap_segment(existing_map);
         existing_map->fd = lib_fd;
         existing_map->offset = lib_php->p_offset;
         existing_map->memsz = ROUNDUP(lib_php->p_memsz, page_size);
@@ -27,6 +27,8 @@
 #include <string.h>
 #include <signal.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <dlfcn.h>
 #include <elf.h>
 #include <dirent.h>
 #include <ctype.h>
@@ -61,12 +63,13 @@ static inline uintptr_t align(uintptr_t ptr, size_t size) {
 // ptrace functions
 // ---------------------------------------------
 
-// read "size" bytes of data from "addr" within the target process.
-// unlike the standard ptrace() function, process_read_data() can handle
-// unaligned address - alignment check, if required, should be done
-// before calling process_read_data.
+// read "size" bytes of data from "addr" within the target process, one word
+// at a time. unlike the standard ptrace() function, ptrace_read_data() can
+// handle unaligned address - alignment check, if required, should be done
+// before calling process_read_data. This is the slowest way to read the
+// target memory and is only used if the bulk read methods below fail.
 
-static bool process_read_data(struct ps_prochandle* ph, uintptr_t addr, char *buf, size_t size) {
+static bool ptrace_read_data(struct ps_prochandle* ph, uintptr_t addr, char *buf, size_t size) {
   long rslt;
   size_t i, words;
   uintptr_t end_addr = addr + size;
@@ -115,6 +118,101 @@ static bool process_read_data(struct ps_prochandle* ph, uintptr_t addr, char *bu
   return true;
 }
 
+// process_vm_readv() is looked up at runtime, since it is not available in
+// every libc we build against (it was added in glibc 2.15).
+typedef ssize_t process_vm_readv_func(pid_t pid,
+                                      const struct iovec* local_iov, unsigned long liovcnt,
+                                      const struct iovec* remote_iov, unsigned long riovcnt,
+                                      unsigned long flags);
+static process_vm_readv_func* sa_process_vm_readv = NULL;
+
+// read "size" bytes of data from "addr" within the target process with
+// as few system calls as possible. process_vm_readv() is tried first, then
+// pread() on /proc/<pid>/mem. If both fail (old kernels, restricted
+// environments) we fall back to PTRACE_PEEKDATA.
+static bool bulk_read_data(struct ps_prochandle* ph, uintptr_t addr, char *buf, size_t size) {
+  struct proc_data* proc = ph->proc;
+
+  if (proc != NULL && proc->use_vm_readv) {
+    struct iovec local_iov;
+    struct iovec remote_iov;
+    ssize_t n;
+
+    local_iov.iov_base = buf;
+    local_iov.iov_len = size;
+    remote_iov.iov_base = (void*) addr;
+    remote_iov.iov_len = size;
+    n = (*sa_process_vm_readv)(ph->pid, &local_iov, 1, &remote_iov, 1, 0);
+    if (n == (ssize_t) size) {
+      return true;
+    }
+    if (n < 0 && (errno == ENOSYS || errno == EPERM)) {
+      print_debug("process_vm_readv() failed with errno %d, using /proc/%d/mem\n", errno, ph->pid);
+      proc->use_vm_readv = false;
+    }
+    // partial reads and other errors are retried below
+  }
+
+  if (proc != NULL && proc->mem_fd >= 0) {
+    size_t done = 0;
+    while (done < size) {
+      ssize_t n = pread(proc->mem_fd, buf + done, size - done, (off_t) (addr + done));
+      if (n > 0) {
+        done += n;
+      } else if (n < 0 && errno == EINTR) {
+        continue;
+      } else {
+        break;
+      }
+    }
+    if (done == size) {
+      return true;
+    }
+  }
+
+  return ptrace_read_data(ph, addr, buf, size);
+}
+
+// read "size" bytes of data from "addr" within the target process.
+// SA mostly issues small reads of a few words each, often for neighbouring
+// addresses. These are served from a small direct mapped cache of 4K blocks,
+// which stays valid because the target process is stopped while we are
+// attached to it. Larger reads go directly to the target.
+static bool process_read_data(struct ps_prochandle* ph, uintptr_t addr, char *buf, size_t size) {
+  struct proc_data* proc = ph->proc;
+
+  if (proc == NULL || proc->cache == NULL || size > PROC_CACHE_BLOCK_SIZE) {
+    return bulk_read_data(ph, addr, buf, size);
+  }
+
+  // a small read may still span two blocks
+  while (size > 0) {
+    uintptr_t block_addr = align(addr, PROC_CACHE_BLOCK_SIZE);
+    size_t offset = addr - block_addr;
+    size_t len = PROC_CACHE_BLOCK_SIZE - offset;
+    proc_cache_block* block =
+      &proc->cache[(block_addr / PROC_CACHE_BLOCK_SIZE) & (PROC_CACHE_BLOCKS - 1)];
+
+    if (len > size) {
+      len = size;
+    }
+    if (block->addr != block_addr) {
+      if (!bulk_read_data(ph, block_addr, block->data, PROC_CACHE_BLOCK_SIZE)) {
+        // a block never crosses a page boundary, so the whole block is unreadable
+        block->addr = PROC_CACHE_EMPTY;
+        print_debug("can't read %zu bytes @ %lx\n", len, addr);
+        return false;
+      }
+      block->addr = block_addr;
+    }
+    memcpy(buf, block->data + offset, len);
+    buf  += len;
+    addr += len;
+    size -= len;
+  }
+  return true;
+}
+
 // null implementation for write
 static bool process_write_data(struct ps_prochandle* ph,
                              uintptr_t addr, const char *buf , size_t size) {
@@ -425,7 +523,53 @@ static void detach_all_pids(struct ps_prochandle* ph) {
   }
 }
 
+// set up the bulk read support for a live process. Failures are not fatal,
+// reads fall back to PTRACE_PEEKDATA.
+static void init_proc_data(struct ps_prochandle* ph) {
+  char fname[32];
+  struct proc_data* proc;
+  int i;
+
+  if ( (proc = (struct proc_data*) calloc(1, sizeof(struct proc_data))) == NULL) {
+    print_debug("can't allocate memory for proc_data\n");
+    return;
+  }
+
+  sprintf(fname, "/proc/%d/mem", ph->pid);
+  proc->mem_fd = open(fname, O_RDONLY);
+  if (proc->mem_fd < 0) {
+    print_debug("can't open /proc/%d/mem file\n", ph->pid);
+  }
+  if (sa_process_vm_readv == NULL) {
+    sa_process_vm_readv = (process_vm_readv_func*) dlsym(RTLD_DEFAULT, "process_vm_readv");
+  }
+  proc->use_vm_readv = sa_process_vm_readv != NULL;
+
+  proc->cache = (proc_cache_block*) malloc(PROC_CACHE_BLOCKS * sizeof(proc_cache_block));
+  if (proc->cache == NULL) {
+    print_debug("can't allocate memory for read cache\n");
+  } else {
+    for (i = 0; i < PROC_CACHE_BLOCKS; i++) {
+      proc->cache[i].addr = PROC_CACHE_EMPTY;
+    }
+  }
+  ph->proc = proc;
+}
+
+static void destroy_proc_data(struct ps_prochandle* ph) {
+  struct proc_data* proc = ph->proc;
+  if (proc != NULL) {
+    if (proc->mem_fd >= 0) {
+      close(proc->mem_fd);
+    }
+    free(proc->cache);
+    free(proc);
+    ph->proc = NULL;
+  }
+}
+
 static void process_cleanup(struct ps_prochandle* ph) {
+  destroy_proc_data(ph);
   detach_all_pids(ph);
 }
 
@@ -464,6 +608,9 @@ Pgrab(pid_t pid, char* err_buf, size_t err_buf_len) {
   // initialize vtable
   ph->ops = &process_ops;
 
+  // set up bulk reads of the target memory
+  init_proc_data(ph);
+
   // read library info and symbol tables, must do this before attaching threads,
   // as the symbols in the pthread library will be used to figure out
   // the list of threads within the same process.
@@ -82,6 +82,7 @@ static bool sort_map_array(struct ps_prochandle* ph) {
     free(ph->core->map_array);
   }
   ph->core->map_array = array;
+  ph->core->last_map = NULL;
   // sort the map_info array by base virtual address.
   qsort(ph->core->map_array, ph->core->num_maps, sizeof (map_info*),
         core_cmp_mapping);
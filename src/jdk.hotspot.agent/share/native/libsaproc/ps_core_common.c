@@ -161,10 +161,15 @@ static map_info* add_class_share_map_info(struct ps_prochandle* ph, off_t offset
 }
 
 // Return the map_info for the given virtual address.  We keep a sorted
-// array of pointers in ph->map_array, so we can binary search.
+// array of pointers in ph->map_array, so we can binary search. Reads tend
+// to hit the same mapping repeatedly, so the last hit is checked first.
 map_info* core_lookup(struct ps_prochandle *ph, uintptr_t addr) {
   int mid, lo = 0, hi = ph->core->num_maps - 1;
-  map_info *mp;
+  map_info *mp = ph->core->last_map;
+
+  if (mp != NULL && addr >= mp->vaddr && addr < mp->vaddr + mp->memsz) {
+    return (mp);
+  }
 
   while (hi - lo > 1) {
     mid = (lo + hi) / 2;
@@ -182,6 +187,7 @@ map_info* core_lookup(struct ps_prochandle *ph, uintptr_t addr) {
   }
 
   if (addr >= mp->vaddr && addr < mp->vaddr + mp->memsz) {
+    ph->core->last_map = mp;
     return (mp);
   }
 
@@ -27,6 +27,7 @@
 #include "ArrayReferenceImpl.h"
 #include "inStream.h"
 #include "outStream.h"
+#include "commonRef.h"
 
 static jboolean
 length(PacketInputStream *in, PacketOutputStream *out)
@@ -202,27 +203,73 @@ writeDoubleComponents(JNIEnv *env, PacketOutputStream *out,
     }
 }
 
+/*
+ * Object components are fetched first and then converted to object IDs in
+ * one batch, so the reference table lock is taken once per chunk of
+ * components rather than once per component. Chunking also bounds the
+ * scratch buffer and the number of local references for large arrays.
+ */
+#define OBJECT_COMPONENTS_CHUNK 1024
+
 static void
 writeObjectComponents(JNIEnv *env, PacketOutputStream *out,
                     jarray array, jint index, jint length)
 {
+    jlong   *ids;
+    jobject *components;
+    jbyte   *typeKeys;
+    jint    chunk;
+    jboolean failed;
+
+    if (length == 0) {
+        return;
+    }
+    chunk = (length < OBJECT_COMPONENTS_CHUNK) ? length : OBJECT_COMPONENTS_CHUNK;
+    ids = jvmtiAllocate(chunk * (int)(sizeof(jlong) + sizeof(jobject) + sizeof(jbyte)));
+    if (ids == NULL) {
+        outStream_setError(out, JDWP_ERROR(OUT_OF_MEMORY));
+        return;
+    }
+    components = (jobject *)(ids + chunk);
+    typeKeys = (jbyte *)(components + chunk);
+
+    failed = JNI_FALSE;
+    while (length > 0 && !failed) {
+        jint n = (length < chunk) ? length : chunk;
+
+        WITH_LOCAL_REFS(env, n) {
+
+            int i;
+            int count;
+
+            for (count = 0; count < n; count++) {
+                components[count] = JNI_FUNC_PTR(env,GetObjectArrayElement)(env, array, index + count);
+                if (JNI_FUNC_PTR(env,ExceptionOccurred)(env)) {
+                    /* cleared by caller */
+                    failed = JNI_TRUE;
+                    break;
+                }
+                typeKeys[count] = specificTypeKey(env, components[count]);
+            }
 
-    WITH_LOCAL_REFS(env, length) {
-
-        int i;
-        jobject component;
+            commonRef_refsToIDs(env, components, ids, count);
 
-        for (i = 0; i < length; i++) {
-            component = JNI_FUNC_PTR(env,GetObjectArrayElement)(env, array, index + i);
-            if (JNI_FUNC_PTR(env,ExceptionOccurred)(env)) {
-                /* cleared by caller */
-                break;
+            for (i = 0; i < count; i++) {
+                (void)outStream_writeByte(out, typeKeys[i]);
+                if (components[i] == NULL) {
+                    (void)outStream_writeObjectRef(env, out, NULL);
+                } else {
+                    (void)outStream_writeObjectID(env, out, ids[i]);
+                }
             }
-            (void)outStream_writeByte(out, specificTypeKey(env, component));
-            (void)outStream_writeObjectRef(env, out, component);
-        }
 
-    } END_WITH_LOCAL_REFS(env);
+        } END_WITH_LOCAL_REFS(env);
+
+        index += n;
+        length -= n;
+    }
+
+    jvmtiDeallocate(ids);
 }
 
 static jboolean
@@ -56,7 +56,12 @@
  *
  * One hash table is maintained. The mapping of ID to jobject (or RefNode*)
  * is handled with one hash table that will re-size itself as the number
- * of RefNode's grow.
+ * of RefNode's grow. Re-sizing is done incrementally: the old table is
+ * kept and a few of its buckets are moved over on every insertion, so no
+ * single operation has to re-hash all RefNode's while holding refLock.
+ * Buckets of the old table are moved in index order, so an ID is found
+ * in the old table if its old bucket has not been moved yet, and in the
+ * new table otherwise (see bucketForID).
  */
 
 /* Initial hash table size (must be power of 2) */
@@ -65,6 +70,8 @@
 #define HASH_EXPAND_SCALE 8
 /* Maximum hash table size (must be power of 2) */
 #define HASH_MAX_SIZE  (1024*HASH_INIT_SIZE)
+/* Number of old buckets moved to the new table per insertion while re-hashing */
+#define HASH_REHASH_STEP 64
 
 /* Map a key (ID) to a hash bucket */
 static jint
@@ -75,6 +82,23 @@ hashBucket(jlong key)
     return ((jint)key) & (gdata->objectsByIDsize-1);
 }
 
+/*
+ * Return the head of the bucket chain which holds (or will hold) the given
+ * ID, taking a re-hash in progress into account.
+ */
+static RefNode **
+bucketForID(jlong key)
+{
+    if (gdata->objectsByIDold != NULL) {
+        /*LINTED*/
+        jint oldSlot = ((jint)key) & (gdata->objectsByIDoldSize-1);
+        if (oldSlot >= gdata->objectsByIDmigrated) {
+            return &gdata->objectsByIDold[oldSlot];
+        }
+    }
+    return &gdata->objectsByID[hashBucket(key)];
+}
+
 /* Generate a new ID */
 static jlong
 newSeqNum(void)
@@ -224,13 +248,13 @@ findNodeByRef(JNIEnv *env, jobject ref)
 static void
 deleteNodeByID(JNIEnv *env, jlong id, jint refCount)
 {
-    jint     slot;
-    RefNode *node;
-    RefNode *prev;
+    RefNode **bucket;
+    RefNode  *node;
+    RefNode  *prev;
 
-    slot = hashBucket(id);
-    node = gdata->objectsByID[slot];
-    prev = NULL;
+    bucket = bucketForID(id);
+    node   = *bucket;
+    prev   = NULL;
 
     while (node != NULL) {
         if (id == node->seqNum) {
@@ -245,7 +269,7 @@ deleteNodeByID(JNIEnv *env, jlong id, jint refCount)
                 }
                 /* Detach from id hash table */
                 if (prev == NULL) {
-                    gdata->objectsByID[slot] = node->next;
+                    *bucket = node->next;
                 } else {
                     prev->next = node->next;
                 }
@@ -271,24 +295,25 @@ deleteNodeByID(JNIEnv *env, jlong id, jint refCount)
 static RefNode *
 findNodeByID(JNIEnv *env, jlong id)
 {
-    jint     slot;
-    RefNode *node;
-    RefNode *prev;
+    RefNode **bucket;
+    RefNode  *node;
+    RefNode  *prev;
 
-    slot = hashBucket(id);
-    node = gdata->objectsByID[slot];
-    prev = NULL;
+    bucket = bucketForID(id);
+    node   = *bucket;
+    prev   = NULL;
 
     while (node != NULL) {
         if ( id == node->seqNum ) {
             if ( prev != NULL ) {
                 /* Re-order hash list so this one is up front */
                 prev->next = node->next;
-                node->next = gdata->objectsByID[slot];
-                gdata->objectsByID[slot] = node;
+                node->next = *bucket;
+                *bucket    = node;
             }
             break;
         }
+        prev = node;
         node = node->next;
     }
     return node;
@@ -304,18 +329,62 @@ initializeObjectsByID(int size)
     gdata->objectsByIDcount = 0;
     gdata->objectsByID      = (RefNode**)jvmtiAllocate((int)sizeof(RefNode*)*size);
     (void)memset(gdata->objectsByID, 0, (int)sizeof(RefNode*)*size);
+    gdata->objectsByIDold      = NULL;
+    gdata->objectsByIDoldSize  = 0;
+    gdata->objectsByIDmigrated = 0;
 }
 
 /* hash in a RefNode */
 static void
 hashIn(RefNode *node)
 {
-    jint     slot;
+    RefNode **bucket;
 
     /* Add to id hashtable */
-    slot                     = hashBucket(node->seqNum);
-    node->next               = gdata->objectsByID[slot];
-    gdata->objectsByID[slot] = node;
+    bucket     = bucketForID(node->seqNum);
+    node->next = *bucket;
+    *bucket    = node;
+}
+
+/*
+ * Move up to count buckets of the old table (if any) to the new one.
+ * The old table is freed once all its buckets are moved.
+ */
+static void
+rehashStep(int count)
+{
+    while (gdata->objectsByIDold != NULL && count-- > 0) {
+        RefNode *onode;
+        jint     slot;
+
+        onode = gdata->objectsByIDold[gdata->objectsByIDmigrated];
+        gdata->objectsByIDold[gdata->objectsByIDmigrated] = NULL;
+        gdata->objectsByIDmigrated++;
+        while (onode != NULL) {
+            RefNode *next;
+
+            next = onode->next;
+            slot = hashBucket(onode->seqNum);
+            onode->next = gdata->objectsByID[slot];
+            gdata->objectsByID[slot] = onode;
+            onode = next;
+        }
+        if (gdata->objectsByIDmigrated == gdata->objectsByIDoldSize) {
+            jvmtiDeallocate(gdata->objectsByIDold);
+            gdata->objectsByIDold      = NULL;
+            gdata->objectsByIDoldSize  = 0;
+            gdata->objectsByIDmigrated = 0;
+        }
+    }
+}
+
+/* Move all remaining buckets of the old table, if any */
+static void
+rehashAll(void)
+{
+    if (gdata->objectsByIDold != NULL) {
+        rehashStep(gdata->objectsByIDoldSize);
+    }
 }
 
 /* Allocate and add RefNode to hash table */
@@ -330,36 +399,31 @@ newCommonRef(JNIEnv *env, jobject ref)
         return NULL;
     }
 
+    /* Continue a re-hash in progress */
+    rehashStep(HASH_REHASH_STEP);
+
     /* See if hash table needs expansion */
-    if ( gdata->objectsByIDcount > gdata->objectsByIDsize*HASH_EXPAND_SCALE &&
+    if ( gdata->objectsByIDold == NULL &&
+         gdata->objectsByIDcount > gdata->objectsByIDsize*HASH_EXPAND_SCALE &&
          gdata->objectsByIDsize < HASH_MAX_SIZE ) {
         RefNode **old;
         int       oldsize;
+        int       count;
         int       newsize;
-        int       i;
 
         /* Save old information */
         old     = gdata->objectsByID;
         oldsize = gdata->objectsByIDsize;
-        /* Allocate new hash table */
+        count   = gdata->objectsByIDcount;
+        /* Allocate new hash table, the RefNodes are moved over by rehashStep */
         gdata->objectsByID = NULL;
         newsize = oldsize*HASH_EXPAND_SCALE;
         if ( newsize > HASH_MAX_SIZE ) newsize = HASH_MAX_SIZE;
         initializeObjectsByID(newsize);
-        /* Walk over old one and hash in all the RefNodes */
-        for ( i = 0 ; i < oldsize ; i++ ) {
-            RefNode *onode;
-
-            onode = old[i];
-            while (onode != NULL) {
-                RefNode *next;
-
-                next = onode->next;
-                hashIn(onode);
-                onode = next;
-            }
-        }
-        jvmtiDeallocate(old);
+        gdata->objectsByIDcount    = count;
+        gdata->objectsByIDold      = old;
+        gdata->objectsByIDoldSize  = oldsize;
+        gdata->objectsByIDmigrated = 0;
     }
 
     /* Add to id hashtable */
@@ -383,6 +447,7 @@ commonRef_reset(JNIEnv *env)
     debugMonitorEnter(gdata->refLock); {
         int i;
 
+        rehashAll();
         for (i = 0; i < gdata->objectsByIDsize; i++) {
             RefNode *node;
 
@@ -437,6 +502,39 @@ commonRef_refToID(JNIEnv *env, jobject ref)
     return id;
 }
 
+/*
+ * Batch version of commonRef_refToID(): stores the IDs of the "count"
+ * objects in "refs" into "ids", taking the reference table lock only once.
+ * A NULL reference gets NULL_OBJECT_ID, and so does a reference whose
+ * node cannot be allocated.
+ */
+void
+commonRef_refsToIDs(JNIEnv *env, jobject *refs, jlong *ids, jint count)
+{
+    debugMonitorEnter(gdata->refLock); {
+        jint i;
+
+        for (i = 0; i < count; i++) {
+            RefNode *node;
+
+            ids[i] = NULL_OBJECT_ID;
+            if (refs[i] == NULL) {
+                continue;
+            }
+            node = findNodeByRef(env, refs[i]);
+            if (node == NULL) {
+                node = newCommonRef(env, refs[i]);
+                if ( node != NULL ) {
+                    ids[i] = node->seqNum;
+                }
+            } else {
+                ids[i] = node->seqNum;
+                node->count++;
+            }
+        }
+    } debugMonitorExit(gdata->refLock);
+}
+
 /*
  * Given an object ID obtained from the debugger front end, return a
  * strong, global reference to that object (or NULL if the object
@@ -457,16 +555,19 @@ commonRef_idToRef(JNIEnv *env, jlong id)
             if (node->isStrong) {
                 saveGlobalRef(env, node->ref, &ref);
             } else {
-                jobject lref;
-
-                lref = JNI_FUNC_PTR(env,NewLocalRef)(env, node->ref);
-                // NewLocalRef never throws OOM.
-                if ( lref == NULL ) {
+                /*
+                 * NewGlobalRef on a weak ref returns NULL if the referent
+                 * has been collected (or if out of memory, see
+                 * strengthenNode), so a single JNI call both checks for
+                 * and prevents collection.
+                 */
+                ref = JNI_FUNC_PTR(env,NewGlobalRef)(env, node->ref);
+                if ( ref == NULL ) {
+                    if ( !isSameObject(env, node->ref, NULL) ) {
+                        EXIT_ERROR(AGENT_ERROR_NULL_POINTER,"NewGlobalRef");
+                    }
                     /* Object was GC'd shortly after we found the node */
                     deleteNodeByID(env, node->seqNum, ALL_REFS);
-                } else {
-                    saveGlobalRef(env, node->ref, &ref);
-                    JNI_FUNC_PTR(env,DeleteLocalRef)(env, lref);
                 }
             }
         }
@@ -572,6 +673,7 @@ commonRef_compact(void)
 
     env = getEnv();
     debugMonitorEnter(gdata->refLock); {
+        rehashAll();
         if ( gdata->objectsByIDsize > 0 ) {
             /*
              * Walk through the id-based hash table. Detach any nodes
@@ -30,6 +30,7 @@ void commonRef_initialize(void);
 void commonRef_reset(JNIEnv *env);
 
 jlong commonRef_refToID(JNIEnv *env, jobject ref);
+void commonRef_refsToIDs(JNIEnv *env, jobject *refs, jlong *ids, jint count);
 jobject commonRef_idToRef(JNIEnv *env, jlong id);
 void commonRef_idToRef_delete(JNIEnv *env, jobject ref);
 jvmtiError commonRef_pin(jlong id);
@@ -60,6 +60,38 @@ lastCommand(jdwpCmdPacket *cmd)
     }
 }
 
+/*
+ * Returns true for commands that only read type information or object
+ * state and so cannot change the result of an instance count heap walk.
+ */
+static jboolean
+readsHeapOnly(jdwpCmdPacket *cmd)
+{
+    switch (cmd->cmdSet) {
+        case JDWP_COMMAND_SET(ReferenceType):
+        case JDWP_COMMAND_SET(Method):
+        case JDWP_COMMAND_SET(Field):
+        case JDWP_COMMAND_SET(StringReference):
+            return JNI_TRUE;
+        case JDWP_COMMAND_SET(VirtualMachine):
+            return (cmd->cmd == JDWP_COMMAND(VirtualMachine, InstanceCounts)) ||
+                   (cmd->cmd == JDWP_COMMAND(VirtualMachine, AllClasses)) ||
+                   (cmd->cmd == JDWP_COMMAND(VirtualMachine, AllClassesWithGeneric)) ||
+                   (cmd->cmd == JDWP_COMMAND(VirtualMachine, ClassesBySignature)) ||
+                   (cmd->cmd == JDWP_COMMAND(VirtualMachine, IDSizes));
+        case JDWP_COMMAND_SET(ObjectReference):
+            return (cmd->cmd == JDWP_COMMAND(ObjectReference, ReferenceType)) ||
+                   (cmd->cmd == JDWP_COMMAND(ObjectReference, GetValues)) ||
+                   (cmd->cmd == JDWP_COMMAND(ObjectReference, IsCollected)) ||
+                   (cmd->cmd == JDWP_COMMAND(ObjectReference, ReferringObjects));
+        case JDWP_COMMAND_SET(ArrayReference):
+            return (cmd->cmd == JDWP_COMMAND(ArrayReference, Length)) ||
+                   (cmd->cmd == JDWP_COMMAND(ArrayReference, GetValues));
+        default:
+            return JNI_FALSE;
+    }
+}
+
 void
 debugLoop_initialize(void)
 {
@@ -139,6 +171,11 @@ debugLoop_run(void)
 
             LOG_MISC(("Command set %d, command %d", cmd->cmdSet, cmd->cmd));
 
+            /* Cached instance counts are only valid while the heap is unchanged */
+            if (!readsHeapOnly(cmd)) {
+                invalidateClassInstanceCounts(getEnv());
+            }
+
             func = debugDispatch_getHandler(cmd->cmdSet,cmd->cmd);
             if (func == NULL) {
                 /* we've never heard of this, so I guess we
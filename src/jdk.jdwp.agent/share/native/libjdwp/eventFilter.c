@@ -84,8 +84,19 @@ typedef struct StepFilter {
     jthread thread;
 } StepFilter;
 
+/*
+ * Class patterns are pre-processed when the filter is set, so that
+ * matching an event does not need to re-scan the pattern.
+ */
+#define MATCH_EXACT  0  /* no '*': the whole name must match */
+#define MATCH_PREFIX 1  /* trailing '*': compare the first compLen chars */
+#define MATCH_SUFFIX 2  /* leading '*': compare the last compLen chars */
+
 typedef struct MatchFilter {
     char *classPattern;
+    char *compPattern;  /* classPattern without the '*' */
+    jint matchKind;
+    jint compLen;
 } MatchFilter;
 
 typedef struct SourceNameFilter {
@@ -122,6 +133,7 @@ typedef struct Filter_ {
 
 typedef struct EventFilters_ {
     jint filterCount;
+    jboolean needsClassname; /* has ClassMatch or ClassExclude filters */
     Filter filters[MAX_FILTERS];
 } EventFilters;
 
@@ -138,6 +150,7 @@ typedef struct EventFilterPrivate_HandlerNode_ {
 #define FILTER_COUNT(node)  (EVENT_FILTERS(node)->filterCount)
 #define FILTERS_ARRAY(node) (EVENT_FILTERS(node)->filters)
 #define FILTER(node,index)  ((FILTERS_ARRAY(node))[index])
+#define NEEDS_CLASSNAME(node) (EVENT_FILTERS(node)->needsClassname)
 #define NODE_EI(node)          (node->ei)
 
 /***** filter set-up / destruction *****/
@@ -276,6 +289,54 @@ patternStringMatch(char *classname, const char *pattern)
     }
 }
 
+/* Pre-process a class pattern for classMatches */
+static void
+compileMatchFilter(MatchFilter *filter, char *classPattern)
+{
+    int pattLen = (int)strlen(classPattern);
+
+    filter->classPattern = classPattern;
+    if (pattLen > 0 && classPattern[0] == '*') {
+        filter->matchKind   = MATCH_SUFFIX;
+        filter->compPattern = classPattern + 1;
+        filter->compLen     = pattLen - 1;
+    } else if (pattLen > 0 && classPattern[pattLen-1] == '*') {
+        filter->matchKind   = MATCH_PREFIX;
+        filter->compPattern = classPattern;
+        filter->compLen     = pattLen - 1;
+    } else {
+        filter->matchKind   = MATCH_EXACT;
+        filter->compPattern = classPattern;
+        filter->compLen     = pattLen;
+    }
+}
+
+/*
+ * Match a class name against a pattern set up with compileMatchFilter.
+ * Same semantics as patternStringMatch.
+ */
+static jboolean
+classMatches(const char *classname, const MatchFilter *filter)
+{
+    int offset;
+
+    if ( filter->classPattern==NULL || classname==NULL ) {
+        return JNI_FALSE;
+    }
+    switch (filter->matchKind) {
+        case MATCH_EXACT:
+            return strcmp(filter->compPattern, classname) == 0;
+        case MATCH_PREFIX:
+            return strncmp(filter->compPattern, classname, filter->compLen) == 0;
+        default:
+            offset = (int)strlen(classname) - filter->compLen;
+            if (offset < 0) {
+                return JNI_FALSE;
+            }
+            return strcmp(filter->compPattern, classname + offset) == 0;
+    }
+}
+
 static jboolean isVersionGte12x() {
     jint version;
     jvmtiError err =
@@ -492,16 +553,14 @@ eventFilterRestricted_passesFilter(JNIEnv *env,
                 break;
 
         case JDWP_REQUEST_MODIFIER(ClassMatch): {
-            if (!patternStringMatch(classname,
-                       filter->u.ClassMatch.classPattern)) {
+            if (!classMatches(classname, &filter->u.ClassMatch)) {
                 return JNI_FALSE;
             }
             break;
         }
 
         case JDWP_REQUEST_MODIFIER(ClassExclude): {
-            if (patternStringMatch(classname,
-                      filter->u.ClassExclude.classPattern)) {
+            if (classMatches(classname, &filter->u.ClassExclude)) {
                 return JNI_FALSE;
             }
             break;
@@ -581,16 +640,14 @@ eventFilterRestricted_passesUnloadFilter(JNIEnv *env,
             }
 
             case JDWP_REQUEST_MODIFIER(ClassMatch): {
-                if (!patternStringMatch(classname,
-                        filter->u.ClassMatch.classPattern)) {
+                if (!classMatches(classname, &filter->u.ClassMatch)) {
                     return JNI_FALSE;
                 }
                 break;
             }
 
             case JDWP_REQUEST_MODIFIER(ClassExclude): {
-                if (patternStringMatch(classname,
-                       filter->u.ClassExclude.classPattern)) {
+                if (classMatches(classname, &filter->u.ClassExclude)) {
                     return JNI_FALSE;
                 }
                 break;
@@ -655,8 +712,7 @@ eventFilter_predictFiltering(HandlerNode *node, jclass clazz, char *classname)
             }
 
             case JDWP_REQUEST_MODIFIER(ClassMatch): {
-                if (!patternStringMatch(classname,
-                        filter->u.ClassMatch.classPattern)) {
+                if (!classMatches(classname, &filter->u.ClassMatch)) {
                     willBeFiltered = JNI_TRUE;
                     done = JNI_TRUE;
                 }
@@ -664,8 +720,7 @@ eventFilter_predictFiltering(HandlerNode *node, jclass clazz, char *classname)
             }
 
             case JDWP_REQUEST_MODIFIER(ClassExclude): {
-                if (patternStringMatch(classname,
-                       filter->u.ClassExclude.classPattern)) {
+                if (classMatches(classname, &filter->u.ClassExclude)) {
                     willBeFiltered = JNI_TRUE;
                     done = JNI_TRUE;
                 }
@@ -677,6 +732,16 @@ eventFilter_predictFiltering(HandlerNode *node, jclass clazz, char *classname)
     return willBeFiltered;
 }
 
+/**
+ * Return true if filtering events for this node needs the class name,
+ * so that callers can avoid looking it up otherwise.
+ */
+jboolean
+eventFilterRestricted_needsClassname(HandlerNode *node)
+{
+    return NEEDS_CLASSNAME(node);
+}
+
 /**
  * Determine if the given breakpoint node is in the specified class.
  */
@@ -890,7 +955,8 @@ eventFilter_setClassMatchFilter(HandlerNode *node, jint index,
 
     FILTER(node, index).modifier =
                        JDWP_REQUEST_MODIFIER(ClassMatch);
-    filter->classPattern = classPattern;
+    compileMatchFilter(filter, classPattern);
+    NEEDS_CLASSNAME(node) = JNI_TRUE;
     return JVMTI_ERROR_NONE;
 }
 
@@ -911,7 +977,8 @@ eventFilter_setClassExcludeFilter(HandlerNode *node, jint index,
 
     FILTER(node, index).modifier =
                        JDWP_REQUEST_MODIFIER(ClassExclude);
-    filter->classPattern = classPattern;
+    compileMatchFilter(filter, classPattern);
+    NEEDS_CLASSNAME(node) = JNI_TRUE;
     return JVMTI_ERROR_NONE;
 }
 
@@ -533,6 +533,71 @@ synthesizeUnloadEvent(void *signatureVoid, void *envVoid)
 /* Garbage Collection Happened */
 static unsigned int garbageCollected = 0;
 
+/*
+ * Class name of the last event that needed one, and a weak reference
+ * to its class. Consecutive events (breakpoints, steps, method entries)
+ * often occur in the same class, so this saves the class signature
+ * lookup for them. Protected by handlerLock.
+ */
+static jclass lastClassnameClass = NULL;
+static char  *lastClassname = NULL;
+
+static void
+clearClassnameCache(JNIEnv *env)
+{
+    if (lastClassnameClass != NULL) {
+        JNI_FUNC_PTR(env,DeleteWeakGlobalRef)(env, lastClassnameClass);
+        lastClassnameClass = NULL;
+    }
+    if (lastClassname != NULL) {
+        jvmtiDeallocate(lastClassname);
+        lastClassname = NULL;
+    }
+}
+
+/*
+ * Return the class name for the class of an event, NULL if there is
+ * none. The caller owns the returned string and must free it with
+ * jvmtiDeallocate(); the cache itself can be replaced by a nested
+ * event while the caller still uses the name. Must be called with
+ * handlerLock held.
+ */
+static char *
+getEventClassname(JNIEnv *env, EventInfo *evinfo)
+{
+    jclass clazz = evinfo->clazz;
+    char *classname;
+
+    if (clazz == NULL) {
+        return NULL;
+    }
+    if (lastClassnameClass != NULL && isSameObject(env, clazz, lastClassnameClass)) {
+        classname = jvmtiAllocate((int)strlen(lastClassname)+1);
+        (void)strcpy(classname, lastClassname);
+        return classname;
+    }
+
+    classname = getClassname(clazz);
+
+    /*
+     * Prepared and loaded classes are new, so there is no point
+     * in remembering them for later events.
+     */
+    if (classname != NULL &&
+        evinfo->ei != EI_CLASS_PREPARE && evinfo->ei != EI_CLASS_LOAD) {
+        clearClassnameCache(env);
+        lastClassname = jvmtiAllocate((int)strlen(classname)+1);
+        (void)strcpy(lastClassname, classname);
+        lastClassnameClass = JNI_FUNC_PTR(env,NewWeakGlobalRef)(env, clazz);
+        // NewWeakGlobalRef can throw OOM, clear exception here.
+        if ((*env)->ExceptionCheck(env)) {
+            (*env)->ExceptionClear(env);
+            clearClassnameCache(env);
+        }
+    }
+    return classname;
+}
+
 /* The JVMTI generic event callback. Each event is passed to a sequence of
  * handlers in a chain until the chain ends or one handler
  * consumes the event.
@@ -636,6 +701,7 @@ event_callback(JNIEnv *env, EventInfo *evinfo)
     {
         HandlerNode *node;
         char        *classname;
+        jboolean     classnameKnown;
 
         /* We must keep track of all classes prepared to know what's unloaded */
         if (evinfo->ei == EI_CLASS_PREPARE) {
@@ -643,13 +709,21 @@ event_callback(JNIEnv *env, EventInfo *evinfo)
         }
 
         node = getHandlerChain(evinfo->ei)->first;
-        classname = getClassname(evinfo->clazz);
+
+        /* The class name is only looked up if some handler filters on it */
+        classname = NULL;
+        classnameKnown = JNI_FALSE;
 
         while (node != NULL) {
             /* save next so handlers can remove themselves */
             HandlerNode *next = NEXT(node);
             jboolean shouldDelete;
 
+            if (!classnameKnown && eventFilterRestricted_needsClassname(node)) {
+                classname = getEventClassname(env, evinfo);
+                classnameKnown = JNI_TRUE;
+            }
+
             if (eventFilterRestricted_passesFilter(env, classname,
                                                    evinfo, node,
                                                    &shouldDelete)) {
@@ -1562,6 +1636,8 @@ eventHandler_reset(jbyte sessionID)
         (void)freeHandlerChain(getHandlerChain(i));
     }
 
+    clearClassnameCache(getEnv());
+
     requestIdCounter = 1;
     currentSessionID = sessionID;
 
@@ -206,7 +206,6 @@ jdwpError
 outStream_writeObjectRef(JNIEnv *env, PacketOutputStream *stream, jobject val)
 {
     jlong id;
-    jlong *idPtr;
 
     if (stream->error) {
         return stream->error;
@@ -214,28 +213,47 @@ outStream_writeObjectRef(JNIEnv *env, PacketOutputStream *stream, jobject val)
 
     if (val == NULL) {
         id = NULL_OBJECT_ID;
-    } else {
-        /* Convert the object to an object id */
-        id = commonRef_refToID(env, val);
-        if (id == NULL_OBJECT_ID) {
-            stream->error = JDWP_ERROR(OUT_OF_MEMORY);
-            return stream->error;
-        }
+        return writeBytes(stream, &id, sizeof(id));
+    }
+
+    /* Convert the object to an object id */
+    return outStream_writeObjectID(env, stream, commonRef_refToID(env, val));
+}
+
+/*
+ * Write the object id of a non-NULL object, as returned by
+ * commonRef_refToID() or commonRef_refsToIDs(). The stream takes over the
+ * reference count of the id; NULL_OBJECT_ID means the conversion failed.
+ */
+jdwpError
+outStream_writeObjectID(JNIEnv *env, PacketOutputStream *stream, jlong id)
+{
+    jlong *idPtr;
 
-        /* Track the common ref in case we need to release it on a future error */
-        idPtr = bagAdd(stream->ids);
-        if (idPtr == NULL) {
+    if (stream->error) {
+        if (id != NULL_OBJECT_ID) {
             commonRef_release(env, id);
-            stream->error = JDWP_ERROR(OUT_OF_MEMORY);
-            return stream->error;
-        } else {
-            *idPtr = id;
         }
+        return stream->error;
+    }
 
-        /* Add the encoded object id to the stream */
-        id = HOST_TO_JAVA_LONG(id);
+    if (id == NULL_OBJECT_ID) {
+        stream->error = JDWP_ERROR(OUT_OF_MEMORY);
+        return stream->error;
+    }
+
+    /* Track the common ref in case we need to release it on a future error */
+    idPtr = bagAdd(stream->ids);
+    if (idPtr == NULL) {
+        commonRef_release(env, id);
+        stream->error = JDWP_ERROR(OUT_OF_MEMORY);
+        return stream->error;
+    } else {
+        *idPtr = id;
     }
 
+    /* Add the encoded object id to the stream */
+    id = HOST_TO_JAVA_LONG(id);
     return writeBytes(stream, &id, sizeof(id));
 }
 
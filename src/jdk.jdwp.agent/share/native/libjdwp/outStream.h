@@ -69,6 +69,7 @@ jdwpError outStream_writeFloat(PacketOutputStream *stream, jfloat val);
 jdwpError outStream_writeDouble(PacketOutputStream *stream, jdouble val);
 jdwpError outStream_writeModuleRef(JNIEnv *env, PacketOutputStream *stream, jobject val);
 jdwpError outStream_writeObjectRef(JNIEnv *env, PacketOutputStream *stream, jobject val);
+jdwpError outStream_writeObjectID(JNIEnv *env, PacketOutputStream *stream, jlong id);
 jdwpError outStream_writeObjectTag(JNIEnv *env, PacketOutputStream *stream, jobject val);
 jdwpError outStream_writeFrameID(PacketOutputStream *stream, FrameID val);
 jdwpError outStream_writeMethodID(PacketOutputStream *stream, jmethodID val);
@@ -88,6 +88,12 @@ typedef struct ThreadNode {
 
 static jint suspendAllCount;
 
+/*
+ * Number of times the debugger has resumed a thread. Callers use it to
+ * tell whether application code may have run between two points in time.
+ */
+static jint resumeCount;
+
 typedef struct ThreadList {
     ThreadNode *first;
 } ThreadList;
@@ -974,6 +980,7 @@ resumeThreadByNode(ThreadNode *node)
             error = JVMTI_FUNC_PTR(gdata->jvmti,ResumeThread)
                         (gdata->jvmti, node->thread);
             node->frameGeneration++; /* Increment on each resume */
+            resumeCount++;
             node->toBeResumed = JNI_FALSE;
             if (error == JVMTI_ERROR_THREAD_NOT_ALIVE && !node->isStarted) {
                 /*
@@ -1242,6 +1249,7 @@ commonResumeList(JNIEnv *env)
         node->toBeResumed = JNI_FALSE;
         node->frameGeneration++; /* Increment on each resume */
     }
+    resumeCount++;
     deleteArray(results);
     deleteArray(reqList);
 
@@ -1458,6 +1466,42 @@ threadControl_suspendCount(jthread thread, jint *count)
     return error;
 }
 
+static jboolean
+isListSuspended(ThreadList *list)
+{
+    ThreadNode *node;
+
+    for (node = list->first; node != NULL; node = node->next) {
+        if (!node->isDebugThread && node->suspendCount == 0) {
+            return JNI_FALSE;
+        }
+    }
+    return JNI_TRUE;
+}
+
+/*
+ * Returns true if every application thread is currently suspended by
+ * the debugger. A VirtualMachine.Suspend does not guarantee this, since
+ * single threads can be resumed afterwards (e.g. ThreadReference.Resume
+ * or a method invocation). *resumes is set to the number of thread
+ * resumes so far, so that a caller can tell whether any application
+ * code may have run between two calls that both returned true.
+ */
+jboolean
+threadControl_isAllSuspended(jint *resumes)
+{
+    jboolean result;
+
+    debugMonitorEnter(threadLock);
+    result = (suspendAllCount > 0 &&
+              isListSuspended(&runningThreads) &&
+              isListSuspended(&otherThreads)) ? JNI_TRUE : JNI_FALSE;
+    *resumes = resumeCount;
+    debugMonitorExit(threadLock);
+
+    return result;
+}
+
 static jboolean
 contains(JNIEnv *env, jthread *list, jint count, jthread item)
 {
@@ -1896,6 +1940,9 @@ popOneFrame(jthread thread)
     /* resume the popped thread so that the pop occurs and so we */
     /* will get the event (step or method entry) after the pop */
     LOG_MISC(("thread=%p resumed in popOneFrame", thread));
+    debugMonitorEnter(threadLock);
+    resumeCount++;
+    debugMonitorExit(threadLock);
     error = JVMTI_FUNC_PTR(gdata->jvmti,ResumeThread)(gdata->jvmti, thread);
     if (error != JVMTI_ERROR_NONE) {
         return error;
@@ -2378,6 +2425,7 @@ resetHelper(JNIEnv *env, ThreadNode *node, void *arg)
         LOG_MISC(("thread=%p resumed", node->thread));
         (void)JVMTI_FUNC_PTR(gdata->jvmti,ResumeThread)(gdata->jvmti, node->thread);
         node->frameGeneration++; /* Increment on each resume */
+        resumeCount++;
     }
     stepControl_clearRequest(node->thread, &node->currentStep);
     node->toBeResumed = JNI_FALSE;
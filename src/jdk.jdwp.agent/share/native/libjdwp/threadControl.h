@@ -51,6 +51,7 @@ jvmtiError threadControl_suspendCount(jthread thread, jint *count);
 
 jvmtiError threadControl_suspendAll(void);
 jvmtiError threadControl_resumeAll(void);
+jboolean threadControl_isAllSuspended(jint *resumes);
 
 StepRequest *threadControl_getStepRequest(jthread);
 InvokeRequest *threadControl_getInvokeRequest(jthread);
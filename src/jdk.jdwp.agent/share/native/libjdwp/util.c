@@ -330,14 +330,12 @@ specificTypeKey(JNIEnv *env, jobject object)
 
 static void
 writeFieldValue(JNIEnv *env, PacketOutputStream *out, jobject object,
-                jfieldID field)
+                jclass clazz, jfieldID field)
 {
-    jclass clazz;
     char *signature = NULL;
     jvmtiError error;
     jbyte typeKey;
 
-    clazz = JNI_FUNC_PTR(env,GetObjectClass)(env, object);
     error = fieldSignature(clazz, field, NULL, &signature, NULL);
     if (error != JVMTI_ERROR_NONE) {
         outStream_setError(out, map2jdwpError(error));
@@ -507,6 +505,11 @@ sharedGetFieldValues(PacketInputStream *in, PacketOutputStream *out,
 
         int i;
 
+        if (!isStatic) {
+            /* Look up the class once for all requested instance fields */
+            clazz = JNI_FUNC_PTR(env,GetObjectClass)(env, object);
+        }
+
         (void)outStream_writeInt(out, length);
         for (i = 0; (i < length) && !outStream_error(out); i++) {
             jfieldID field = inStream_readFieldID(in);
@@ -514,7 +517,7 @@ sharedGetFieldValues(PacketInputStream *in, PacketOutputStream *out,
             if (isStatic) {
                 writeStaticFieldValue(env, out, clazz, field);
             } else {
-                writeFieldValue(env, out, object, field);
+                writeFieldValue(env, out, object, clazz, field);
             }
         }
 
@@ -2621,6 +2624,113 @@ cbObjectCounter(jlong class_tag, jlong size, jlong* tag_ptr, jint length,
     return JVMTI_VISIT_OBJECTS;
 }
 
+/*
+ * The result of the last instance count heap walk. Debuggers tend to ask
+ * for the counts of the same classes repeatedly (e.g. when refreshing a
+ * memory view), and each walk visits the whole heap. While every thread
+ * stays suspended, no thread has been resumed since the walk, and no
+ * command that may change the heap has been executed (see debugLoop.c),
+ * the counts cannot change, so the last result is reused. Only accessed
+ * from the command loop thread.
+ */
+static jint   lastCountsResumes    = 0;
+static jint   lastCountsClassCount = 0;
+static jweak *lastCountsClasses    = NULL;
+static jlong *lastCountsCounts     = NULL;
+
+/* Forget the last instance counts, the heap may have changed */
+void
+invalidateClassInstanceCounts(JNIEnv *env)
+{
+    int i;
+
+    if ( lastCountsClasses == NULL ) {
+        return;
+    }
+    for ( i = 0 ; i < lastCountsClassCount ; i++ ) {
+        if ( lastCountsClasses[i] != NULL ) {
+            JNI_FUNC_PTR(env,DeleteWeakGlobalRef)(env, lastCountsClasses[i]);
+        }
+    }
+    jvmtiDeallocate(lastCountsClasses);
+    jvmtiDeallocate(lastCountsCounts);
+    lastCountsClasses    = NULL;
+    lastCountsCounts     = NULL;
+    lastCountsClassCount = 0;
+}
+
+/* Copy the last instance counts to counts if they are for the same classes */
+static jboolean
+reuseClassInstanceCounts(JNIEnv *env, jint classCount, jclass *classes,
+                         jlong *counts)
+{
+    int i;
+    jint resumes;
+
+    if ( lastCountsClasses == NULL || classCount != lastCountsClassCount ) {
+        return JNI_FALSE;
+    }
+    if ( !threadControl_isAllSuspended(&resumes) ||
+         resumes != lastCountsResumes ) {
+        /* Application code may have run since the counts were taken */
+        invalidateClassInstanceCounts(env);
+        return JNI_FALSE;
+    }
+    for ( i = 0 ; i < classCount ; i++ ) {
+        if ( (classes[i] == NULL) != (lastCountsClasses[i] == NULL) ) {
+            return JNI_FALSE;
+        }
+        if ( classes[i] != NULL &&
+             !isSameObject(env, classes[i], lastCountsClasses[i]) ) {
+            return JNI_FALSE;
+        }
+    }
+    (void)memcpy(counts, lastCountsCounts, classCount * (int)sizeof(jlong));
+    return JNI_TRUE;
+}
+
+/*
+ * Remember instance counts computed while all threads were suspended.
+ * resumesBefore is the resume count sampled before the heap walk; if a
+ * thread was resumed during the walk the counts are not kept.
+ */
+static void
+saveClassInstanceCounts(JNIEnv *env, jint classCount, jclass *classes,
+                        jlong *counts, jint resumesBefore)
+{
+    int i;
+    jint resumes;
+
+    invalidateClassInstanceCounts(env);
+    if ( !threadControl_isAllSuspended(&resumes) || resumes != resumesBefore ) {
+        return;
+    }
+    lastCountsClasses = jvmtiAllocate(classCount * (int)sizeof(jweak));
+    lastCountsCounts  = jvmtiAllocate(classCount * (int)sizeof(jlong));
+    if ( lastCountsClasses == NULL || lastCountsCounts == NULL ) {
+        jvmtiDeallocate(lastCountsClasses);
+        jvmtiDeallocate(lastCountsCounts);
+        lastCountsClasses = NULL;
+        lastCountsCounts  = NULL;
+        return;
+    }
+    (void)memset(lastCountsClasses, 0, classCount * (int)sizeof(jweak));
+    lastCountsClassCount = classCount;
+    for ( i = 0 ; i < classCount ; i++ ) {
+        if ( classes[i] != NULL ) {
+            lastCountsClasses[i] = JNI_FUNC_PTR(env,NewWeakGlobalRef)(env, classes[i]);
+            // NewWeakGlobalRef can throw OOM, clear exception here.
+            if ((*env)->ExceptionCheck(env)) {
+                (*env)->ExceptionClear(env);
+                invalidateClassInstanceCounts(env);
+                return;
+            }
+        }
+    }
+    (void)memcpy(lastCountsCounts, counts, classCount * (int)sizeof(jlong));
+    lastCountsResumes = resumes;
+}
+
 /* Get instance counts for a set of classes */
 jvmtiError
 classInstanceCounts(jint classCount, jclass *classes, jlong *counts)
@@ -2629,6 +2739,8 @@ classInstanceCounts(jint classCount, jclass *classes, jlong *counts)
     ClassCountData     data;
     jvmtiError         error;
     jvmtiEnv          *jvmti;
+    JNIEnv            *env;
+    jint               resumesBefore;
     int                i;
 
     /* Check interface assumptions */
@@ -2636,6 +2748,13 @@ classInstanceCounts(jint classCount, jclass *classes, jlong *counts)
         return AGENT_ERROR_ILLEGAL_ARGUMENT;
     }
 
+    /* Nothing can have changed since the last heap walk for these classes */
+    env = getEnv();
+    if ( reuseClassInstanceCounts(env, classCount, classes, counts) ) {
+        return JVMTI_ERROR_NONE;
+    }
+    (void)threadControl_isAllSuspended(&resumesBefore);
+
     /* Initialize return information */
     for ( i = 0 ; i < classCount ; i++ ) {
         counts[i] = (jlong)0;
@@ -2708,7 +2827,7 @@ classInstanceCounts(jint classCount, jclass *classes, jlong *counts)
 
             /* FIXUP: Need some kind of trigger here to avoid excessive GC's? */
             error = JVMTI_FUNC_PTR(jvmti,ForceGarbageCollection)(jvmti);
-            if ( error != JVMTI_ERROR_NONE ) {
+            if ( error == JVMTI_ERROR_NONE ) {
 
                 /* Setup callbacks, just need object callback */
                 heap_callbacks.heap_iteration_callback = &cbObjectCounter;
@@ -2730,6 +2849,10 @@ classInstanceCounts(jint classCount, jclass *classes, jlong *counts)
 
     /* Dispose of any special jvmti environment */
     (void)JVMTI_FUNC_PTR(jvmti,DisposeEnvironment)(jvmti);
+
+    if ( error == JVMTI_ERROR_NONE ) {
+        saveClassInstanceCounts(env, classCount, classes, counts, resumesBefore);
+    }
     return error;
 }
 
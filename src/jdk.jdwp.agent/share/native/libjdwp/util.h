@@ -125,6 +125,9 @@ typedef struct {
     RefNode     **objectsByID;
     int           objectsByIDsize;
     int           objectsByIDcount;
+    RefNode     **objectsByIDold;      /* table being rehashed, or NULL */
+    int           objectsByIDoldSize;
+    int           objectsByIDmigrated; /* buckets of the old table already rehashed */
 
      /* Indication that the agent has been loaded */
      jboolean isLoaded;
@@ -297,6 +300,7 @@ void writeCodeLocation(struct PacketOutputStream *out, jclass clazz,
 
 jvmtiError classInstances(jclass klass, ObjectBatch *instances, int maxInstances);
 jvmtiError classInstanceCounts(jint classCount, jclass *classes, jlong *counts);
+void invalidateClassInstanceCounts(JNIEnv *env);
 jvmtiError objectReferrers(jobject obj, ObjectBatch *referrers, int maxObjects);
 
 /*
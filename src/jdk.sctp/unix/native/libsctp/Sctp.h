@@ -331,4 +331,35 @@ sctp_peeloff_func* nio_sctp_peeloff;
 
 jboolean loadSocketExtensionFuncs(JNIEnv* env);
 
+/* Maximum number of messages handled by one call of the batched send and
+ * receive functions in SctpChannelImpl.c. */
+#define SCTP_MAX_BATCH 64
+
+/* One entry of the message table that sendBatch0 and receiveBatch0 read
+ * from native memory. The Java side writes the table at these offsets,
+ * 32 bytes per entry; receiveBatch0 only uses address and length.
+ *    0: address of the message data    (jlong)
+ *    8: length of the message data     (jint)
+ *   12: association id                 (jint)
+ *   16: stream number                  (jint)
+ *   20: payload protocol identifier    (jint)
+ *   24: non-zero to send unordered     (jint)
+ */
+struct sctpBatchEntry {
+    jlong address;
+    jint length;
+    jint assocId;
+    jint streamNumber;
+    jint ppid;
+    jint unordered;
+    jint reserved;
+};
+
+/* Same layout as the Linux struct mmsghdr, which is not declared by the
+ * headers of every build platform. */
+struct sctpMmsghdr {
+    struct msghdr msg_hdr;
+    unsigned int msg_len;
+};
+
 #endif /* !SUN_NIO_CH_SCTP_H */
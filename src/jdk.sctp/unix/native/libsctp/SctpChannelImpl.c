@@ -25,6 +25,7 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <dlfcn.h>
 #include "Sctp.h"
 
 #include "jni.h"
@@ -47,6 +48,18 @@ static int SCTP_NOTIFICATION_SIZE = sizeof(union sctp_notification);
 #define PEER_CHANGE_CLASS               "sun/nio/ch/sctp/PeerAddrChange"
 #define SHUTDOWN_CLASS                  "sun/nio/ch/sctp/Shutdown"
 
+/* Size of the control data buffer for one message */
+#define SCTP_CBUF_SIZE CMSG_SPACE(sizeof (struct sctp_sndrcvinfo))
+
+/* sendmmsg and recvmmsg, looked up at runtime since not every supported
+ * libc has them. NULL if not available. */
+typedef int sendmmsg_func(int fd, struct sctpMmsghdr *msgvec, unsigned int vlen,
+                          int flags);
+typedef int recvmmsg_func(int fd, struct sctpMmsghdr *msgvec, unsigned int vlen,
+                          int flags, void *timeout);
+static sendmmsg_func* nio_sendmmsg;
+static recvmmsg_func* nio_recvmmsg;
+
 struct controlData {
     int assocId;
     unsigned short streamNumber;
@@ -131,6 +144,13 @@ JNIEXPORT void JNICALL Java_sun_nio_ch_sctp_SctpChannelImpl_initIDs
     CHECK_NULL(ss_class);
     ss_ctrID = (*env)->GetMethodID(env, cls, "<init>", "(I)V");
     CHECK_NULL(ss_ctrID);
+
+#ifdef __linux__
+    /* the batched send and receive fall back to one system call per
+     * message without these */
+    nio_sendmmsg = (sendmmsg_func*) dlsym(RTLD_DEFAULT, "sendmmsg");
+    nio_recvmmsg = (recvmmsg_func*) dlsym(RTLD_DEFAULT, "recvmmsg");
+#endif
 }
 
 void getControlData
@@ -594,3 +614,280 @@ JNIEXPORT jint JNICALL Java_sun_nio_ch_sctp_SctpChannelImpl_send0
     return rv;
 }
 
+
+/**
+ * Sends up to vlen messages. Returns the number of messages sent, or -1
+ * with errno set if not even the first one could be sent.
+ */
+static int sendMessages
+  (int fd, struct sctpMmsghdr *msgs, unsigned int vlen) {
+    unsigned int i;
+    ssize_t rv;
+
+    if (nio_sendmmsg != NULL) {
+        int n = (*nio_sendmmsg)(fd, msgs, vlen, 0);
+        if (n >= 0 || errno != ENOSYS) {
+            return n;
+        }
+        /* the kernel does not have it */
+        nio_sendmmsg = NULL;
+    }
+    for (i = 0; i < vlen; i++) {
+        if ((rv = sendmsg(fd, &msgs[i].msg_hdr, 0)) < 0) {
+            return i > 0 ? (int)i : -1;
+        }
+        msgs[i].msg_len = rv;
+    }
+    return vlen;
+}
+
+/**
+ * Receives up to vlen messages, blocking (if the socket is blocking) only
+ * until the first one arrives. Returns the number of messages received,
+ * or -1 with errno set if none could be received.
+ */
+static int receiveMessages
+  (int fd, struct sctpMmsghdr *msgs, unsigned int vlen) {
+    unsigned int i;
+    ssize_t rv;
+
+#ifdef __linux__
+    if (nio_recvmmsg != NULL) {
+        int n = (*nio_recvmmsg)(fd, msgs, vlen, MSG_WAITFORONE, NULL);
+        if (n >= 0 || errno != ENOSYS) {
+            return n;
+        }
+        nio_recvmmsg = NULL;
+    }
+#endif
+    for (i = 0; i < vlen; i++) {
+        if ((rv = recvmsg(fd, &msgs[i].msg_hdr, i == 0 ? 0 : MSG_DONTWAIT)) < 0) {
+            return i > 0 ? (int)i : -1;
+        }
+        msgs[i].msg_len = rv;
+        if (rv == 0) {
+            /* EOF */
+            return i + 1;
+        }
+    }
+    return vlen;
+}
+
+/**
+ * Handles the notification that starts in slot i of a received batch. A
+ * notification larger than the slot buffer continues in the following
+ * slots; the pieces are joined before it is handled. Returns the index of
+ * the last slot used.
+ */
+static int handleBatchNotification
+  (JNIEnv* env, int fd, jobject resultContainerObj, struct sctpMmsghdr* msgs,
+   int i, int n, SOCKETADDRESS* sa) {
+    char *bufp;
+    int last, total, read;
+
+    /* find the slot holding the end of the notification */
+    total = msgs[i].msg_len;
+    for (last = i; !(msgs[last].msg_hdr.msg_flags & MSG_EOR) && last + 1 < n;) {
+        last++;
+        total += msgs[last].msg_len;
+    }
+
+    /* always copied: the pieces have to be joined, and the notification
+     * structures need an aligned buffer on some platforms */
+    if ((bufp = malloc(total)) == NULL) {
+        JNU_ThrowOutOfMemoryError(env, "Out of native heap space.");
+        return last;
+    }
+    for (read = 0; i <= last; i++) {
+        memcpy(bufp + read, msgs[i].msg_hdr.msg_iov->iov_base, msgs[i].msg_len);
+        read += msgs[i].msg_len;
+    }
+
+    /* a send failed notification that is still incomplete reads the rest
+     * of its data from the socket itself */
+    handleNotification(env, fd, resultContainerObj,
+                       (union sctp_notification *) bufp, read,
+                       (msgs[last].msg_hdr.msg_flags & MSG_EOR), &sa[last].sa);
+    free(bufp);
+    return last;
+}
+
+/*
+ * Class:     sun_nio_ch_sctp_SctpChannelImpl
+ * Method:    receiveBatch0
+ * Signature: (I[Lsun/nio/ch/sctp/ResultContainer;JI)I
+ *
+ * Receives up to count (at most SCTP_MAX_BATCH) messages into the buffers
+ * described by the sctpBatchEntry table at address, with one system call
+ * where the platform allows. The result of slot i, as receive0 would have
+ * stored it, goes to resultContainers[i]; slots taken up by the rest of a
+ * notification and uninteresting notifications leave their container
+ * untouched. Every buffer must be able to hold a notification. Returns
+ * the number of slots used, 0 if count is not positive.
+ */
+JNIEXPORT jint JNICALL Java_sun_nio_ch_sctp_SctpChannelImpl_receiveBatch0
+  (JNIEnv *env, jclass klass, jint fd, jobjectArray resultContainers,
+   jlong address, jint count) {
+    struct sctpBatchEntry *entries = jlong_to_ptr(address);
+    SOCKETADDRESS sa[SCTP_MAX_BATCH];
+    struct iovec iov[SCTP_MAX_BATCH];
+    struct sctpMmsghdr msgs[SCTP_MAX_BATCH];
+    char cbuf[SCTP_MAX_BATCH][SCTP_CBUF_SIZE];
+    jobject resultContainerObj;
+    int i, n;
+
+    if (count <= 0) {
+        return 0;
+    }
+    if (count > SCTP_MAX_BATCH) {
+        count = SCTP_MAX_BATCH;
+    }
+
+    /* Set up the msghdr structures for receiving */
+    memset(msgs, 0, count * sizeof (msgs[0]));
+    for (i = 0; i < count; i++) {
+        if (entries[i].length < SCTP_NOTIFICATION_SIZE) {
+            JNU_ThrowIllegalArgumentException(env, "Buffer too small");
+            return IOS_THROWN;
+        }
+        /* check the containers before any message is taken off the socket */
+        resultContainerObj = (*env)->GetObjectArrayElement(env, resultContainers, i);
+        if (resultContainerObj == NULL) {
+            if (!(*env)->ExceptionCheck(env)) {
+                JNU_ThrowNullPointerException(env, "resultContainers");
+            }
+            return IOS_THROWN;
+        }
+        (*env)->DeleteLocalRef(env, resultContainerObj);
+        iov[i].iov_base = jlong_to_ptr(entries[i].address);
+        iov[i].iov_len = entries[i].length;
+        msgs[i].msg_hdr.msg_name = &sa[i];
+        msgs[i].msg_hdr.msg_namelen = sizeof(sa[i]);
+        msgs[i].msg_hdr.msg_iov = &iov[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+        msgs[i].msg_hdr.msg_control = cbuf[i];
+        msgs[i].msg_hdr.msg_controllen = SCTP_CBUF_SIZE;
+    }
+
+    if ((n = receiveMessages(fd, msgs, count)) < 0) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            return IOS_UNAVAILABLE;
+        } else if (errno == EINTR) {
+            return IOS_INTERRUPTED;
+
+#ifdef __linux__
+        } else if (errno == ENOTCONN) {
+            /* ENOTCONN when EOF reached, there will be no control data */
+            msgs[0].msg_len = 0;
+            msgs[0].msg_hdr.msg_controllen = 0;
+            msgs[0].msg_hdr.msg_flags = 0;
+            n = 1;
+#endif /* __linux__ */
+
+        } else {
+            handleSocketError(env, errno);
+            return IOS_THROWN;
+        }
+    }
+
+    for (i = 0; i < n; i++) {
+        struct msghdr *msg = &msgs[i].msg_hdr;
+
+        resultContainerObj = (*env)->GetObjectArrayElement(env, resultContainers, i);
+        if (resultContainerObj == NULL) {
+            if (!(*env)->ExceptionCheck(env)) {
+                JNU_ThrowNullPointerException(env, "resultContainers");
+            }
+            return IOS_THROWN;
+        }
+        if (msg->msg_flags & MSG_NOTIFICATION) {
+            i = handleBatchNotification(env, fd, resultContainerObj, msgs,
+                                        i, n, sa);
+        } else {
+            handleMessage(env, resultContainerObj, msg, msgs[i].msg_len,
+                          (msg->msg_flags & MSG_EOR), &sa[i].sa);
+        }
+        (*env)->DeleteLocalRef(env, resultContainerObj);
+        if ((*env)->ExceptionCheck(env)) {
+            return IOS_THROWN;
+        }
+    }
+    return n;
+}
+
+/*
+ * Class:     sun_nio_ch_sctp_SctpChannelImpl
+ * Method:    sendBatch0
+ * Signature: (IJILjava/net/InetAddress;I)I
+ *
+ * Sends up to count (at most SCTP_MAX_BATCH) messages described by the
+ * sctpBatchEntry table at address, with one system call where the
+ * platform allows. targetAddress is used for every message as in send0.
+ * Returns the number of messages sent, 0 if count is not positive.
+ */
+JNIEXPORT jint JNICALL Java_sun_nio_ch_sctp_SctpChannelImpl_sendBatch0
+  (JNIEnv *env, jclass klass, jint fd, jlong address, jint count,
+   jobject targetAddress, jint targetPort) {
+    struct sctpBatchEntry *entries = jlong_to_ptr(address);
+    SOCKETADDRESS sa;
+    int sa_len = 0;
+    struct iovec iov[SCTP_MAX_BATCH];
+    struct sctpMmsghdr msgs[SCTP_MAX_BATCH];
+    char cbuf[SCTP_MAX_BATCH][SCTP_CBUF_SIZE];
+    struct controlData cdata[1];
+    int i, n;
+
+    if (count <= 0) {
+        return 0;
+    }
+
+    if (targetAddress != NULL) {
+        if (NET_InetAddressToSockaddr(env, targetAddress, targetPort, &sa,
+                                      &sa_len, JNI_TRUE) != 0) {
+            return IOS_THROWN;
+        }
+    } else {
+        memset(&sa, '\x0', sizeof(sa));
+    }
+
+    if (count > SCTP_MAX_BATCH) {
+        count = SCTP_MAX_BATCH;
+    }
+
+    /* Set up the msghdr structures for sending */
+    memset(msgs, 0, count * sizeof (msgs[0]));
+    memset(cbuf, 0, count * SCTP_CBUF_SIZE);
+    for (i = 0; i < count; i++) {
+        iov[i].iov_base = jlong_to_ptr(entries[i].address);
+        iov[i].iov_len = entries[i].length;
+        msgs[i].msg_hdr.msg_name = &sa;
+        msgs[i].msg_hdr.msg_namelen = sa_len;
+        msgs[i].msg_hdr.msg_iov = &iov[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+        msgs[i].msg_hdr.msg_control = cbuf[i];
+        msgs[i].msg_hdr.msg_controllen = SCTP_CBUF_SIZE;
+
+        cdata->streamNumber = entries[i].streamNumber;
+        cdata->assocId = entries[i].assocId;
+        cdata->unordered = entries[i].unordered ? JNI_TRUE : JNI_FALSE;
+        cdata->ppid = entries[i].ppid;
+        setControlData(&msgs[i].msg_hdr, cdata);
+    }
+
+    if ((n = sendMessages(fd, msgs, count)) < 0) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            return IOS_UNAVAILABLE;
+        } else if (errno == EINTR) {
+            return IOS_INTERRUPTED;
+        } else if (errno == EPIPE) {
+            JNU_ThrowByName(env, JNU_JAVANETPKG "SocketException",
+                            "Socket is shutdown for writing");
+            return IOS_THROWN;
+        } else {
+            handleSocketError(env, errno);
+            return IOS_THROWN;
+        }
+    }
+
+    return n;
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026 SAP SE. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "classfile/fieldLayout.hpp"
+#include "memory/resourceArea.hpp"
+#include "unittest.hpp"
+
+TEST_VM(FieldLayout, open_space) {
+  ResourceMark rm;
+  FieldLayout layout(12);
+
+  // a long after a 12 byte header leaves a 4 byte hole
+  ASSERT_EQ(16, layout.allocate(8, 8));
+  ASSERT_EQ(24, layout.end());
+  ASSERT_EQ(1, layout.gap_count());
+  ASSERT_EQ(4, layout.gap_bytes());
+
+  // which an int fills exactly
+  ASSERT_EQ(12, layout.allocate(4, 4));
+  ASSERT_EQ(0, layout.gap_count());
+  ASSERT_EQ(24, layout.allocate(2, 2));
+  ASSERT_EQ(26, layout.end());
+}
+
+TEST_VM(FieldLayout, inherited_gaps) {
+  ResourceMark rm;
+  // superclass: int at 12, byte at 16, long at 24, byte at 32
+  FieldLayout layout(36);
+  layout.add_gap(17, 7);
+  layout.add_gap(33, 3);
+  ASSERT_EQ(10, layout.gap_bytes());
+
+  // the int goes to the first aligned spot in the first gap
+  ASSERT_EQ(20, layout.allocate(4, 4));
+  ASSERT_EQ(2, layout.gap_count());
+  // the shorts go to 18 and 34, the bytes fill up the rest
+  ASSERT_EQ(18, layout.allocate(2, 2));
+  ASSERT_EQ(34, layout.allocate(2, 2));
+  ASSERT_EQ(17, layout.allocate(1, 1));
+  ASSERT_EQ(33, layout.allocate(1, 1));
+  ASSERT_EQ(0, layout.gap_count());
+  ASSERT_EQ(36, layout.end());
+
+  // nothing left, the long goes behind
+  ASSERT_EQ(40, layout.allocate(8, 8));
+  ASSERT_EQ(48, layout.end());
+}
+
+TEST_VM(FieldLayout, min_offset) {
+  ResourceMark rm;
+  FieldLayout layout(32);
+  layout.add_gap(12, 4);
+  layout.add_gap(24, 8);
+
+  // oops must follow the inherited oops ending at 24
+  ASSERT_EQ(24, layout.allocate(8, 4, 24));
+  ASSERT_EQ(1, layout.gap_count());
+  ASSERT_EQ(36, layout.allocate(4, 4, 36));
+  ASSERT_EQ(40, layout.end());
+  // the space skipped in front of the block can still be used
+  ASSERT_EQ(2, layout.gap_count());
+  ASSERT_EQ(12, layout.allocate(4, 4));
+  ASSERT_EQ(32, layout.allocate(4, 4));
+  ASSERT_EQ(0, layout.gap_count());
+}
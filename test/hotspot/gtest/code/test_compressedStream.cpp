@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026 SAP SE. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "code/compressedStream.hpp"
+#include "memory/resourceArea.hpp"
+#include "runtime/os.hpp"
+#include "unittest.hpp"
+
+// Values around the boundaries of the 1 to 5 byte UNSIGNED5 encodings
+static const jint boundary_values[] = {
+  0, 1, 191, 192, 193, 255, 256,
+  12479, 12480, 12481,                     // 192 + 64*192 - 1, 2 -> 3 bytes
+  798911, 798912, 798913,                  // 3 -> 4 bytes
+  51130559, 51130560, 51130561,            // 4 -> 5 bytes
+  max_jint - 1, max_jint, min_jint, min_jint + 1, -2, -1
+};
+
+TEST_VM(code, compressed_stream_round_trip) {
+  ResourceMark rm;
+  const int count = sizeof(boundary_values) / sizeof(boundary_values[0]);
+  CompressedWriteStream out(16);
+  for (int i = 0; i < count; i++) {
+    out.write_int(boundary_values[i]);
+    out.write_signed_int(boundary_values[i]);
+    out.write_long((jlong) boundary_values[i] << 17);
+  }
+  CompressedReadStream in(out.buffer());
+  for (int i = 0; i < count; i++) {
+    ASSERT_EQ(boundary_values[i], in.read_int()) << "at index " << i;
+    ASSERT_EQ(boundary_values[i], in.read_signed_int()) << "at index " << i;
+    ASSERT_EQ((jlong) boundary_values[i] << 17, in.read_long()) << "at index " << i;
+  }
+  ASSERT_EQ(out.position(), in.position());
+}
+
+TEST_VM(code, compressed_stream_random) {
+  ResourceMark rm;
+  const int count = 10000;
+  jint* values = NEW_RESOURCE_ARRAY(jint, count);
+  CompressedWriteStream out(count);
+  for (int i = 0; i < count; i++) {
+    // Spread the values over all encoding lengths
+    values[i] = (jint) os::random() >> (os::random() % 32);
+    out.write_int(values[i]);
+  }
+  CompressedReadStream in(out.buffer());
+  for (int i = 0; i < count; i++) {
+    ASSERT_EQ(values[i], in.read_int()) << "at index " << i;
+  }
+  ASSERT_EQ(out.position(), in.position());
+}
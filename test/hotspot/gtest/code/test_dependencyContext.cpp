@@ -85,3 +85,39 @@ TEST_VM(code, dependency_context) {
   test_remove_dependent_nmethod(1);
   test_remove_dependent_nmethod(2);
 }
+
+TEST_VM(code, dependency_context_records) {
+  TestDependencyContext c;
+  DependencyContext depContext = c.dependencies();
+
+  DependencyRecord dep;
+  dep._type = 1;
+  dep._x = NULL;
+  dep._y = NULL;
+
+  // The buckets of the fixture were added without their dependencies
+  nmethodBucket* b = c._dependency_context;
+  ASSERT_FALSE(b->has_all_dependencies());
+  depContext.add_dependent_nmethod(b->get_nmethod(), &dep);
+  ASSERT_FALSE(b->has_all_dependencies());
+  ASSERT_EQ(0, b->dependencies_length());
+
+  nmethod nm;
+  nm.clear_unloading_state();
+  for (int i = 0; i < 5; i++) {
+    dep._type = i;
+    depContext.add_dependent_nmethod(&nm, &dep);
+  }
+  b = c._dependency_context;
+  ASSERT_EQ(&nm, b->get_nmethod());
+  ASSERT_EQ(5, b->count());
+  ASSERT_TRUE(b->has_all_dependencies());
+  ASSERT_EQ(5, b->dependencies_length());
+  for (int i = 0; i < 5; i++) {
+    ASSERT_EQ(i, b->dependency_at(i)->_type);
+  }
+
+  depContext.add_dependent_nmethod(&nm);
+  ASSERT_FALSE(b->has_all_dependencies());
+  ASSERT_EQ(0, b->dependencies_length());
+}
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2026 SAP SE. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "code/codeCache.hpp"
+#include "code/compiledMethod.inline.hpp"
+#include "code/pcDesc.hpp"
+#include "memory/allocation.inline.hpp"
+#include "memory/universe.hpp"
+#include "runtime/handles.inline.hpp"
+#include "runtime/interfaceSupport.inline.hpp"
+#include "runtime/os.hpp"
+#include "unittest.hpp"
+
+// A PcDesc table laid out like the one of an nmethod: a leading sentinel,
+// the pc descs sorted by pc offset, and a trailing sentinel.
+// An approximate lookup may look at the element before the leading
+// sentinel, like it would look at the nmethod header, so one more is
+// allocated.
+class PcDescTable {
+ private:
+  PcDesc* _memory;
+  PcDesc* _descs;
+  int     _length;
+
+ public:
+  static const int pc_step = 8;
+
+  PcDescTable(int length) : _length(length) {
+    _memory = NEW_C_HEAP_ARRAY(PcDesc, length + 3, mtTest);
+    _memory[0] = PcDesc(PcDesc::lower_offset_limit, 0, 0);
+    _descs = _memory + 1;
+    _descs[0] = PcDesc(PcDesc::lower_offset_limit, 0, 0);
+    for (int i = 1; i <= length; i++) {
+      _descs[i] = PcDesc(i * pc_step, i, i);
+    }
+    _descs[length + 1] = PcDesc(PcDesc::upper_offset_limit, 0, 0);
+  }
+
+  ~PcDescTable() {
+    FREE_C_HEAP_ARRAY(PcDesc, _memory);
+  }
+
+  PcDescSearch search() const { return PcDescSearch(code_begin(), _descs, _descs + _length + 2); }
+  address code_begin() const  { return (address)_memory; }
+  PcDesc* first() const       { return _descs; }
+
+  // the expected result, by definition of the lookup
+  PcDesc* expected(int pc_offset, bool approximate) const {
+    for (int i = 1; i <= _length + 1; i++) {
+      if (approximate ? (_descs[i - 1].pc_offset() < pc_offset && pc_offset <= _descs[i].pc_offset())
+                      : _descs[i].pc_offset() == pc_offset) {
+        return &_descs[i];
+      }
+    }
+    return NULL;
+  }
+};
+
+static void test_pc_desc_lookups(int length) {
+  PcDescTable table(length);
+  PcDescContainer container;
+  container.reset_to(table.first());
+
+  int limit = (length + 1) * PcDescTable::pc_step;
+  for (int pc_offset = 0; pc_offset <= limit; pc_offset++) {
+    address pc = table.code_begin() + pc_offset;
+    ASSERT_EQ(table.expected(pc_offset, false), container.find_pc_desc(pc, false, table.search()))
+      << "exact lookup of offset " << pc_offset << " with " << length << " pc descs";
+    ASSERT_EQ(table.expected(pc_offset, true), container.find_pc_desc(pc, true, table.search()))
+      << "approximate lookup of offset " << pc_offset << " with " << length << " pc descs";
+  }
+  // and again in reverse, so that the cache is filled differently
+  for (int pc_offset = limit; pc_offset >= 0; pc_offset--) {
+    address pc = table.code_begin() + pc_offset;
+    ASSERT_EQ(table.expected(pc_offset, false), container.find_pc_desc(pc, false, table.search()))
+      << "exact lookup of offset " << pc_offset << " with " << length << " pc descs";
+  }
+}
+
+TEST(code, pc_desc_lookup) {
+  test_pc_desc_lookups(1);
+  test_pc_desc_lookups(2);
+  test_pc_desc_lookups(17);
+  test_pc_desc_lookups(1000);
+}
+
+// Emulates walking deep stacks through one large nmethod: the return pcs
+// of the frames are looked up over and over again, so most lookups are
+// served by the cache.
+TEST_VM(code, pc_desc_lookup_stack_walk) {
+  const int length = 100000;
+  const int frames = 256;
+  const int walks = 4;
+  PcDescTable table(length);
+  PcDescContainer container;
+  container.reset_to(table.first());
+
+  int return_offsets[frames];
+  for (int i = 0; i < frames; i++) {
+    return_offsets[i] = (1 + os::random() % length) * PcDescTable::pc_step;
+  }
+
+  for (int w = 0; w < walks; w++) {
+    for (int i = 0; i < frames; i++) {
+      address pc = table.code_begin() + return_offsets[i];
+      PcDesc* expected = table.first() + return_offsets[i] / PcDescTable::pc_step;
+      ASSERT_EQ(expected, container.find_pc_desc(pc, false, table.search()))
+        << "exact lookup of offset " << return_offsets[i] << " in walk " << w;
+      ASSERT_EQ(expected, container.find_pc_desc(pc, true, table.search()))
+        << "approximate lookup of offset " << return_offsets[i] << " in walk " << w;
+    }
+  }
+}
+
+TEST_VM(code, exception_cache) {
+  ThreadInVMfromNative invm(JavaThread::current());
+  Handle exception(JavaThread::current(), Universe::int_mirror());
+  u_char code[64];
+
+  ExceptionCache* ec = new ExceptionCache(exception, code, code + 1);
+  for (int i = 1; i < 16; i++) {
+    ASSERT_TRUE(ec->add_address_and_handler(code + 4 * i, code + 4 * i + 1));
+  }
+  // adding a known pc and handler is fine even when full
+  ASSERT_TRUE(ec->add_address_and_handler(code + 4, code + 5));
+  ASSERT_FALSE(ec->match_exception_with_space(exception));
+  ASSERT_FALSE(ec->add_address_and_handler(code + 2, code + 3));
+
+  for (int i = 0; i < 16; i++) {
+    ASSERT_EQ(code + 4 * i + 1, ec->match(exception, code + 4 * i));
+  }
+  ASSERT_TRUE(ec->match(exception, code + 2) == NULL);
+  ASSERT_TRUE(ec->test_address(code + 63) == NULL);
+
+  // freed at the next safepoint, as for an entry unlinked from an nmethod
+  CodeCache::release_exception_cache(ec);
+}
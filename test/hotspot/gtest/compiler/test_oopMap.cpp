@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2026 SAP SE. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "code/vmreg.hpp"
+#include "compiler/oopMap.hpp"
+#include "memory/resourceArea.hpp"
+#include "runtime/interfaceSupport.inline.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "unittest.hpp"
+
+// An oop map set with one map per call site, each with oops in the
+// given stack slots.
+static OopMapSet* make_oop_map_set(int first_slot) {
+  OopMapSet* set = new OopMapSet();
+  for (int pc = 0; pc < 4; pc++) {
+    OopMap* map = new OopMap(8, 0);
+    map->set_oop(VMRegImpl::stack2reg(first_slot + pc));
+    set->add_gc_map(pc * 16, map);
+  }
+  return set;
+}
+
+TEST_VM(compiler, oop_map_set_sharing) {
+  ThreadInVMfromNative tivfn(JavaThread::current());
+  ResourceMark rm;
+  MutexLocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+
+  ImmutableOopMapSet* s1 = ImmutableOopMapSet::build_shared_from(make_oop_map_set(0));
+  ImmutableOopMapSet* s2 = ImmutableOopMapSet::build_shared_from(make_oop_map_set(0));
+  ImmutableOopMapSet* s3 = ImmutableOopMapSet::build_shared_from(make_oop_map_set(2));
+
+  ASSERT_EQ(s1, s2) << "identical sets should be shared";
+  ASSERT_NE(s1, s3) << "different sets must not be shared";
+  ASSERT_EQ(4, s3->count());
+  ASSERT_EQ(32, s3->pair_at(2)->pc_offset());
+
+  ImmutableOopMapSet::release_shared(s1);
+  // Still referenced through s2
+  ASSERT_EQ(4, s2->count());
+  ASSERT_EQ(16, s2->pair_at(1)->pc_offset());
+  ImmutableOopMapSet::release_shared(s2);
+  ImmutableOopMapSet::release_shared(s3);
+}
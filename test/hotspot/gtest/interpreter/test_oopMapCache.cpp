@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2026 SAP SE. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "interpreter/oopMapCache.hpp"
+#include "utilities/powerOfTwo.hpp"
+#include "unittest.hpp"
+
+TEST(interpreter, oop_map_cache_size_for) {
+  // Small classes keep the minimum table
+  EXPECT_EQ(32, OopMapCache::size_for(0));
+  EXPECT_EQ(32, OopMapCache::size_for(1));
+  EXPECT_EQ(32, OopMapCache::size_for(8));
+  // Then it grows with the number of methods
+  EXPECT_EQ(64, OopMapCache::size_for(9));
+  EXPECT_EQ(1024, OopMapCache::size_for(200));
+  // Up to a bound
+  EXPECT_EQ(4096, OopMapCache::size_for(1024));
+  EXPECT_EQ(4096, OopMapCache::size_for(65535));
+
+  for (int methods = 0; methods < 5000; methods += 7) {
+    EXPECT_TRUE(is_power_of_2(OopMapCache::size_for(methods))) << "for " << methods << " methods";
+  }
+}
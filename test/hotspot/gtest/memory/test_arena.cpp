@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026 SAP SE. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "memory/arena.hpp"
+#include "runtime/os.hpp"
+#include "runtime/thread.hpp"
+#include "utilities/align.hpp"
+#include "unittest.hpp"
+
+TEST_VM(Arena, mapped_chunk) {
+  Arena arena(mtTest);
+  size_t length = 2 * Chunk::map_size;
+  char* p = (char*)arena.Amalloc(length);
+  ASSERT_TRUE(p != NULL);
+  // A fresh mapped chunk starts on a page boundary.
+  EXPECT_TRUE(is_aligned(p - Chunk::aligned_overhead_size(), os::vm_page_size()));
+  EXPECT_GE(Chunk::mapped_length(), length);
+  EXPECT_GE(Chunk::mapped_size(), length + Chunk::aligned_overhead_size());
+  memset(p, 0x55, length);
+  EXPECT_TRUE(arena.contains(p + length - 1));
+}
+
+TEST_VM(Arena, chunk_pool_cache) {
+  ChunkPoolCache* cache = Thread::current()->chunk_pool_cache();
+  bool was_enabled = cache->is_enabled();
+  cache->enable();
+
+  const int num_arenas = 4 * ChunkPoolCache::max_chunks;
+  Arena* arenas[num_arenas];
+  for (int round = 0; round < 3; round++) {
+    for (int i = 0; i < num_arenas; i++) {
+      arenas[i] = new (mtTest) Arena(mtTest, Chunk::size);
+      char* p = (char*)arenas[i]->Amalloc(Chunk::size);
+      memset(p, i, Chunk::size);
+      // Second allocation grows into another pooled chunk.
+      arenas[i]->Amalloc(Chunk::init_size);
+    }
+    for (int i = 0; i < num_arenas; i++) {
+      delete arenas[i];
+    }
+  }
+
+  if (was_enabled) {
+    cache->release();
+  } else {
+    cache->disable();
+  }
+  EXPECT_EQ(cache->is_enabled(), was_enabled);
+}
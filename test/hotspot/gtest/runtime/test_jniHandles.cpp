@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026 SAP SE. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "jni.h"
+#include "runtime/thread.hpp"
+#include "unittest.hpp"
+
+// These tests call through the JNI function table from the gtest main
+// thread, which is a JavaThread in native.
+
+TEST_VM(JNIHandles, local_frames) {
+  JNIEnv* env = JavaThread::current()->jni_environment();
+  jobject str = env->NewStringUTF("local frame test");
+  ASSERT_TRUE(str != NULL);
+
+  // Enough locals to span several handle blocks, in nested frames
+  const int depth = 10;
+  const int refs_per_frame = 100;
+  for (int d = 0; d < depth; d++) {
+    ASSERT_EQ(JNI_OK, env->PushLocalFrame(refs_per_frame));
+    for (int i = 0; i < refs_per_frame; i++) {
+      jobject ref = env->NewLocalRef(str);
+      ASSERT_TRUE(env->IsSameObject(ref, str));
+      if ((i & 1) != 0) {
+        env->DeleteLocalRef(ref);
+      }
+    }
+  }
+  jobject result = env->NewLocalRef(str);
+  for (int d = 0; d < depth; d++) {
+    result = env->PopLocalFrame(result);
+    ASSERT_TRUE(env->IsSameObject(result, str));
+  }
+  // The popped blocks went to this thread's free list
+  ASSERT_TRUE(JavaThread::current()->free_handle_block() != NULL);
+  env->DeleteLocalRef(result);
+  env->DeleteLocalRef(str);
+}
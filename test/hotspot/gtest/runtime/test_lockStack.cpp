@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026 SAP SE. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "classfile/systemDictionary.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/oop.inline.hpp"
+#include "runtime/handles.inline.hpp"
+#include "runtime/interfaceSupport.inline.hpp"
+#include "runtime/lockStack.hpp"
+#include "runtime/semaphore.inline.hpp"
+#include "runtime/synchronizer.hpp"
+#include "threadHelper.inline.hpp"
+#include "unittest.hpp"
+
+TEST_VM(LockStack, push_and_remove) {
+  JavaThread* THREAD = JavaThread::current();
+  ThreadInVMfromNative invm(THREAD);
+  HandleMark hm(THREAD);
+  Handle a(THREAD, SystemDictionary::Byte_klass()->allocate_instance(THREAD));
+  Handle b(THREAD, SystemDictionary::Byte_klass()->allocate_instance(THREAD));
+
+  LockStack ls;
+  ASSERT_TRUE(ls.is_empty());
+  ls.push(a());
+  ls.push(b());
+  ls.push(a());
+  ASSERT_EQ(3, ls.size());
+  ASSERT_EQ(2, ls.count(a()));
+  ASSERT_EQ(1, ls.count(b()));
+
+  // Out of order exit keeps the remaining entries
+  ls.remove_last(a());
+  ASSERT_EQ(1, ls.count(a()));
+  ASSERT_TRUE(ls.contains(b()));
+
+  ls.push(a());
+  ASSERT_EQ(2, ls.remove_all(a()));
+  ASSERT_FALSE(ls.contains(a()));
+  ASSERT_EQ(1, ls.size());
+  ls.remove_last(b());
+  ASSERT_TRUE(ls.is_empty());
+
+  for (int i = 0; i < LockStack::CAPACITY; i++) {
+    ls.push(a());
+  }
+  ASSERT_TRUE(ls.is_full());
+  ASSERT_EQ(LockStack::CAPACITY, ls.remove_all(a()));
+}
+
+TEST_VM(LockStack, recursive_enter) {
+  if (!UseLockStack) {
+    return;
+  }
+  JavaThread* THREAD = JavaThread::current();
+  ThreadInVMfromNative invm(THREAD);
+  HandleMark hm(THREAD);
+  Handle h_obj(THREAD, SystemDictionary::Byte_klass()->allocate_instance(THREAD));
+  ASSERT_FALSE(UseBiasedLocking);
+
+  {
+    ObjectLocker outer(h_obj, THREAD);
+    ObjectLocker inner(h_obj, THREAD);
+    ASSERT_TRUE(h_obj->mark().is_fast_locked());
+    ASSERT_EQ(2, THREAD->lock_stack().count(h_obj()));
+    ASSERT_TRUE(ObjectSynchronizer::current_thread_holds_lock(THREAD, h_obj));
+
+    // Hashing a fast-locked object inflates it, the recursions move
+    // from the lock stack to the monitor.
+    intptr_t hash = ObjectSynchronizer::FastHashCode(THREAD, h_obj());
+    ASSERT_TRUE(h_obj->mark().has_monitor());
+    ASSERT_FALSE(THREAD->lock_stack().contains(h_obj()));
+    ASSERT_EQ(hash, ObjectSynchronizer::FastHashCode(THREAD, h_obj()));
+    ASSERT_TRUE(ObjectSynchronizer::current_thread_holds_lock(THREAD, h_obj));
+  }
+  ASSERT_FALSE(ObjectSynchronizer::current_thread_holds_lock(THREAD, h_obj));
+  ASSERT_TRUE(THREAD->lock_stack().is_empty());
+}
+
+// Hashes the object while another thread has it fast-locked, then enters
+// it, which is contended until the owner waits, and wakes the owner up.
+class ContendingThread : public JavaTestThread {
+  Handle _obj;
+  Semaphore* _hashed;
+ public:
+  volatile intptr_t _hash;
+  ContendingThread(Semaphore* post, Semaphore* hashed, Handle obj) :
+    JavaTestThread(post), _obj(obj), _hashed(hashed), _hash(0) {}
+  virtual ~ContendingThread() {}
+
+  void main_run() {
+    Thread* THREAD = Thread::current();
+    _hash = ObjectSynchronizer::FastHashCode(THREAD, _obj());
+    _hashed->signal();
+    ObjectLocker ol(_obj, THREAD);
+    ol.notify_all(THREAD);
+  }
+};
+
+TEST_VM(LockStack, contended_wait_and_hash) {
+  if (!UseLockStack) {
+    return;
+  }
+  JavaThread* THREAD = JavaThread::current();
+  ThreadInVMfromNative invm(THREAD);
+  HandleMark hm(THREAD);
+  // A new object is young and unhashed, so its fast-locked mark would be
+  // 0 if the lock bits were simply cleared.
+  Handle h_obj(THREAD, SystemDictionary::Byte_klass()->allocate_instance(THREAD));
+  ASSERT_TRUE(h_obj->mark().has_no_hash());
+  ASSERT_EQ(0u, h_obj->mark().age());
+
+  Semaphore done(0);
+  Semaphore hashed(0);
+  {
+    ObjectLocker ol(h_obj, THREAD);
+    markWord mark = h_obj->mark();
+    ASSERT_TRUE(mark.is_fast_locked());
+    ASSERT_FALSE(mark.is_being_inflated());
+    ASSERT_NE(markWord::INFLATING(), mark);
+    ASSERT_FALSE(mark.has_bias_pattern());
+    ASSERT_FALSE(mark.is_neutral());
+
+    ContendingThread* t = new ContendingThread(&done, &hashed, h_obj);
+    t->doit();
+    hashed.wait_with_safepoint_check(THREAD);
+
+    // The other thread inflated the object to install the hash, the
+    // monitor is anonymously owned until we claim it.
+    ASSERT_TRUE(h_obj->mark().has_monitor());
+    ASSERT_TRUE(ObjectSynchronizer::current_thread_holds_lock(THREAD, h_obj));
+    ASSERT_NE((intptr_t) 0, t->_hash);
+    intptr_t hash = t->_hash;
+
+    ol.wait(THREAD);
+    ASSERT_FALSE(HAS_PENDING_EXCEPTION);
+    ASSERT_TRUE(ObjectSynchronizer::current_thread_holds_lock(THREAD, h_obj));
+    ASSERT_EQ(hash, ObjectSynchronizer::FastHashCode(THREAD, h_obj()));
+  }
+  done.wait_with_safepoint_check(THREAD);
+  ASSERT_FALSE(ObjectSynchronizer::current_thread_holds_lock(THREAD, h_obj));
+  ASSERT_TRUE(THREAD->lock_stack().is_empty());
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026 SAP SE. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "runtime/interfaceSupport.inline.hpp"
+#include "runtime/os.hpp"
+#include "runtime/semaphore.inline.hpp"
+#include "runtime/thread.hpp"
+#include "runtime/threadSMR.hpp"
+#include "threadHelper.inline.hpp"
+#include "unittest.hpp"
+
+// Thread churn: short lived JavaThreads that hold ThreadsListHandles
+// while other threads are added and removed, so every exit has to scan
+// many hazard ptrs.
+class ChurnThread : public JavaTestThread {
+ public:
+  ChurnThread(Semaphore* post) : JavaTestThread(post) {}
+  virtual ~ChurnThread() {}
+
+  void main_run() {
+    for (int i = 0; i < 10; i++) {
+      ThreadsListHandle tlh;
+      int count = 0;
+      // The iterator takes a nested ThreadsListHandle
+      JavaThreadIteratorWithHandle jtiwh;
+      while (jtiwh.next() != NULL) {
+        count++;
+      }
+      ASSERT_GT(count, 0);
+      ASSERT_TRUE(tlh.includes((JavaThread*)Thread::current()));
+      os::naked_yield();
+    }
+  }
+
+  // Signal only once smr_delete() has completed
+  void post_run() {
+    Semaphore* post = _post;
+    Threads::remove(this, false);
+    this->smr_delete();
+    post->signal();
+  }
+};
+
+TEST_VM(ThreadsSMRSupport, thread_churn) {
+  const int rounds = 20;
+  const int threads_per_round = 64;
+  JavaThread* THREAD = JavaThread::current();
+  ThreadInVMfromNative invm(THREAD);
+
+  Semaphore done(0);
+  for (int r = 0; r < rounds; r++) {
+    for (int i = 0; i < threads_per_round; i++) {
+      ChurnThread* t = new ChurnThread(&done);
+      t->doit();
+    }
+    for (int i = 0; i < threads_per_round; i++) {
+      done.wait_with_safepoint_check(THREAD);
+    }
+  }
+
+  ThreadsListHandle tlh;
+  ASSERT_TRUE(tlh.includes(THREAD));
+}
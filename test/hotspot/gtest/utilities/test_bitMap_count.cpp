@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026 SAP SE. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "memory/resourceArea.hpp"
+#include "utilities/bitMap.inline.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "unittest.hpp"
+
+typedef BitMap::idx_t idx_t;
+
+static const idx_t BITMAP_SIZE = 1024;
+
+// Cluster values around word boundaries.
+static const idx_t count_offsets[] =
+  { 0, 1, 31, 32, 63, 64, 65, 127, 128, 200, 511, 512, 513, 1000, 1023, 1024 };
+
+static idx_t naive_count(const BitMap& map, idx_t beg, idx_t end) {
+  idx_t count = 0;
+  for (idx_t i = beg; i < end; i++) {
+    if (map.at(i)) count++;
+  }
+  return count;
+}
+
+TEST_VM(BitMap, count_one_bits_range) {
+  ResourceMark rm;
+  ResourceBitMap map(BITMAP_SIZE);
+  for (idx_t i = 0; i < BITMAP_SIZE; i++) {
+    if ((i * 2654435761u) % 7 < 3) map.set_bit(i);
+  }
+  EXPECT_EQ(naive_count(map, 0, BITMAP_SIZE), map.count_one_bits());
+
+  for (size_t b = 0; b < ARRAY_SIZE(count_offsets); b++) {
+    for (size_t e = b; e < ARRAY_SIZE(count_offsets); e++) {
+      idx_t beg = count_offsets[b];
+      idx_t end = count_offsets[e];
+      EXPECT_EQ(naive_count(map, beg, end), map.count_one_bits(beg, end))
+        << "range [" << beg << ", " << end << ")";
+    }
+  }
+}
+
+TEST_VM(BitMap, set_clear_long_range) {
+  ResourceMark rm;
+  const idx_t size = 200 * BitsPerWord;
+  ResourceBitMap map(size);
+
+  map.set_range(3, size - 5);
+  EXPECT_EQ(size - 8, map.count_one_bits());
+  EXPECT_FALSE(map.at(2));
+  EXPECT_TRUE(map.at(3));
+  EXPECT_TRUE(map.at(size - 6));
+  EXPECT_FALSE(map.at(size - 5));
+
+  map.clear_range(BitsPerWord + 1, size - BitsPerWord);
+  EXPECT_EQ((idx_t)(BitsPerWord - 2 + BitsPerWord - 5), map.count_one_bits());
+  EXPECT_EQ((idx_t)(BitsPerWord + 1), map.get_next_zero_offset(3));
+  EXPECT_EQ(size - BitsPerWord, map.get_next_one_offset(BitsPerWord + 1));
+}
@@ -1032,3 +1032,71 @@ public:
 TEST_VM(ConcurrentHashTable, concurrent_mt_bulk_delete) {
   mt_test_doer<Driver_BD_Thread>();
 }
+
+//#############################################################################################
+
+class MT_Grow_Thread : public JavaTestThread {
+  TestTable::GrowTask* _gt;
+  public:
+  MT_Grow_Thread(Semaphore* post, TestTable::GrowTask* gt)
+    : JavaTestThread(post), _gt(gt) {}
+  virtual ~MT_Grow_Thread() {}
+  void main_run() {
+    while(_gt->do_task(this));
+  }
+};
+
+static const uintptr_t GROW_NUM_ITEMS = 1 << 16;
+static const size_t GROW_START_LOG2 = 10;
+static const size_t GROW_END_LOG2 = 14;
+static const int GROW_NUM_WORKERS = 4;
+
+class Driver_Grow_Thread : public JavaTestThread {
+  // Grows the table from GROW_START_LOG2 to GROW_END_LOG2, one doubling at a time.
+  void grow(TestTable* cht, bool mt) {
+    for (size_t log2 = GROW_START_LOG2; log2 < GROW_END_LOG2; log2++) {
+      TestTable::GrowTask gt(cht, mt);
+      EXPECT_TRUE(gt.prepare(this)) << "Uncontended prepare must work.";
+      if (mt) {
+        Semaphore done(0);
+        MT_Grow_Thread* tt[GROW_NUM_WORKERS];
+        for (int i = 0; i < GROW_NUM_WORKERS; i++) {
+          tt[i] = new MT_Grow_Thread(&done, &gt);
+          tt[i]->doit();
+        }
+        for (int i = 0; i < GROW_NUM_WORKERS; i++) {
+          done.wait();
+        }
+      } else {
+        while(gt.do_task(this));
+      }
+      gt.done(this);
+    }
+  }
+
+public:
+  Driver_Grow_Thread(Semaphore* post) : JavaTestThread(post) {
+  };
+  virtual ~Driver_Grow_Thread(){}
+
+  void main_run() {
+    for (int mt = 0; mt < 2; mt++) {
+      TestTable* cht = new TestTable(GROW_START_LOG2, GROW_END_LOG2, GROW_NUM_ITEMS);
+      for (uintptr_t v = 1; v <= GROW_NUM_ITEMS; v++) {
+        TestLookup tl(v);
+        EXPECT_TRUE(cht->insert(this, tl, v)) << "Inserting an unique value should work.";
+      }
+      grow(cht, mt == 1);
+      EXPECT_EQ(cht->get_size_log2(this), GROW_END_LOG2) << "Table should have grown.";
+      for (uintptr_t v = 1; v <= GROW_NUM_ITEMS; v++) {
+        TestLookup tl(v);
+        EXPECT_EQ(cht_get_copy(cht, this, tl), v) << "Getting an item after grow failed.";
+      }
+      delete cht;
+    }
+  }
+};
+
+TEST_VM(ConcurrentHashTable, concurrent_mt_grow) {
+  mt_test_doer<Driver_Grow_Thread>();
+}
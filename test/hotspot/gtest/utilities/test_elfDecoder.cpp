@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026 SAP SE. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+
+#if defined(LINUX)
+
+#include "jni.h"
+#include "jvm.h"
+#include "runtime/os.hpp"
+#include "utilities/decoder.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "unittest.hpp"
+
+// Decodes through the ELF symbol tables of libjvm, bypassing dladdr.
+static bool decode_in_libjvm(address addr, char* buf, int buflen, int* offset) {
+  char path[JVM_MAXPATHLEN];
+  int lib_offset;
+  if (!os::dll_address_to_library_name(addr, path, sizeof(path), &lib_offset)) {
+    return false;
+  }
+  return Decoder::decode((address)(intptr_t)lib_offset, buf, buflen, offset, path);
+}
+
+TEST_VM(ElfDecoder, decode_function) {
+  char buf[256];
+  int offset = -1;
+  address addr = CAST_FROM_FN_PTR(address, JNI_CreateJavaVM) + 4;
+  ASSERT_TRUE(decode_in_libjvm(addr, buf, sizeof(buf), &offset));
+  EXPECT_TRUE(strstr(buf, "JNI_CreateJavaVM") != NULL) << "got " << buf;
+  EXPECT_EQ(4, offset);
+}
+
+#endif // LINUX
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026 SAP SE. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+/**
+ * @test
+ * @summary Load thousands of subclasses into a hierarchy with compiled
+ *          CHA dependencies and check that the compiled callers return
+ *          correct results before and after a subclass invalidates them
+ *
+ * @run main/othervm -Xbatch compiler.dependencies.TestManySubclassLoads
+ */
+
+package compiler.dependencies;
+
+import java.io.ByteArrayOutputStream;
+import java.io.IOException;
+import java.io.InputStream;
+
+public class TestManySubclassLoads {
+    static final int CLASSES = 5000;
+    static final int ITERATIONS = 20_000;
+
+    public static abstract class Base {
+        public abstract int value();
+        public int other() { return 1; }
+    }
+
+    public static class Impl extends Base {
+        public int value() { return 42; }
+    }
+
+    // Loaded many times; keeps value() and other() unique, so the
+    // compiled callers below must stay valid.
+    public static class Quiet extends Impl {
+    }
+
+    // Loaded last; overrides value(), so the compiled callers must
+    // be deoptimized.
+    public static class Loud extends Impl {
+        public int value() { return 17; }
+    }
+
+    static int callValue(Base b) {
+        return b.value();
+    }
+
+    static int callOther(Base b) {
+        return b.other();
+    }
+
+    static int warmup(Base b) {
+        int sum = 0;
+        for (int i = 0; i < ITERATIONS; i++) {
+            sum += callValue(b) + callOther(b);
+        }
+        return sum;
+    }
+
+    // Defines a fresh copy of a nested class in its own loader, so that
+    // every copy is a new subclass of the classes loaded by the parent.
+    static class CopyLoader extends ClassLoader {
+        private final String name;
+        private final byte[] bytes;
+
+        CopyLoader(String name, byte[] bytes) {
+            super(TestManySubclassLoads.class.getClassLoader());
+            this.name = name;
+            this.bytes = bytes;
+        }
+
+        @Override
+        protected Class<?> loadClass(String n, boolean resolve) throws ClassNotFoundException {
+            if (n.equals(name)) {
+                synchronized (getClassLoadingLock(n)) {
+                    Class<?> c = findLoadedClass(n);
+                    if (c == null) {
+                        c = defineClass(n, bytes, 0, bytes.length);
+                    }
+                    return c;
+                }
+            }
+            return super.loadClass(n, resolve);
+        }
+    }
+
+    static byte[] classBytes(Class<?> c) throws IOException {
+        String resource = c.getName().replace('.', '/') + ".class";
+        try (InputStream in = TestManySubclassLoads.class.getClassLoader().getResourceAsStream(resource)) {
+            ByteArrayOutputStream out = new ByteArrayOutputStream();
+            byte[] buf = new byte[4096];
+            int n;
+            while ((n = in.read(buf)) > 0) {
+                out.write(buf, 0, n);
+            }
+            return out.toByteArray();
+        }
+    }
+
+    static Base newCopy(Class<?> c, byte[] bytes) throws Exception {
+        Class<?> copy = Class.forName(c.getName(), true, new CopyLoader(c.getName(), bytes));
+        if (copy == c) {
+            throw new RuntimeException("Expected a fresh copy of " + c.getName());
+        }
+        return (Base) copy.getDeclaredConstructor().newInstance();
+    }
+
+    public static void main(String[] args) throws Exception {
+        Base impl = new Impl();
+        int expected = ITERATIONS * 43;
+        if (warmup(impl) != expected) {
+            throw new RuntimeException("Wrong warmup result");
+        }
+
+        byte[] quiet = classBytes(Quiet.class);
+        for (int i = 0; i < CLASSES; i++) {
+            Base b = newCopy(Quiet.class, quiet);
+            if (callValue(b) != 42 || callOther(b) != 1) {
+                throw new RuntimeException("Wrong result for copy " + i);
+            }
+            if (i % 500 == 0 && warmup(impl) != expected) {
+                throw new RuntimeException("Wrong result after " + i + " copies");
+            }
+        }
+
+        Base loud = newCopy(Loud.class, classBytes(Loud.class));
+        if (callValue(loud) != 17 || callValue(impl) != 42) {
+            throw new RuntimeException("Compiled code was not invalidated by " + loud.getClass());
+        }
+    }
+}
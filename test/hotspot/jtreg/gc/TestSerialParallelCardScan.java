@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026 SAP SE. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+package gc;
+
+/*
+ * @test TestSerialParallelCardScan
+ * @key gc
+ * @requires vm.gc.Serial
+ * @summary Young collections scanning the old generation's cards with worker
+ *          threads keep all old-to-young references intact.
+ * @run main/othervm -XX:+UseSerialGC -Xmx64m -Xmn8m
+ *                   -XX:+UnlockExperimentalVMOptions -XX:DefNewCardScanThreads=2
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+VerifyAfterGC
+ *                   gc.TestSerialParallelCardScan
+ */
+
+public class TestSerialParallelCardScan {
+
+    static class Node {
+        final int value;
+        Object payload;
+        Node(int value) { this.value = value; }
+    }
+
+    static final int OLD_NODES = 200_000;
+    static final int ROUNDS = 20;
+
+    static Object sink;
+
+    public static void main(String args[]) {
+        Node[] nodes = new Node[OLD_NODES];
+        for (int i = 0; i < nodes.length; i++) {
+            nodes[i] = new Node(i);
+        }
+        // Promote the array and the nodes into the old generation.
+        System.gc();
+
+        for (int round = 0; round < ROUNDS; round++) {
+            // Dirty cards all over the old generation.
+            for (int i = round % 7; i < nodes.length; i += 7) {
+                nodes[i].payload = new int[] { i, round };
+            }
+            // Force young collections.
+            for (int i = 0; i < 100_000; i++) {
+                sink = new byte[64];
+            }
+            for (int i = round % 7; i < nodes.length; i += 7) {
+                int[] payload = (int[])nodes[i].payload;
+                if (nodes[i].value != i || payload[0] != i || payload[1] != round) {
+                    throw new RuntimeException("Bad payload at " + i + " in round " + round);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2026 SAP SE. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+/*
+ * @test TestCompactFieldLayout
+ * @summary Classes mixing oop and primitive fields of every size, alone and
+ *          below superclasses that leave gaps, load with UseCompactFieldLayout
+ *          and get disjoint field offsets and working oop maps
+ * @modules java.base/jdk.internal.misc
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+UseCompactFieldLayout TestCompactFieldLayout
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+UseCompactFieldLayout -XX:-UseCompressedOops TestCompactFieldLayout
+ */
+
+import java.lang.reflect.Field;
+import java.lang.reflect.Modifier;
+import java.util.ArrayList;
+import java.util.List;
+
+import jdk.internal.misc.Unsafe;
+
+public class TestCompactFieldLayout {
+
+    static final Unsafe unsafe = Unsafe.getUnsafe();
+
+    static class Mixed {
+        byte b1;
+        Object o1;
+        long l1;
+        short s1;
+        String o2;
+        int i1;
+        char c1;
+        double d1;
+        boolean z1;
+        Object[] o3;
+        float f1;
+    }
+
+    // Leaves a hole behind the int and one behind the byte.
+    static class Base {
+        int i0;
+        long l0;
+        byte b0;
+        Object o0;
+    }
+
+    static class Derived extends Base {
+        short s1;
+        Object o1;
+        byte b1;
+        long l1;
+        Object o2;
+        int i1;
+        char c1;
+    }
+
+    static class MoreDerived extends Derived {
+        boolean z2;
+        Object o3;
+        double d2;
+        byte b2;
+    }
+
+    public static void main(String... args) throws Exception {
+        checkOffsets(Mixed.class);
+        checkOffsets(Derived.class);
+        checkOffsets(MoreDerived.class);
+        testMixed();
+        testDerived();
+    }
+
+    static void check(boolean condition, String message) {
+        if (!condition) {
+            throw new RuntimeException(message);
+        }
+    }
+
+    static int size(Class<?> type) {
+        if (!type.isPrimitive()) {
+            return unsafe.arrayIndexScale(Object[].class);
+        }
+        if (type == long.class || type == double.class) {
+            return 8;
+        }
+        if (type == int.class || type == float.class) {
+            return 4;
+        }
+        if (type == short.class || type == char.class) {
+            return 2;
+        }
+        return 1;
+    }
+
+    // The instance fields of the class and all its superclasses must be
+    // naturally aligned and must not overlap.
+    static void checkOffsets(Class<?> c) {
+        List<Field> fields = new ArrayList<>();
+        for (Class<?> k = c; k != Object.class; k = k.getSuperclass()) {
+            for (Field f : k.getDeclaredFields()) {
+                if (!Modifier.isStatic(f.getModifiers())) {
+                    fields.add(f);
+                }
+            }
+        }
+        for (Field f : fields) {
+            long offset = unsafe.objectFieldOffset(f);
+            int size = size(f.getType());
+            check(offset % size == 0, c.getName() + "." + f.getName() + " misaligned at " + offset);
+            for (Field g : fields) {
+                if (f == g) {
+                    continue;
+                }
+                long other = unsafe.objectFieldOffset(g);
+                check(offset + size <= other || other + size(g.getType()) <= offset,
+                      c.getName() + ": " + f.getName() + " at " + offset +
+                      " overlaps " + g.getName() + " at " + other);
+            }
+        }
+    }
+
+    // Values written to each field must come back unchanged, also for the
+    // oops after a GC moved the objects they refer to.
+    static void testMixed() {
+        Mixed[] objs = new Mixed[1000];
+        for (int i = 0; i < objs.length; i++) {
+            Mixed m = new Mixed();
+            m.b1 = (byte) i;
+            m.o1 = Integer.valueOf(i);
+            m.l1 = -i;
+            m.s1 = (short) (i * 3);
+            m.o2 = "s" + i;
+            m.i1 = i * 7;
+            m.c1 = (char) (i + 1);
+            m.d1 = i / 2.0;
+            m.z1 = (i & 1) != 0;
+            m.o3 = new Object[] { m.o1 };
+            m.f1 = i * 1.5f;
+            objs[i] = m;
+        }
+        System.gc();
+        for (int i = 0; i < objs.length; i++) {
+            Mixed m = objs[i];
+            check(m.b1 == (byte) i && m.l1 == -i && m.s1 == (short) (i * 3) &&
+                  m.i1 == i * 7 && m.c1 == (char) (i + 1) && m.d1 == i / 2.0 &&
+                  m.z1 == ((i & 1) != 0) && m.f1 == i * 1.5f,
+                  "primitive field of Mixed " + i + " changed");
+            check(m.o1.equals(i) && m.o2.equals("s" + i) && m.o3[0] == m.o1,
+                  "oop field of Mixed " + i + " changed");
+        }
+    }
+
+    static void testDerived() {
+        MoreDerived[] objs = new MoreDerived[1000];
+        for (int i = 0; i < objs.length; i++) {
+            MoreDerived m = new MoreDerived();
+            m.i0 = i;
+            m.l0 = -i;
+            m.b0 = (byte) (i + 1);
+            m.o0 = "a" + i;
+            m.s1 = (short) (i * 5);
+            m.o1 = "b" + i;
+            m.b1 = (byte) (i + 2);
+            m.l1 = i * 11L;
+            m.o2 = "c" + i;
+            m.i1 = -i * 3;
+            m.c1 = (char) (i + 3);
+            m.z2 = (i & 1) == 0;
+            m.o3 = "d" + i;
+            m.d2 = -i / 4.0;
+            m.b2 = (byte) (i + 4);
+            objs[i] = m;
+        }
+        System.gc();
+        for (int i = 0; i < objs.length; i++) {
+            MoreDerived m = objs[i];
+            check(m.i0 == i && m.l0 == -i && m.b0 == (byte) (i + 1) &&
+                  m.s1 == (short) (i * 5) && m.b1 == (byte) (i + 2) &&
+                  m.l1 == i * 11L && m.i1 == -i * 3 && m.c1 == (char) (i + 3) &&
+                  m.z2 == ((i & 1) == 0) && m.d2 == -i / 4.0 && m.b2 == (byte) (i + 4),
+                  "primitive field of MoreDerived " + i + " changed");
+            check(m.o0.equals("a" + i) && m.o1.equals("b" + i) &&
+                  m.o2.equals("c" + i) && m.o3.equals("d" + i),
+                  "oop field of MoreDerived " + i + " changed");
+        }
+    }
+}
@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2026 SAP SE. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+/*
+ * @test TestLockStack
+ * @summary Contended and recursive locking, inflation over a fast-lock,
+ *          wait/notify and identity hash codes of locked objects with
+ *          UseLockStack
+ * @requires os.arch=="amd64" | os.arch=="x86_64" | os.arch=="x86" | os.arch=="i386"
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+UseLockStack TestLockStack
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+UseLockStack -Xint TestLockStack
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+UseLockStack -XX:TieredStopAtLevel=1 TestLockStack
+ */
+
+public class TestLockStack {
+
+    static final int THREADS = 8;
+    static final int ITERATIONS = 20_000;
+
+    static int counter;
+
+    public static void main(String... args) throws Exception {
+        testContended();
+        testInflationWhileRecursive();
+        testWaitNotify();
+        testRecursiveWait();
+        testIdentityHashCode();
+    }
+
+    static void check(boolean condition, String message) {
+        if (!condition) {
+            throw new RuntimeException(message);
+        }
+    }
+
+    static void awaitBlocked(Thread t) throws InterruptedException {
+        while (t.getState() != Thread.State.BLOCKED) {
+            check(t.isAlive(), t.getName() + " ended before it blocked");
+            Thread.sleep(1);
+        }
+    }
+
+    // Many threads enter the same lock, recursively and with yields inside,
+    // so the lock is fast-locked, contended and inflated over and over.
+    static void testContended() throws Exception {
+        final Object lock = new Object();
+        counter = 0;
+        Thread[] threads = new Thread[THREADS];
+        for (int i = 0; i < THREADS; i++) {
+            threads[i] = new Thread(() -> {
+                for (int j = 0; j < ITERATIONS; j++) {
+                    synchronized (lock) {
+                        synchronized (lock) {
+                            counter++;
+                            if (j % 1000 == 0) {
+                                Thread.yield();
+                            }
+                        }
+                    }
+                }
+            });
+            threads[i].start();
+        }
+        for (Thread t : threads) {
+            t.join();
+        }
+        check(counter == THREADS * ITERATIONS, "lost updates: " + counter);
+    }
+
+    // A contender inflates the lock while the owner holds it fast-locked
+    // three times. The owner must keep the lock until its last exit.
+    static void testInflationWhileRecursive() throws Exception {
+        final Object lock = new Object();
+        final boolean[] entered = new boolean[1];
+        Thread contender = new Thread(() -> {
+            synchronized (lock) {
+                entered[0] = true;
+            }
+        });
+        synchronized (lock) {
+            synchronized (lock) {
+                synchronized (lock) {
+                    contender.start();
+                    awaitBlocked(contender);
+                    check(Thread.holdsLock(lock), "owner lost the lock after inflation");
+                }
+                check(Thread.holdsLock(lock), "owner lost the lock after the first exit");
+                Thread.sleep(10);
+                check(!entered[0], "contender entered during recursive exits");
+            }
+            check(Thread.holdsLock(lock), "owner lost the lock after the second exit");
+            check(!entered[0], "contender entered during recursive exits");
+        }
+        contender.join();
+        check(entered[0], "contender never entered");
+        check(!Thread.holdsLock(lock), "lock still held after the last exit");
+    }
+
+    // Producer and consumer hand over a value with wait/notify.
+    static void testWaitNotify() throws Exception {
+        final Object lock = new Object();
+        final int[] slot = new int[] { -1 };
+        final int count = 1000;
+        Thread consumer = new Thread(() -> {
+            for (int i = 0; i < count; i++) {
+                synchronized (lock) {
+                    while (slot[0] == -1) {
+                        try {
+                            lock.wait();
+                        } catch (InterruptedException e) {
+                            throw new RuntimeException(e);
+                        }
+                    }
+                    check(slot[0] == i, "expected " + i + " but got " + slot[0]);
+                    slot[0] = -1;
+                    lock.notifyAll();
+                }
+            }
+        });
+        consumer.start();
+        for (int i = 0; i < count; i++) {
+            synchronized (lock) {
+                while (slot[0] != -1) {
+                    lock.wait();
+                }
+                slot[0] = i;
+                lock.notifyAll();
+            }
+        }
+        consumer.join();
+    }
+
+    // Waiting releases all recursive entries and restores them on return.
+    static void testRecursiveWait() throws Exception {
+        final Object lock = new Object();
+        final boolean[] entered = new boolean[1];
+        Thread other = new Thread(() -> {
+            synchronized (lock) {
+                entered[0] = true;
+                lock.notifyAll();
+            }
+        });
+        synchronized (lock) {
+            synchronized (lock) {
+                other.start();
+                while (!entered[0]) {
+                    lock.wait();
+                }
+                check(Thread.holdsLock(lock), "lock not held after wait");
+            }
+            check(Thread.holdsLock(lock), "recursion not restored after wait");
+        }
+        other.join();
+        check(!Thread.holdsLock(lock), "lock still held after the last exit");
+    }
+
+    // The identity hash code stays the same whether it is computed before,
+    // while fast-locked, while inflated or after the object is unlocked.
+    static void testIdentityHashCode() throws Exception {
+        Object before = new Object();
+        int hash = System.identityHashCode(before);
+        synchronized (before) {
+            check(System.identityHashCode(before) == hash, "hash changed by locking");
+        }
+        check(System.identityHashCode(before) == hash, "hash changed by unlocking");
+
+        final Object during = new Object();
+        int hashLocked;
+        synchronized (during) {
+            hashLocked = during.hashCode();
+            check(during.hashCode() == hashLocked, "hash changed while locked");
+            synchronized (during) {
+                check(during.hashCode() == hashLocked, "hash changed by recursive locking");
+            }
+        }
+        check(during.hashCode() == hashLocked, "hash changed by unlocking");
+
+        final Object inflated = new Object();
+        Thread contender = new Thread(() -> {
+            synchronized (inflated) {
+            }
+        });
+        int hashInflated;
+        synchronized (inflated) {
+            contender.start();
+            awaitBlocked(contender);
+            hashInflated = inflated.hashCode();
+            check(inflated.hashCode() == hashInflated, "hash changed while inflated");
+        }
+        contender.join();
+        check(inflated.hashCode() == hashInflated, "hash changed after inflation");
+    }
+}
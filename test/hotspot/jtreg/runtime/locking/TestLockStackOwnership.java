@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026 SAP SE. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+/*
+ * @test TestLockStackOwnership
+ * @summary Lock owner, locked monitor and deadlock queries through
+ *          ThreadMXBean, which use the JVMTI-style owner lookups of the VM,
+ *          for fast-locked and anonymously owned monitors with UseLockStack
+ * @requires os.arch=="amd64" | os.arch=="x86_64" | os.arch=="x86" | os.arch=="i386"
+ * @modules java.management
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+UseLockStack TestLockStackOwnership
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+UseLockStack -Xint TestLockStackOwnership
+ */
+
+import java.lang.management.ManagementFactory;
+import java.lang.management.MonitorInfo;
+import java.lang.management.ThreadInfo;
+import java.lang.management.ThreadMXBean;
+import java.util.Arrays;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.CyclicBarrier;
+
+public class TestLockStackOwnership {
+
+    static final ThreadMXBean mbean = ManagementFactory.getThreadMXBean();
+
+    public static void main(String... args) throws Exception {
+        testOwnerQueries();
+        testDeadlock();
+    }
+
+    static void check(boolean condition, String message) {
+        if (!condition) {
+            throw new RuntimeException(message);
+        }
+    }
+
+    static void awaitBlocked(Thread t) throws InterruptedException {
+        while (t.getState() != Thread.State.BLOCKED) {
+            check(t.isAlive(), t.getName() + " ended before it blocked");
+            Thread.sleep(1);
+        }
+    }
+
+    static ThreadInfo info(Thread t) {
+        return mbean.getThreadInfo(new long[] { t.getId() }, true, false)[0];
+    }
+
+    static boolean holdsMonitor(Thread t, Object lock) {
+        for (MonitorInfo mi : info(t).getLockedMonitors()) {
+            if (mi.getIdentityHashCode() == System.identityHashCode(lock)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // The owner holds the lock fast-locked, then a contender inflates it,
+    // which leaves the monitor anonymously owned until the owner claims it.
+    // Both states must report the right owner.
+    static void testOwnerQueries() throws Exception {
+        final Object lock = new Object();
+        final CountDownLatch locked = new CountDownLatch(1);
+        final CountDownLatch release = new CountDownLatch(1);
+        Thread owner = new Thread(() -> {
+            synchronized (lock) {
+                synchronized (lock) {
+                    locked.countDown();
+                    try {
+                        release.await();
+                    } catch (InterruptedException e) {
+                        throw new RuntimeException(e);
+                    }
+                }
+            }
+        }, "Owner");
+        owner.start();
+        locked.await();
+
+        check(!Thread.holdsLock(lock), "main thread does not hold the lock");
+        check(holdsMonitor(owner, lock), "fast-locked monitor not reported for the owner");
+
+        Thread contender = new Thread(() -> {
+            synchronized (lock) {
+            }
+        }, "Contender");
+        contender.start();
+        awaitBlocked(contender);
+
+        ThreadInfo ci = info(contender);
+        check(ci.getLockOwnerId() == owner.getId(),
+              "contender blocked on " + ci.getLockName() + " owned by " + ci.getLockOwnerName());
+        check(ci.getLockInfo().getIdentityHashCode() == System.identityHashCode(lock),
+              "contender blocked on the wrong lock: " + ci.getLockName());
+        check(holdsMonitor(owner, lock), "inflated monitor not reported for the owner");
+        check(!holdsMonitor(contender, lock), "monitor reported for the contender");
+
+        release.countDown();
+        owner.join();
+        contender.join();
+    }
+
+    // Two threads each hold one lock and block on the other's.
+    static void testDeadlock() throws Exception {
+        final Object a = new Object();
+        final Object b = new Object();
+        final CyclicBarrier barrier = new CyclicBarrier(2);
+        Thread t1 = new Thread(() -> lockBoth(a, b, barrier), "Deadlock-1");
+        Thread t2 = new Thread(() -> lockBoth(b, a, barrier), "Deadlock-2");
+        t1.setDaemon(true);
+        t2.setDaemon(true);
+        t1.start();
+        t2.start();
+        awaitBlocked(t1);
+        awaitBlocked(t2);
+
+        long[] expected = new long[] { t1.getId(), t2.getId() };
+        Arrays.sort(expected);
+        long[] found = mbean.findDeadlockedThreads();
+        check(found != null, "deadlock not found");
+        Arrays.sort(found);
+        check(Arrays.equals(expected, found), "wrong deadlocked threads: " + Arrays.toString(found));
+        found = mbean.findMonitorDeadlockedThreads();
+        check(found != null, "monitor deadlock not found");
+        Arrays.sort(found);
+        check(Arrays.equals(expected, found), "wrong monitor deadlocked threads: " + Arrays.toString(found));
+
+        check(info(t1).getLockOwnerId() == t2.getId(), "wrong owner of the lock t1 waits for");
+        check(info(t2).getLockOwnerId() == t1.getId(), "wrong owner of the lock t2 waits for");
+    }
+
+    static void lockBoth(Object first, Object second, CyclicBarrier barrier) {
+        synchronized (first) {
+            try {
+                barrier.await();
+            } catch (Exception e) {
+                throw new RuntimeException(e);
+            }
+            synchronized (second) {
+                throw new RuntimeException("both locks taken");
+            }
+        }
+    }
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 SAP SE. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+/*
+ * @test TestLockStackThreadPrint
+ * @summary Thread.print reports an inflated, anonymously owned monitor as
+ *          locked by the thread that fast-locked it with UseLockStack
+ * @requires os.arch=="amd64" | os.arch=="x86_64" | os.arch=="x86" | os.arch=="i386"
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+UseLockStack TestLockStackThreadPrint
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+UseLockStack -Xint TestLockStackThreadPrint
+ */
+
+import java.util.concurrent.CountDownLatch;
+
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+
+public class TestLockStackThreadPrint {
+
+    static final Object lock = new Object();
+    static final CountDownLatch locked = new CountDownLatch(1);
+    static volatile boolean done;
+
+    public static void main(String... args) throws Exception {
+        Thread owner = new Thread(TestLockStackThreadPrint::spinLocked, "Owner");
+        owner.start();
+        locked.await();
+
+        // The contender inflates the fast-locked monitor. The owner neither
+        // exits nor waits while it spins, so the monitor stays anonymously
+        // owned and is held in the owner's top frame.
+        Thread contender = new Thread(() -> {
+            synchronized (lock) {
+            }
+        }, "Contender");
+        contender.start();
+        awaitBlocked(contender);
+
+        try {
+            OutputAnalyzer output = new PidJcmdExecutor().execute("Thread.print");
+            String ownerStack = stackOf(output.getStdout(), "Owner");
+            String contenderStack = stackOf(output.getStdout(), "Contender");
+            check(ownerStack.contains("- locked <") && !ownerStack.contains("- waiting to lock <"),
+                  "owner not reported as holding the monitor:\n" + ownerStack);
+            check(contenderStack.contains("- waiting to lock <"),
+                  "contender not reported as waiting for the monitor:\n" + contenderStack);
+        } finally {
+            done = true;
+            owner.join();
+            contender.join();
+        }
+    }
+
+    static void spinLocked() {
+        synchronized (lock) {
+            locked.countDown();
+            while (!done) {
+                // spin
+            }
+        }
+    }
+
+    static void check(boolean condition, String message) {
+        if (!condition) {
+            throw new RuntimeException(message);
+        }
+    }
+
+    static void awaitBlocked(Thread t) throws InterruptedException {
+        while (t.getState() != Thread.State.BLOCKED) {
+            check(t.isAlive(), t.getName() + " ended before it blocked");
+            Thread.sleep(1);
+        }
+    }
+
+    // Returns the stack of the named thread, up to the blank line that ends it.
+    static String stackOf(String threadDump, String name) {
+        int start = threadDump.indexOf("\"" + name + "\"");
+        check(start >= 0, name + " not found in the thread dump:\n" + threadDump);
+        int end = threadDump.indexOf("\n\n", start);
+        return end < 0 ? threadDump.substring(start) : threadDump.substring(start, end);
+    }
+}